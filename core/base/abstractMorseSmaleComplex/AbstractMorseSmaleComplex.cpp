@@ -1,5 +1,7 @@
 #include <AbstractMorseSmaleComplex.h>
 
+#include <tuple>
+
 using namespace ttk;
 
 AbstractMorseSmaleComplex::AbstractMorseSmaleComplex() {
@@ -8,3 +10,100 @@ AbstractMorseSmaleComplex::AbstractMorseSmaleComplex() {
 
 AbstractMorseSmaleComplex::~AbstractMorseSmaleComplex() {
 }
+
+void AbstractMorseSmaleComplex::checkGradientCache(
+  const AbstractTriangulation &triangulation) {
+
+  const bool reuse = this->InputTimeStamp[0] != 0
+                     && this->InputTimeStamp[1] != 0;
+  if(reuse && &triangulation == this->gradientTriangulation_
+     && this->InputTimeStamp == this->gradientTimeStamp_
+     && this->inputScalarField_ == this->gradientScalarField_
+     && this->inputOffsets_ == this->gradientOffsets_
+     && this->IterationThreshold == this->gradientIterationThreshold_) {
+    return;
+  }
+
+  // an empty key never matches
+  this->gradientTriangulation_ = reuse ? &triangulation : nullptr;
+  this->gradientTimeStamp_ = this->InputTimeStamp;
+  this->gradientScalarField_ = this->inputScalarField_;
+  this->gradientOffsets_ = this->inputOffsets_;
+  this->gradientIterationThreshold_ = this->IterationThreshold;
+  // release the memory of the previous copy
+  this->plGradient_ = {};
+  this->hasPlGradient_ = false;
+  this->saddleConnectorsHierarchy_ = {};
+
+  // buildGradient() expects an unpaired gradient
+  this->discreteGradient_.initMemory(triangulation);
+  this->gradientState_ = GradientState::EMPTY;
+}
+
+void AbstractMorseSmaleComplex::resolveManifolds(
+  std::vector<SimplexId> &successors, SimplexId *const manifold) const {
+
+  Timer tm{};
+  const SimplexId nCells = successors.size();
+  std::vector<SimplexId> jumps(nCells);
+
+  // every round doubles the jump lengths until the path ends are reached
+  size_t nRounds{};
+  SimplexId nChanged{1};
+  while(nChanged > 0) {
+    nChanged = 0;
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_) reduction(+ : nChanged)
+#endif // TTK_ENABLE_OPENMP
+    for(SimplexId i = 0; i < nCells; ++i) {
+      jumps[i] = successors[successors[i]];
+      if(jumps[i] != successors[i]) {
+        nChanged++;
+      }
+    }
+    std::swap(successors, jumps);
+    nRounds++;
+  }
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif // TTK_ENABLE_OPENMP
+  for(SimplexId i = 0; i < nCells; ++i) {
+    if(successors[i] != i) {
+      manifold[i] = manifold[successors[i]];
+    }
+  }
+
+  this->printMsg("Resolved manifolds (" + std::to_string(nRounds)
+                   + " pointer jumping rounds)",
+                 1.0, tm.getElapsedTime(), this->threadNumber_,
+                 debug::LineMode::NEW, debug::Priority::DETAIL);
+}
+
+void SeparatricesGeometry::gather(
+  const std::vector<std::vector<dcg::Cell>> &arenas,
+  const std::vector<ArenaRange> &ranges,
+  const int threadNumber) {
+
+  const auto first = this->size();
+  offsets_.resize(first + ranges.size() + 1);
+  for(size_t i = 0; i < ranges.size(); ++i) {
+    offsets_[first + i + 1]
+      = offsets_[first + i] + ranges[i].end_ - ranges[i].begin_;
+  }
+  cells_.resize(offsets_.back());
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber)
+#else
+  std::ignore = threadNumber;
+#endif // TTK_ENABLE_OPENMP
+  for(size_t i = 0; i < ranges.size(); ++i) {
+    const auto &r = ranges[i];
+    if(r.begin_ != r.end_) {
+      const auto &arena = arenas[r.arena_];
+      std::copy(arena.begin() + r.begin_, arena.begin() + r.end_,
+                cells_.begin() + offsets_[first + i]);
+    }
+  }
+}
@@ -28,81 +28,90 @@ namespace ttk {
    */
   struct Separatrix {
     // default :
-    explicit Separatrix()
-      : isValid_{}, source_{}, destination_{}, isReversed_{}, geometry_{} {
-    }
-
-    // initialization with one segment :
-    explicit Separatrix(const bool isValid,
-                        const dcg::Cell &saddle,
-                        const dcg::Cell &extremum,
-                        const bool isSegmentReversed,
-                        const SimplexId segmentGeometry)
-      : isValid_{isValid}, source_{saddle}, destination_{extremum} {
-      isReversed_.push_back(isSegmentReversed);
-      geometry_.push_back(segmentGeometry);
-    }
+    explicit Separatrix() = default;
 
-    // initialization with multiple segments :
+    // initialization with its geometry :
     explicit Separatrix(const bool isValid,
                         const dcg::Cell &saddle,
                         const dcg::Cell &extremum,
-                        const std::vector<char> &isReversed,
-                        const std::vector<SimplexId> &geometry)
+                        const SimplexId geometry)
       : isValid_{isValid}, source_{saddle}, destination_{extremum},
-        isReversed_{isReversed}, geometry_{geometry} {
+        geometry_{geometry} {
     }
 
-    explicit Separatrix(const Separatrix &separatrix)
-      : isValid_{separatrix.isValid_}, source_{separatrix.source_},
-        destination_{separatrix.destination_},
-        isReversed_{separatrix.isReversed_}, geometry_{separatrix.geometry_} {
-    }
+    /**
+     * Flag indicating if this separatrix can be processed.
+     */
+    bool isValid_{false};
 
-    explicit Separatrix(Separatrix &&separatrix) noexcept
-      : isValid_{separatrix.isValid_}, source_{separatrix.source_},
-        destination_{separatrix.destination_}, isReversed_{std::move(
-                                                 separatrix.isReversed_)},
-        geometry_{std::move(separatrix.geometry_)} {
-    }
+    /**
+     * Source cell of the separatrix.
+     */
+    dcg::Cell source_{};
 
-    Separatrix &operator=(Separatrix &&separatrix) noexcept {
-      isValid_ = separatrix.isValid_;
-      source_ = separatrix.source_;
-      destination_ = separatrix.destination_;
-      isReversed_ = std::move(separatrix.isReversed_);
-      geometry_ = std::move(separatrix.geometry_);
+    /**
+     * Destination cell of the separatrix.
+     */
+    dcg::Cell destination_{};
 
-      return *this;
-    }
+    /**
+     * Index of the geometry of the separatrix in a separate
+     * container (i.e. separatricesGeometry), -1 if none.
+     */
+    SimplexId geometry_{-1};
+  };
 
+  /**
+   * Flat storage of the geometry of 1-separatrices: the cells
+   * of the i-th geometry are stored in cells_, between offsets_[i] and
+   * offsets_[i + 1].
+   *
+   * The v-paths are traced in per-thread arenas (one growing vector of
+   * cells per thread) then gathered in parallel, so that no allocation
+   * is performed per v-path.
+   */
+  struct SeparatricesGeometry {
     /**
-     * Flag indicating if this separatrix can be processed.
+     * Location of a v-path in a per-thread arena.
      */
-    bool isValid_;
+    struct ArenaRange {
+      int arena_;
+      size_t begin_;
+      size_t end_;
+    };
+
+    std::vector<dcg::Cell> cells_{};
+    std::vector<size_t> offsets_{0};
 
     /**
-     * Source cell of the separatrix.
+     * Number of geometries.
      */
-    dcg::Cell source_;
+    inline size_t size() const {
+      return offsets_.size() - 1;
+    }
 
     /**
-     * Destination cell of the separatrix.
+     * Number of cells of the i-th geometry.
      */
-    dcg::Cell destination_;
+    inline size_t size(const size_t i) const {
+      return offsets_[i + 1] - offsets_[i];
+    }
 
     /**
-     * Container of flags, isReversed[i] indicates if the
-     * element stored at id=geometry_[i] can be reversed.
+     * Pointer to the first cell of the i-th geometry.
      */
-    std::vector<char> isReversed_;
+    inline const dcg::Cell *begin(const size_t i) const {
+      return cells_.data() + offsets_[i];
+    }
 
     /**
-     * Container of ids. Each id addresses a separate
-     * container corresponding to a dense representation
-     * of the geometry (i.e. separatricesGeometry).
+     * Append the v-paths traced in the per-thread @p arenas after the
+     * current geometries (the i-th new geometry is located at @p
+     * ranges[i], empty ranges stand for invalid separatrices).
      */
-    std::vector<SimplexId> geometry_;
+    void gather(const std::vector<std::vector<dcg::Cell>> &arenas,
+                const std::vector<ArenaRange> &ranges,
+                const int threadNumber);
   };
 
   /**
@@ -120,6 +129,7 @@ namespace ttk {
      * Disable thresholding with -1 (default).
      */
     int setIterationThreshold(const int iterationThreshold) {
+      IterationThreshold = iterationThreshold;
       discreteGradient_.setIterationThreshold(iterationThreshold);
       return 0;
     }
@@ -178,7 +188,6 @@ namespace ttk {
      */
     int setReturnSaddleConnectors(const bool state) {
       ReturnSaddleConnectors = state;
-      discreteGradient_.setReturnSaddleConnectors(state);
       return 0;
     }
 
@@ -193,12 +202,52 @@ namespace ttk {
       return 0;
     }
 
+    /**
+     * Enable/Disable the cancellation hierarchy of the saddle connectors
+     * (disabled by default). The complete sequence of saddle connectors
+     * cancellations is recorded once, the next executions on the same
+     * input with another persistence threshold apply or undo the
+     * cancellations in between instead of filtering the gradient again
+     * (see setInputTimeStamp()).
+     */
+    int setSaddleConnectorsHierarchy(const bool state) {
+      SaddleConnectorsHierarchy = state;
+      return 0;
+    }
+
+    /**
+     * Enable/Disable the pointer jumping computation of the ascending
+     * and descending segmentations (disabled by default). Every cell
+     * points to its gradient successor and the manifold ids are resolved
+     * in a logarithmic number of parallel rounds over all the cells,
+     * instead of one breadth-first search per extremum.
+     */
+    int setPointerJumpingSegmentation(const bool state) {
+      PointerJumpingSegmentation = state;
+      return 0;
+    }
+
+    /**
+     * Identify the input scalar field and offsets of the next execution
+     * (e.g. with their modification times) to reuse the discrete
+     * gradient of the previous execution on the same triangulation when
+     * only the output options or the saddle connectors persistence
+     * threshold changed. This keeps a copy of the gradient when returning
+     * saddle connectors. 0 (default) disables the reuse.
+     */
+    int setInputTimeStamp(const size_t scalarFieldTimeStamp,
+                          const size_t offsetsTimeStamp) {
+      InputTimeStamp = {scalarFieldTimeStamp, offsetsTimeStamp};
+      return 0;
+    }
+
     /**
      * Set the input triangulation and preprocess the needed
      * mesh traversal queries.
      */
     inline void preconditionTriangulation(AbstractTriangulation *const data) {
-      discreteGradient_.preconditionTriangulation(data);
+      // the gradient memory is managed by checkGradientCache()
+      discreteGradient_.preconditionTriangulation(data, false);
       data->preconditionCellEdges();
       data->preconditionCellNeighbors();
     }
@@ -351,7 +400,7 @@ namespace ttk {
     int getDescendingSeparatrices1(
       const std::vector<dcg::Cell> &criticalPoints,
       std::vector<Separatrix> &separatrices,
-      std::vector<std::vector<dcg::Cell>> &separatricesGeometry,
+      SeparatricesGeometry &separatricesGeometry,
       const triangulationType &triangulation) const;
 
     /**
@@ -364,10 +413,9 @@ namespace ttk {
      * inputScalarField_
      */
     template <typename triangulationType>
-    int setSeparatrices1(
-      const std::vector<Separatrix> &separatrices,
-      const std::vector<std::vector<dcg::Cell>> &separatricesGeometry,
-      const triangulationType &triangulation) const;
+    int setSeparatrices1(const std::vector<Separatrix> &separatrices,
+                         const SeparatricesGeometry &separatricesGeometry,
+                         const triangulationType &triangulation) const;
 
     /**
      * Compute the ascending manifold of the maxima.
@@ -401,6 +449,24 @@ namespace ttk {
                              const triangulationType &triangulation) const;
 
   protected:
+    /**
+     * Forget the discrete gradient of the previous execution if it was
+     * not computed on the same triangulation and input (time stamps,
+     * arrays and iteration threshold), and allocate it if needed.
+     */
+    void checkGradientCache(const AbstractTriangulation &triangulation);
+
+    /**
+     * Set the manifold ids of all the cells by pointer jumping.
+     *
+     * @param[in,out] successors Gradient successor of every cell (itself
+     * at the end of the gradient paths), path end on output
+     * @param[in,out] manifold Manifold id of every cell, only read at the
+     * end of the gradient paths
+     */
+    void resolveManifolds(std::vector<SimplexId> &successors,
+                          SimplexId *const manifold) const;
+
     bool ReverveSaddleMaximumConnection{false};
     bool ReverveSaddleSaddleConnection{false};
     bool ComputeAscendingSeparatrices1{true};
@@ -409,10 +475,32 @@ namespace ttk {
     bool ComputeAscendingSeparatrices2{false};
     bool ComputeDescendingSeparatrices2{false};
     bool ReturnSaddleConnectors{false};
+    bool PointerJumpingSegmentation{false};
+    bool SaddleConnectorsHierarchy{false};
     double SaddleConnectorsPersistenceThreshold{};
+    int IterationThreshold{-1};
+    std::array<size_t, 2> InputTimeStamp{};
 
     dcg::DiscreteGradient discreteGradient_{};
 
+    // reuse of the discrete gradient across executions
+    enum class GradientState { EMPTY, BUILT, FILTERED };
+    GradientState gradientState_{GradientState::EMPTY};
+    // input of the current gradient
+    const AbstractTriangulation *gradientTriangulation_{};
+    std::array<size_t, 2> gradientTimeStamp_{};
+    const void *gradientScalarField_{};
+    const SimplexId *gradientOffsets_{};
+    int gradientIterationThreshold_{-1};
+    // threshold of the saddle connectors filtering (FILTERED state)
+    double gradientPersistenceThreshold_{};
+    // copy of the PL-conformant gradient (empty if none)
+    dcg::gradientType plGradient_{};
+    bool hasPlGradient_{false};
+    // cancellations of the saddle connectors applied on top of the
+    // PL-conformant gradient (FILTERED state)
+    dcg::SaddleConnectorsHierarchy saddleConnectorsHierarchy_{};
+
     const void *inputScalarField_{};
     const SimplexId *inputOffsets_{};
 
@@ -460,7 +548,7 @@ template <typename triangulationType>
 int ttk::AbstractMorseSmaleComplex::getDescendingSeparatrices1(
   const std::vector<Cell> &criticalPoints,
   std::vector<Separatrix> &separatrices,
-  std::vector<std::vector<Cell>> &separatricesGeometry,
+  SeparatricesGeometry &separatricesGeometry,
   const triangulationType &triangulation) const {
 
   std::vector<SimplexId> saddleIndexes;
@@ -477,7 +565,11 @@ int ttk::AbstractMorseSmaleComplex::getDescendingSeparatrices1(
   // numberOfAscendingPaths=2, numberOfDescendingPaths=2
   const SimplexId numberOfSeparatrices = 4 * numberOfSaddles;
   separatrices.resize(numberOfSeparatrices);
-  separatricesGeometry.resize(numberOfSeparatrices);
+
+  // vpaths traced in per-thread arenas
+  std::vector<std::vector<Cell>> arenas(this->threadNumber_);
+  std::vector<SeparatricesGeometry::ArenaRange> ranges(numberOfSeparatrices);
+  const SimplexId firstGeometry = separatricesGeometry.size();
 
   // apriori: by default construction, the separatrices are not valid
 #ifdef TTK_ENABLE_OPENMP
@@ -487,6 +579,13 @@ int ttk::AbstractMorseSmaleComplex::getDescendingSeparatrices1(
     const SimplexId saddleIndex = saddleIndexes[i];
     const Cell &saddle = criticalPoints[saddleIndex];
 
+#ifdef TTK_ENABLE_OPENMP
+    const int tid = omp_get_thread_num();
+#else
+    const int tid = 0;
+#endif // TTK_ENABLE_OPENMP
+    auto &vpaths = arenas[tid];
+
     // add descending vpaths
     {
       const Cell &saddle1 = saddle;
@@ -497,30 +596,34 @@ int ttk::AbstractMorseSmaleComplex::getDescendingSeparatrices1(
         SimplexId vertexId;
         triangulation.getEdgeVertex(saddle1.id_, j, vertexId);
 
-        std::vector<Cell> vpath;
-        vpath.push_back(saddle1);
+        const size_t begin = vpaths.size();
+        vpaths.push_back(saddle1);
         discreteGradient_.getDescendingPath(
-          Cell(0, vertexId), vpath, triangulation);
+          Cell(0, vertexId), vpaths, triangulation);
 
-        const Cell &lastCell = vpath.back();
+        const Cell lastCell = vpaths.back();
         if(lastCell.dim_ == 0 and discreteGradient_.isCellCritical(lastCell)) {
           const SimplexId separatrixIndex = 4 * i + shift;
 
-          separatricesGeometry[separatrixIndex] = std::move(vpath);
-          separatrices[separatrixIndex]
-            = Separatrix(true, saddle, lastCell, false, separatrixIndex);
+          ranges[separatrixIndex] = {tid, begin, vpaths.size()};
+          separatrices[separatrixIndex] = Separatrix(
+            true, saddle, lastCell, firstGeometry + separatrixIndex);
+        } else {
+          vpaths.resize(begin);
         }
       }
     }
   }
 
+  separatricesGeometry.gather(arenas, ranges, this->threadNumber_);
+
   return 0;
 }
 
 template <typename triangulationType>
 int ttk::AbstractMorseSmaleComplex::setSeparatrices1(
   const std::vector<Separatrix> &separatrices,
-  const std::vector<std::vector<dcg::Cell>> &separatricesGeometry,
+  const SeparatricesGeometry &separatricesGeometry,
   const triangulationType &triangulation) const {
 
 #ifndef TTK_ENABLE_KAMIKAZE
@@ -575,18 +678,16 @@ int ttk::AbstractMorseSmaleComplex::setSeparatrices1(
   // count total number of points and cells, flatten geometryId loops
   for(size_t i = 0; i < separatrices.size(); ++i) {
     const auto &sep = separatrices[i];
-    if(!sep.isValid_ || sep.geometry_.empty()) {
+    if(!sep.isValid_ || sep.geometry_ == -1) {
       continue;
     }
-    for(const auto geomId : sep.geometry_) {
-      const auto sepSize = separatricesGeometry[geomId].size();
-      npoints += sepSize;
-      ncells += sepSize - 1;
-      geomPointsBegId.emplace_back(npoints);
-      geomCellsBegId.emplace_back(ncells);
-      validGeomIds.emplace_back(geomId);
-      geomIdSep.emplace_back(i);
-    }
+    const auto sepSize = separatricesGeometry.size(sep.geometry_);
+    npoints += sepSize;
+    ncells += sepSize - 1;
+    geomPointsBegId.emplace_back(npoints);
+    geomCellsBegId.emplace_back(ncells);
+    validGeomIds.emplace_back(sep.geometry_);
+    geomIdSep.emplace_back(i);
   }
 
   const int dimensionality = triangulation.getCellVertexNumber(0) - 1;
@@ -622,7 +723,8 @@ int ttk::AbstractMorseSmaleComplex::setSeparatrices1(
 #endif // TTK_ENABLE_OPENMP
   for(size_t i = 0; i < validGeomIds.size(); ++i) {
     const auto &sep = separatrices[geomIdSep[i]];
-    const auto &sepGeom = separatricesGeometry[validGeomIds[i]];
+    const auto sepGeom = separatricesGeometry.begin(validGeomIds[i]);
+    const auto sepSize = separatricesGeometry.size(validGeomIds[i]);
     const auto sepId = separatrixId + i;
     // saddle (asc/desc sep) or saddle1 (saddle connector)
     const dcg::Cell &src = sep.source_;
@@ -659,7 +761,7 @@ int ttk::AbstractMorseSmaleComplex::setSeparatrices1(
       = static_cast<char>(discreteGradient_.isBoundary(src, triangulation))
         + static_cast<char>(discreteGradient_.isBoundary(dst, triangulation));
 
-    for(size_t j = 0; j < sepGeom.size(); ++j) {
+    for(size_t j = 0; j < sepSize; ++j) {
       const auto &cell = sepGeom[j];
       std::array<float, 3> pt{};
       triangulation.getCellIncenter(cell.id_, cell.dim_, pt.data());
@@ -673,7 +775,7 @@ int ttk::AbstractMorseSmaleComplex::setSeparatrices1(
 
       if(outputSeparatrices1_points_smoothingMask_ != nullptr)
         (*outputSeparatrices1_points_smoothingMask_)[k]
-          = (j == 0 || j == sepGeom.size() - 1) ? 0 : 1;
+          = (j == 0 || j == sepSize - 1) ? 0 : 1;
       if(outputSeparatrices1_points_cellDimensions_ != nullptr)
         (*outputSeparatrices1_points_cellDimensions_)[k] = cell.dim_;
       if(outputSeparatrices1_points_cellIds_ != nullptr)
@@ -746,44 +848,74 @@ int ttk::AbstractMorseSmaleComplex::setAscendingSegmentation(
     getFaceStar = &triangulationType::getEdgeStar;
   }
 
+  if(PointerJumpingSegmentation) {
+    // gradient successor of every cell: the other cofacet of its paired
+    // facet (itself for the maxima and the boundary path ends)
+    std::vector<SimplexId> successors(numberOfCells);
 #ifdef TTK_ENABLE_OPENMP
-#pragma omp parallel for num_threads(threadNumber_) schedule(dynamic)
+#pragma omp parallel for num_threads(threadNumber_)
 #endif
-  for(SimplexId i = 0; i < numberOfSeeds; ++i) {
-    std::queue<SimplexId> bfs;
+    for(SimplexId i = 0; i < numberOfCells; ++i) {
+      successors[i] = i;
+      const SimplexId facetId = discreteGradient_.getPairedCell(
+        Cell(cellDim, i), triangulation, true);
+      if(facetId == -1) {
+        continue;
+      }
+      const SimplexId starNumber = (triangulation.*getFaceStarNumber)(facetId);
+      for(SimplexId k = 0; k < starNumber; ++k) {
+        SimplexId neighborId = -1;
+        (triangulation.*getFaceStar)(facetId, k, neighborId);
+        if(neighborId != i) {
+          successors[i] = neighborId;
+        }
+      }
+    }
 
-    // push the seed
-    {
-      const SimplexId seedId = maxSeeds[i];
-      bfs.push(seedId);
+    for(SimplexId i = 0; i < numberOfSeeds; ++i) {
+      morseSmaleManifoldOnCells[maxSeeds[i]] = i;
     }
+    this->resolveManifolds(successors, morseSmaleManifoldOnCells.data());
+  } else {
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_) schedule(dynamic)
+#endif
+    for(SimplexId i = 0; i < numberOfSeeds; ++i) {
+      std::queue<SimplexId> bfs;
 
-    // BFS traversal
-    while(!bfs.empty()) {
-      const SimplexId cofacetId = bfs.front();
-      bfs.pop();
+      // push the seed
+      {
+        const SimplexId seedId = maxSeeds[i];
+        bfs.push(seedId);
+      }
 
-      if(morseSmaleManifoldOnCells[cofacetId] == -1) {
-        morseSmaleManifoldOnCells[cofacetId] = i;
+      // BFS traversal
+      while(!bfs.empty()) {
+        const SimplexId cofacetId = bfs.front();
+        bfs.pop();
 
-        for(int j = 0; j < (cellDim + 1); ++j) {
-          SimplexId facetId = -1;
-          (triangulation.*getCellFace)(cofacetId, j, facetId);
+        if(morseSmaleManifoldOnCells[cofacetId] == -1) {
+          morseSmaleManifoldOnCells[cofacetId] = i;
 
-          SimplexId starNumber = (triangulation.*getFaceStarNumber)(facetId);
-          for(SimplexId k = 0; k < starNumber; ++k) {
-            SimplexId neighborId = -1;
-            (triangulation.*getFaceStar)(facetId, k, neighborId);
+          for(int j = 0; j < (cellDim + 1); ++j) {
+            SimplexId facetId = -1;
+            (triangulation.*getCellFace)(cofacetId, j, facetId);
 
-            if(neighborId == cofacetId) {
-              continue;
-            }
+            SimplexId starNumber = (triangulation.*getFaceStarNumber)(facetId);
+            for(SimplexId k = 0; k < starNumber; ++k) {
+              SimplexId neighborId = -1;
+              (triangulation.*getFaceStar)(facetId, k, neighborId);
+
+              if(neighborId == cofacetId) {
+                continue;
+              }
 
-            const SimplexId pairedCellId = discreteGradient_.getPairedCell(
-              Cell(cellDim, neighborId), triangulation, true);
+              const SimplexId pairedCellId = discreteGradient_.getPairedCell(
+                Cell(cellDim, neighborId), triangulation, true);
 
-            if(pairedCellId == facetId)
-              bfs.push(neighborId);
+              if(pairedCellId == facetId)
+                bfs.push(neighborId);
+            }
           }
         }
       }
@@ -825,45 +957,74 @@ int ttk::AbstractMorseSmaleComplex::setDescendingSegmentation(
   const SimplexId numberOfSeeds = seeds.size();
   numberOfMinima = numberOfSeeds;
 
+  if(PointerJumpingSegmentation) {
+    // gradient successor of every vertex: the other vertex of its paired
+    // edge (itself for the minima)
+    std::vector<SimplexId> successors(numberOfVertices);
 #ifdef TTK_ENABLE_OPENMP
-#pragma omp parallel for num_threads(threadNumber_) schedule(dynamic)
+#pragma omp parallel for num_threads(threadNumber_)
 #endif
-  for(SimplexId i = 0; i < numberOfSeeds; ++i) {
-    std::queue<SimplexId> bfs;
+    for(SimplexId i = 0; i < numberOfVertices; ++i) {
+      successors[i] = i;
+      const SimplexId edgeId
+        = discreteGradient_.getPairedCell(Cell(0, i), triangulation);
+      if(edgeId == -1) {
+        continue;
+      }
+      for(int k = 0; k < 2; ++k) {
+        SimplexId neighborId;
+        triangulation.getEdgeVertex(edgeId, k, neighborId);
+        if(neighborId != i) {
+          successors[i] = neighborId;
+        }
+      }
+    }
 
-    // push the seed
-    {
-      const SimplexId seedId = seeds[i];
-      bfs.push(seedId);
+    for(SimplexId i = 0; i < numberOfSeeds; ++i) {
+      morseSmaleManifold[seeds[i]] = i;
     }
+    this->resolveManifolds(successors, morseSmaleManifold);
+  } else {
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_) schedule(dynamic)
+#endif
+    for(SimplexId i = 0; i < numberOfSeeds; ++i) {
+      std::queue<SimplexId> bfs;
 
-    // BFS traversal
-    while(!bfs.empty()) {
-      const SimplexId vertexId = bfs.front();
-      bfs.pop();
+      // push the seed
+      {
+        const SimplexId seedId = seeds[i];
+        bfs.push(seedId);
+      }
 
-      if(morseSmaleManifold[vertexId] == -1) {
-        morseSmaleManifold[vertexId] = i;
+      // BFS traversal
+      while(!bfs.empty()) {
+        const SimplexId vertexId = bfs.front();
+        bfs.pop();
 
-        const SimplexId edgeNumber
-          = triangulation.getVertexEdgeNumber(vertexId);
-        for(SimplexId j = 0; j < edgeNumber; ++j) {
-          SimplexId edgeId;
-          triangulation.getVertexEdge(vertexId, j, edgeId);
+        if(morseSmaleManifold[vertexId] == -1) {
+          morseSmaleManifold[vertexId] = i;
 
-          for(int k = 0; k < 2; ++k) {
-            SimplexId neighborId;
-            triangulation.getEdgeVertex(edgeId, k, neighborId);
+          const SimplexId edgeNumber
+            = triangulation.getVertexEdgeNumber(vertexId);
+          for(SimplexId j = 0; j < edgeNumber; ++j) {
+            SimplexId edgeId;
+            triangulation.getVertexEdge(vertexId, j, edgeId);
 
-            if(neighborId == vertexId) {
-              continue;
-            }
+            for(int k = 0; k < 2; ++k) {
+              SimplexId neighborId;
+              triangulation.getEdgeVertex(edgeId, k, neighborId);
 
-            const SimplexId pairedCellId = discreteGradient_.getPairedCell(
-              Cell(0, neighborId), triangulation);
+              if(neighborId == vertexId) {
+                continue;
+              }
 
-            if(pairedCellId == edgeId)
-              bfs.push(neighborId);
+              const SimplexId pairedCellId = discreteGradient_.getPairedCell(
+                Cell(0, neighborId), triangulation);
+
+              if(pairedCellId == edgeId)
+                bfs.push(neighborId);
+            }
           }
         }
       }
@@ -84,61 +84,71 @@ size_t AbstractTriangulation::tableTableFootprint(
   return localByteNumber;
 }
 
-size_t AbstractTriangulation::footprint(size_t size) const {
+size_t AbstractTriangulation::footprint(size_t size, const bool quiet) const {
+
+  // no report if quiet
+  const auto name = [quiet](const char *tableName) {
+    return quiet ? "" : tableName;
+  };
 
   size += sizeof(*this);
   stringstream msg;
 
-  size += tableFootprint<bool>(boundaryEdges_, "boundaryEdges_");
+  size += tableFootprint<bool>(boundaryEdges_, name("boundaryEdges_"));
 
-  size += tableFootprint<bool>(boundaryTriangles_, "boundaryTriangles_");
+  size += tableFootprint<bool>(boundaryTriangles_, name("boundaryTriangles_"));
 
-  size += tableFootprint<bool>(boundaryVertices_, "boundaryVertices_");
+  size += tableFootprint<bool>(boundaryVertices_, name("boundaryVertices_"));
 
-  size += tableFootprint(tetraEdgeList_, "tetraEdgeList_");
+  size += tableFootprint(tetraEdgeList_, name("tetraEdgeList_"));
 
-  size
-    += tableTableFootprint<SimplexId>(cellNeighborList_, "cellNeighborList_");
+  size += tableTableFootprint<SimplexId>(
+    cellNeighborList_, name("cellNeighborList_"));
 
-  size += tableFootprint(tetraTriangleList_, "tetraTriangleList_");
+  size += tableFootprint(tetraTriangleList_, name("tetraTriangleList_"));
 
-  size += tableTableFootprint<SimplexId>(edgeLinkList_, "edgeLinkList_");
+  size += tableTableFootprint<SimplexId>(edgeLinkList_, name("edgeLinkList_"));
 
-  size += tableFootprint(edgeList_, "edgeList_");
+  size += tableFootprint(edgeList_, name("edgeList_"));
 
-  size += tableTableFootprint<SimplexId>(edgeStarList_, "edgeStarList_");
+  size += tableTableFootprint<SimplexId>(edgeStarList_, name("edgeStarList_"));
 
-  size
-    += tableTableFootprint<SimplexId>(edgeTriangleList_, "edgeTriangleList_");
+  size += tableTableFootprint<SimplexId>(
+    edgeTriangleList_, name("edgeTriangleList_"));
 
-  size += tableFootprint(triangleList_, "triangleList_");
+  size += tableFootprint(triangleList_, name("triangleList_"));
 
-  size += tableFootprint(triangleEdgeList_, "triangleEdgeList_");
+  size += tableFootprint(triangleEdgeList_, name("triangleEdgeList_"));
 
-  size
-    += tableTableFootprint<SimplexId>(triangleLinkList_, "triangleLinkList_");
+  size += tableTableFootprint<SimplexId>(
+    triangleLinkList_, name("triangleLinkList_"));
 
-  size
-    += tableTableFootprint<SimplexId>(triangleStarList_, "triangleStarList_");
+  size += tableTableFootprint<SimplexId>(
+    triangleStarList_, name("triangleStarList_"));
 
-  size += tableTableFootprint<SimplexId>(vertexEdgeList_, "vertexEdgeList_");
+  size += tableTableFootprint<SimplexId>(
+    vertexEdgeList_, name("vertexEdgeList_"));
 
-  size += tableTableFootprint<SimplexId>(vertexLinkList_, "vertexLinkList_");
+  size += tableTableFootprint<SimplexId>(
+    vertexLinkList_, name("vertexLinkList_"));
 
   size += tableTableFootprint<SimplexId>(
-    vertexNeighborList_, "vertexNeighborList_");
+    vertexNeighborList_, name("vertexNeighborList_"));
 
-  size += tableTableFootprint<SimplexId>(vertexStarList_, "vertexStarList_");
+  size += tableTableFootprint<SimplexId>(
+    vertexStarList_, name("vertexStarList_"));
 
   size += tableTableFootprint<SimplexId>(
-    vertexTriangleList_, "vertexTriangleList_");
+    vertexTriangleList_, name("vertexTriangleList_"));
 
-  size += tableTableFootprint(cellEdgeVector_, "cellEdgeVector_");
-  size += tableTableFootprint(cellTriangleVector_, "cellTriangleVector_");
-  size += tableTableFootprint(triangleEdgeVector_, "triangleEdgeVector_");
+  size += tableTableFootprint(cellEdgeVector_, name("cellEdgeVector_"));
+  size += tableTableFootprint(cellTriangleVector_, name("cellTriangleVector_"));
+  size += tableTableFootprint(triangleEdgeVector_, name("triangleEdgeVector_"));
 
-  msg << "Total footprint: " << (size / 1024) / 1024 << " MB.";
-  printMsg(msg.str());
+  if(!quiet) {
+    msg << "Total footprint: " << (size / 1024) / 1024 << " MB.";
+    printMsg(msg.str());
+  }
 
   return size;
 }
@@ -14,6 +14,7 @@
 
 // base code includes
 #include <Geometry.h>
+#include <VertexBlocks.h>
 #include <Wrapper.h>
 
 #include <array>
@@ -39,6 +40,8 @@
       ttk::Triangulation::Type::IMPLICIT, ttk::ImplicitTriangulation, call); \
     ttkTemplateMacroCase(ttk::Triangulation::Type::PERIODIC,                 \
                          ttk::PeriodicImplicitTriangulation, call);          \
+    ttkTemplateMacroCase(                                                    \
+      ttk::Triangulation::Type::COMPACT, ttk::CompactTriangulation, call);   \
   }
 
 namespace ttk {
@@ -55,8 +58,10 @@ namespace ttk {
     int clear();
 
     /// Computes and displays the memory footprint of the data-structure.
-    /// \return Returns 0 upon success, negative values otherwise.
-    size_t footprint(size_t size = 0) const;
+    /// \param size Number of bytes already counted by a derived class.
+    /// \param quiet Only compute the footprint, without printing a report.
+    /// \return Returns the footprint in bytes.
+    size_t footprint(size_t size = 0, const bool quiet = false) const;
 
     /// Get the \p localEdgeId-th edge of the \p cellId-th cell.
     ///
@@ -889,6 +894,18 @@ namespace ttk {
       return getNumberOfVerticesInternal();
     };
 
+    /// Get the blocks of a cache-friendly traversal of the vertices (see
+    /// VertexBlocks).
+    ///
+    /// This function is not virtual: the triangulations with a better
+    /// traversal (ImplicitTriangulation) hide it, and callers templated on
+    /// the triangulation type use theirs. The default blocks are chunks of
+    /// consecutive vertices.
+    /// \return Returns the blocks of vertices.
+    inline VertexBlocks getVertexBlocks() const {
+      return VertexBlocks{getNumberOfVertices(), 1024};
+    }
+
     /// \warning
     /// YOU SHOULD NOT CALL THIS FUNCTION UNLESS YOU REALLY KNOW WHAT YOU ARE
     /// DOING.
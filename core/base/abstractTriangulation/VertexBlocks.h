@@ -0,0 +1,99 @@
+/// \ingroup base
+/// \class ttk::VertexBlocks
+/// \author agent <agent@local>.
+/// \date October 2026.
+///
+/// \brief Cache-friendly traversal of the vertices of a triangulation.
+///
+/// The vertices are split in blocks made of rows of consecutive
+/// identifiers. On 3D regular grids, the blocks are bricks: an x-fastest
+/// traversal needs three z-slices of the grid in cache to reuse the
+/// neighbors of the visited vertices, whereas a brick only needs its
+/// boundary layer. Other triangulations are split in chunks of consecutive
+/// identifiers, which keeps the x-fastest order.
+///
+/// The blocks are independent units of work for the parallel vertex loops
+/// whose iterations do not depend on each other:
+/// \code
+/// const auto blocks = triangulation->getVertexBlocks();
+/// #pragma omp parallel for num_threads(threadNumber_)
+/// for(SimplexId block = 0; block < blocks.size(); ++block) {
+///   blocks.forEach(block, [&](const SimplexId v) {
+///     // ...
+///   });
+/// }
+/// \endcode
+///
+/// The traversal of a block has no per-vertex integer division and
+/// AbstractTriangulation::getVertexBlocks() is not virtual: callers
+/// templated on the triangulation type get the blocks of the concrete
+/// triangulation.
+///
+/// \sa ttk::AbstractTriangulation::getVertexBlocks()
+/// \sa ttk::ImplicitTriangulation::setVertexBlockSize()
+
+#pragma once
+
+#include <DataTypes.h>
+
+#include <algorithm>
+#include <array>
+
+namespace ttk {
+
+  class VertexBlocks {
+
+  public:
+    /// Chunks of \p chunkSize consecutive vertices
+    VertexBlocks(const SimplexId vertexNumber, const SimplexId chunkSize)
+      : VertexBlocks({vertexNumber, 1, 1}, {chunkSize, 1, 1}) {
+    }
+
+    /// Blocks of \p blockDimensions vertices of a grid of \p dimensions
+    /// vertices (the last blocks along each axis may be thinner)
+    VertexBlocks(const std::array<SimplexId, 3> &dimensions,
+                 const std::array<SimplexId, 3> &blockDimensions)
+      : dimensions_{dimensions} {
+      for(size_t i = 0; i < 3; ++i) {
+        blockDimensions_[i] = std::max(blockDimensions[i], SimplexId{1});
+        blockNumber_[i]
+          = (dimensions_[i] + blockDimensions_[i] - 1) / blockDimensions_[i];
+      }
+    }
+
+    /// Number of blocks
+    inline SimplexId size() const {
+      return blockNumber_[0] * blockNumber_[1] * blockNumber_[2];
+    }
+
+    /// Call \p f on each vertex of the \p block-th block, x-fastest
+    template <typename Functor>
+    inline void forEach(const SimplexId block, const Functor &f) const {
+      const SimplexId bx = block % blockNumber_[0];
+      const SimplexId by = (block / blockNumber_[0]) % blockNumber_[1];
+      const SimplexId bz = block / (blockNumber_[0] * blockNumber_[1]);
+
+      const SimplexId x0 = bx * blockDimensions_[0];
+      const SimplexId y0 = by * blockDimensions_[1];
+      const SimplexId z0 = bz * blockDimensions_[2];
+      const SimplexId x1 = std::min(x0 + blockDimensions_[0], dimensions_[0]);
+      const SimplexId y1 = std::min(y0 + blockDimensions_[1], dimensions_[1]);
+      const SimplexId z1 = std::min(z0 + blockDimensions_[2], dimensions_[2]);
+
+      for(SimplexId z = z0; z < z1; ++z) {
+        for(SimplexId y = y0; y < y1; ++y) {
+          const SimplexId row = (z * dimensions_[1] + y) * dimensions_[0];
+          for(SimplexId v = row + x0; v < row + x1; ++v) {
+            f(v);
+          }
+        }
+      }
+    }
+
+  private:
+    std::array<SimplexId, 3> dimensions_{};
+    std::array<SimplexId, 3> blockDimensions_{};
+    std::array<SimplexId, 3> blockNumber_{};
+  };
+
+} // namespace ttk
@@ -19,6 +19,10 @@ namespace ttk {
   using SimplexId = int;
 #endif
 
+  /// \brief Compact identifier type, used to store identifiers whose range
+  /// fits in 32 bits when SimplexId is 64-bit wide (see FlatJaggedArray).
+  using ShortSimplexId = int;
+
   /// \brief Identifier type for threads (i.e. with OpenMP).
   using ThreadId = int;
 
@@ -2,31 +2,259 @@
 
 #include <Debug.h>
 
+#include <algorithm>
+#include <limits>
+#include <memory>
+
 namespace ttk {
   /**
    * @brief Replacement for std::vector<std::vector<SimplexId>>
    *
    * Use this when instead of a std::vector<std::vector<SimplexId>>
    * when the data is set once and not modified afterwards.
+   *
+   * The buffers can also live outside of the object (for instance in a
+   * memory-mapped file, see ExplicitTriangulation::readFromFile), in which
+   * case the array keeps a reference on their owner.
+   *
+   * When SimplexId is 64-bit wide, the internal buffers use 32-bit
+   * identifiers (ShortSimplexId) whenever their range allows it, hence
+   * large meshes do not overflow while small ones do not pay twice the
+   * memory. The accessors always return SimplexId values.
    */
   class FlatJaggedArray {
     // flattened sub-vectors data
     std::vector<SimplexId> data_;
     // offset for every sub-vector
     std::vector<SimplexId> offsets_;
+    // same with ShortSimplexId identifiers (used instead of data_ and
+    // offsets_ when every identifier fits, see setData)
+    std::vector<ShortSimplexId> shortData_;
+    std::vector<ShortSimplexId> shortOffsets_;
+    // owner of the external buffers (nullptr if internal buffers are used)
+    std::shared_ptr<const void> externalOwner_{};
+    // views on the buffers actually used (internal or external, only one
+    // pair is non-null)
+    const SimplexId *dataPtr_{};
+    const SimplexId *offsetsPtr_{};
+    const ShortSimplexId *shortDataPtr_{};
+    const ShortSimplexId *shortOffsetsPtr_{};
+    size_t dataSize_{};
+    size_t offsetsSize_{};
+
+    inline void bindInternalBuffers() {
+      this->externalOwner_.reset();
+      if(this->shortOffsets_.empty()) {
+        this->dataPtr_ = this->data_.data();
+        this->offsetsPtr_ = this->offsets_.data();
+        this->shortDataPtr_ = nullptr;
+        this->shortOffsetsPtr_ = nullptr;
+        this->dataSize_ = this->data_.size();
+        this->offsetsSize_ = this->offsets_.size();
+      } else {
+        this->dataPtr_ = nullptr;
+        this->offsetsPtr_ = nullptr;
+        this->shortDataPtr_ = this->shortData_.data();
+        this->shortOffsetsPtr_ = this->shortOffsets_.data();
+        this->dataSize_ = this->shortData_.size();
+        this->offsetsSize_ = this->shortOffsets_.size();
+      }
+    }
+
+    inline void bindBuffers(const FlatJaggedArray &other) {
+      if(other.externalOwner_ != nullptr) {
+        this->externalOwner_ = other.externalOwner_;
+        this->dataPtr_ = other.dataPtr_;
+        this->offsetsPtr_ = other.offsetsPtr_;
+        this->shortDataPtr_ = other.shortDataPtr_;
+        this->shortOffsetsPtr_ = other.shortOffsetsPtr_;
+        this->dataSize_ = other.dataSize_;
+        this->offsetsSize_ = other.offsetsSize_;
+      } else {
+        this->bindInternalBuffers();
+      }
+    }
+
+    inline void clearInternalBuffers() {
+      this->data_.clear();
+      this->offsets_.clear();
+      this->shortData_.clear();
+      this->shortOffsets_.clear();
+    }
+
+    // raw accesses to the buffers in use (the ShortSimplexId buffers are
+    // only used with 64-bit SimplexId, see shortenIds)
+    inline SimplexId offsetAt(const size_t i) const {
+#ifdef TTK_ENABLE_64BIT_IDS
+      if(this->shortOffsetsPtr_ != nullptr) {
+        return this->shortOffsetsPtr_[i];
+      }
+#endif // TTK_ENABLE_64BIT_IDS
+      return this->offsetsPtr_[i];
+    }
+    inline SimplexId dataAt(const size_t i) const {
+#ifdef TTK_ENABLE_64BIT_IDS
+      if(this->shortDataPtr_ != nullptr) {
+        return this->shortDataPtr_[i];
+      }
+#endif // TTK_ENABLE_64BIT_IDS
+      return this->dataPtr_[i];
+    }
+
+    /**
+     * @brief Move data_ and offsets_ to shortData_ and shortOffsets_ if
+     * every identifier fits in a ShortSimplexId
+     *
+     * Nothing is done when SimplexId is 32-bit wide.
+     */
+    void shortenIds(const int threadNumber) {
+#ifdef TTK_ENABLE_64BIT_IDS
+      static_assert(sizeof(ShortSimplexId) < sizeof(SimplexId),
+                    "ShortSimplexId should be narrower than SimplexId");
+      if(this->offsets_.empty()) {
+        return;
+      }
+
+      const SimplexId lowest = std::numeric_limits<ShortSimplexId>::min();
+      const SimplexId highest = std::numeric_limits<ShortSimplexId>::max();
+      if(this->offsets_.back() > highest) {
+        return;
+      }
+      SimplexId minId{}, maxId{};
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber) \
+  reduction(min : minId) reduction(max : maxId)
+#endif // TTK_ENABLE_OPENMP
+      for(size_t i = 0; i < this->data_.size(); ++i) {
+        minId = std::min(minId, this->data_[i]);
+        maxId = std::max(maxId, this->data_[i]);
+      }
+      if(minId < lowest || maxId > highest) {
+        return;
+      }
+
+      this->shortOffsets_.assign(
+        this->offsets_.begin(), this->offsets_.end());
+      std::vector<SimplexId>{}.swap(this->offsets_);
+      this->shortData_.resize(this->data_.size());
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber)
+#endif // TTK_ENABLE_OPENMP
+      for(size_t i = 0; i < this->data_.size(); ++i) {
+        this->shortData_[i] = this->data_[i];
+      }
+      std::vector<SimplexId>{}.swap(this->data_);
+#else
+      (void)threadNumber;
+#endif // TTK_ENABLE_64BIT_IDS
+    }
 
   public:
     // ############## //
     // Initialization //
     // ############## //
 
+    FlatJaggedArray() = default;
+    FlatJaggedArray(const FlatJaggedArray &other)
+      : data_{other.data_}, offsets_{other.offsets_},
+        shortData_{other.shortData_}, shortOffsets_{other.shortOffsets_} {
+      this->bindBuffers(other);
+    }
+    FlatJaggedArray(FlatJaggedArray &&other) noexcept
+      : data_{std::move(other.data_)}, offsets_{std::move(other.offsets_)},
+        shortData_{std::move(other.shortData_)},
+        shortOffsets_{std::move(other.shortOffsets_)} {
+      this->bindBuffers(other);
+      other.clearInternalBuffers();
+      other.bindInternalBuffers();
+    }
+    FlatJaggedArray &operator=(const FlatJaggedArray &other) {
+      if(this != &other) {
+        this->data_ = other.data_;
+        this->offsets_ = other.offsets_;
+        this->shortData_ = other.shortData_;
+        this->shortOffsets_ = other.shortOffsets_;
+        this->bindBuffers(other);
+      }
+      return *this;
+    }
+    FlatJaggedArray &operator=(FlatJaggedArray &&other) noexcept {
+      if(this != &other) {
+        this->data_ = std::move(other.data_);
+        this->offsets_ = std::move(other.offsets_);
+        this->shortData_ = std::move(other.shortData_);
+        this->shortOffsets_ = std::move(other.shortOffsets_);
+        this->bindBuffers(other);
+        other.clearInternalBuffers();
+        other.bindInternalBuffers();
+      }
+      return *this;
+    }
+
     /**
      * @brief Set internal data from pre-existing vectors
+     *
+     * When SimplexId is 64-bit wide, the identifiers are stored on 32 bits
+     * if they all fit (unless @p allowShortIds is false), halving the
+     * memory footprint of the array.
      */
     inline void setData(std::vector<SimplexId> &&data,
-                        std::vector<SimplexId> &&offsets) {
+                        std::vector<SimplexId> &&offsets,
+                        const int threadNumber = 1,
+                        const bool allowShortIds = true) {
+      this->clearInternalBuffers();
       this->data_ = std::move(data);
       this->offsets_ = std::move(offsets);
+      if(allowShortIds) {
+        this->shortenIds(threadNumber);
+      }
+      this->bindInternalBuffers();
+    }
+
+    /**
+     * @brief Use external buffers without copying them
+     *
+     * @param data Flattened sub-vectors data (\p dataSize items)
+     * @param offsets Sub-vectors offsets (\p offsetsSize items)
+     * @param owner Keeps the buffers alive as long as they are used
+     */
+    inline void setExternalData(const SimplexId *const data,
+                                const size_t dataSize,
+                                const SimplexId *const offsets,
+                                const size_t offsetsSize,
+                                std::shared_ptr<const void> owner) {
+      this->data_ = {};
+      this->offsets_ = {};
+      this->shortData_ = {};
+      this->shortOffsets_ = {};
+      this->externalOwner_ = std::move(owner);
+      this->dataPtr_ = data;
+      this->offsetsPtr_ = offsets;
+      this->shortDataPtr_ = nullptr;
+      this->shortOffsetsPtr_ = nullptr;
+      this->dataSize_ = dataSize;
+      this->offsetsSize_ = offsetsSize;
+    }
+
+    /**
+     * @brief If the buffers are not owned by this object
+     */
+    inline bool isExternal() const {
+      return this->externalOwner_ != nullptr;
+    }
+
+    /**
+     * @brief If the identifiers are stored as ShortSimplexId
+     *
+     * In that case, get_ptr() and offset_ptr() return nullptr: use
+     * get_short_ptr() and short_offset_ptr() instead.
+     */
+    inline bool hasShortIds() const {
+#ifdef TTK_ENABLE_64BIT_IDS
+      return this->shortOffsetsPtr_ != nullptr;
+#else
+      return false;
+#endif // TTK_ENABLE_64BIT_IDS
     }
 
     // ############################## //
@@ -38,11 +266,11 @@ namespace ttk {
      */
     inline SimplexId size(SimplexId id) const {
 #ifndef TTK_ENABLE_KAMIKAZE
-      if(id < 0 || id > (SimplexId)offsets_.size() - 1) {
+      if(id < 0 || id > (SimplexId)offsetsSize_ - 1) {
         return -1;
       }
 #endif
-      return this->offsets_[id + 1] - this->offsets_[id];
+      return this->offsetAt(id + 1) - this->offsetAt(id);
     }
 
     /**
@@ -50,11 +278,11 @@ namespace ttk {
      */
     inline SimplexId offset(SimplexId id) const {
 #ifndef TTK_ENABLE_KAMIKAZE
-      if(id < 0 || id > (SimplexId)offsets_.size()) {
+      if(id < 0 || id > (SimplexId)offsetsSize_) {
         return -1;
       }
 #endif
-      return this->offsets_[id];
+      return this->offsetAt(id);
     }
 
     /**
@@ -62,64 +290,103 @@ namespace ttk {
      */
     inline SimplexId get(SimplexId id, SimplexId local) const {
 #ifndef TTK_ENABLE_KAMIKAZE
-      if(id < 0 || id > (SimplexId)offsets_.size() - 1) {
+      if(id < 0 || id > (SimplexId)offsetsSize_ - 1) {
         return -1;
       }
       if(local < 0 || local >= this->size(id)) {
         return -2;
       }
 #endif
-      return this->data_[this->offsets_[id] + local];
+      return this->dataAt(this->offsetAt(id) + local);
     }
 
     /**
      * @brief Returns a const pointer to the data inside the sub-vectors
+     *
+     * Returns nullptr if the identifiers are stored as ShortSimplexId.
      */
     inline const SimplexId *get_ptr(SimplexId id, SimplexId local) const {
 #ifndef TTK_ENABLE_KAMIKAZE
-      if(id < 0 || id > (SimplexId)offsets_.size() - 1) {
+      if(id < 0 || id > (SimplexId)offsetsSize_ - 1) {
         return {};
       }
       if(local < 0 || local >= this->size(id)) {
         return {};
       }
 #endif
-      return &this->data_[this->offsets_[id] + local];
+      if(this->dataPtr_ == nullptr) {
+        return {};
+      }
+      return &this->dataPtr_[this->offsetsPtr_[id] + local];
     }
 
     /**
      * @brief Returns a const pointer to the offset member
+     *
+     * Returns nullptr if the identifiers are stored as ShortSimplexId.
      */
     inline const SimplexId *offset_ptr() const {
-      return offsets_.data();
+      return offsetsPtr_;
+    }
+
+    /**
+     * @brief Same as get_ptr() when the identifiers are stored as
+     * ShortSimplexId (returns nullptr otherwise)
+     */
+    inline const ShortSimplexId *get_short_ptr(SimplexId id,
+                                               SimplexId local) const {
+#ifndef TTK_ENABLE_KAMIKAZE
+      if(id < 0 || id > (SimplexId)offsetsSize_ - 1) {
+        return {};
+      }
+      if(local < 0 || local >= this->size(id)) {
+        return {};
+      }
+#endif
+      if(this->shortDataPtr_ == nullptr) {
+        return {};
+      }
+      return &this->shortDataPtr_[this->shortOffsetsPtr_[id] + local];
+    }
+
+    /**
+     * @brief Same as offset_ptr() when the identifiers are stored as
+     * ShortSimplexId (returns nullptr otherwise)
+     */
+    inline const ShortSimplexId *short_offset_ptr() const {
+      return shortOffsetsPtr_;
     }
 
     /**
      * @brief Returns the number of sub-vectors
      */
     inline size_t subvectorsNumber() const {
-      return this->offsets_.size() - 1;
+      return this->offsetsSize_ - 1;
     }
 
     /**
      * @brief Returns the size of the data_ member
      */
     inline size_t dataSize() const {
-      return this->data_.size();
+      return this->dataSize_;
     }
 
     /**
      * @brief If the underlying buffers are empty
      */
     inline bool empty() const {
-      return this->data_.empty() || this->offsets_.empty();
+      return this->dataSize_ == 0 || this->offsetsSize_ == 0;
     }
 
     /**
      * @brief Computes the memory footprint of the array
+     *
+     * External buffers are not accounted for.
      */
     inline std::size_t footprint() const {
-      return (this->data_.size() + this->offsets_.size()) * sizeof(SimplexId);
+      return (this->data_.size() + this->offsets_.size()) * sizeof(SimplexId)
+             + (this->shortData_.size() + this->shortOffsets_.size())
+                 * sizeof(ShortSimplexId);
     }
 
     // #################### //
@@ -132,7 +399,10 @@ namespace ttk {
      * Templated to also accept Boost small_vectors.
      */
     template <typename T>
-    void fillFrom(const std::vector<T> &src, int threadNumber = 1) {
+    void fillFrom(const std::vector<T> &src,
+                  int threadNumber = 1,
+                  const bool allowShortIds = true) {
+      this->clearInternalBuffers();
       this->offsets_.resize(src.size() + 1);
       for(size_t i = 0; i < src.size(); ++i) {
         this->offsets_[i + 1] = this->offsets_[i] + src[i].size();
@@ -146,6 +416,10 @@ namespace ttk {
           this->data_[this->offsets_[i] + j] = src[i][j];
         }
       }
+      if(allowShortIds) {
+        this->shortenIds(threadNumber);
+      }
+      this->bindInternalBuffers();
     }
 
     /**
@@ -4,6 +4,10 @@
 #include <Debug.h>
 
 #include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
 #include <vector>
 
 #if defined(__GNUC__) && !defined(__clang__)
@@ -12,61 +16,286 @@
 
 namespace ttk {
 
+#if defined(_GLIBCXX_PARALLEL_FEATURES_H) && defined(TTK_ENABLE_OPENMP)
+#define PSORT(NTHREADS)          \
+  omp_set_num_threads(NTHREADS); \
+  __gnu_parallel::sort
+#else
+#define PSORT(NTHREADS) std::sort
+#endif // _GLIBCXX_PARALLEL_FEATURES_H && TTK_ENABLE_OPENMP
+
+  namespace detail {
+
+    /**
+     * @brief If values of type @p T can be sorted with radixSortVertices
+     */
+    template <typename T>
+    struct IsRadixSortable
+      : std::integral_constant<bool,
+                               std::is_arithmetic<T>::value
+                                 && !std::is_same<T, bool>::value
+                                 && sizeof(T) <= sizeof(uint64_t)> {};
+
+    /**
+     * @brief Unsigned integer type holding the radix key of a @p T value
+     */
+    template <typename T>
+    struct RadixKey {
+      using type = typename std::
+        conditional<sizeof(T) <= sizeof(uint32_t), uint32_t, uint64_t>::type;
+    };
+
+    /**
+     * @brief Map an integral value to an unsigned key with the same order
+     * (the sign bit is flipped)
+     */
+    template <typename T>
+    inline typename std::enable_if<std::is_integral<T>::value,
+                                   typename RadixKey<T>::type>::type
+      radixKey(const T value) {
+      using unsignedType = typename std::make_unsigned<T>::type;
+      const auto u = static_cast<unsignedType>(value);
+      if(std::is_signed<T>::value) {
+        return static_cast<unsignedType>(
+          u ^ (unsignedType(1) << (8 * sizeof(T) - 1)));
+      }
+      return u;
+    }
+
+    /**
+     * @brief Map a floating-point value to an unsigned key with the same
+     * order (negative values have all their bits flipped, positive ones
+     * only their sign bit)
+     */
+    template <typename T>
+    inline typename std::enable_if<std::is_floating_point<T>::value,
+                                   typename RadixKey<T>::type>::type
+      radixKey(T value) {
+      using keyType = typename RadixKey<T>::type;
+      static_assert(sizeof(T) == sizeof(keyType), "Unsupported float type");
+      if(value == 0) {
+        // -0.0 and +0.0 compare equal
+        value = 0;
+      }
+      keyType bits{};
+      std::memcpy(&bits, &value, sizeof(T));
+      const keyType sign = keyType(1) << (8 * sizeof(T) - 1);
+      return (bits & sign) ? ~bits : (bits | sign);
+    }
+
+    /**
+     * @brief Stable parallel LSD radix sort of @p ids according to @p keys
+     *
+     * Sorts 8 bits per pass; passes on which every key share the same
+     * digit are skipped. @p keysTmp and @p idsTmp are used as double
+     * buffers.
+     */
+    template <typename keyType, typename sortIdType>
+    void radixSortByKeys(std::vector<keyType> &keys,
+                         std::vector<sortIdType> &ids,
+                         std::vector<keyType> &keysTmp,
+                         std::vector<sortIdType> &idsTmp,
+                         const int nThreads) {
+
+      static const size_t nBuckets{256};
+      const size_t n = keys.size();
+      const size_t nChunks = std::max(nThreads, 1);
+      const size_t chunkSize = (n + nChunks - 1) / nChunks;
+      std::vector<size_t> histograms(nChunks * nBuckets);
+      keysTmp.resize(n);
+      idsTmp.resize(n);
+
+      for(size_t shift = 0; shift < 8 * sizeof(keyType); shift += 8) {
+
+        std::fill(histograms.begin(), histograms.end(), 0);
+
+        // 1. per-chunk digit histograms
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(nThreads) schedule(static, 1)
+#endif // TTK_ENABLE_OPENMP
+        for(size_t c = 0; c < nChunks; ++c) {
+          auto hist = &histograms[c * nBuckets];
+          const size_t end = std::min(n, (c + 1) * chunkSize);
+          for(size_t i = c * chunkSize; i < end; ++i) {
+            hist[(keys[i] >> shift) & (nBuckets - 1)]++;
+          }
+        }
+
+        // 2. exclusive prefix sum, digit-major then chunk-major to keep
+        // the sort stable
+        size_t sum{};
+        bool trivialPass{false};
+        for(size_t d = 0; d < nBuckets; ++d) {
+          const size_t bucketStart = sum;
+          for(size_t c = 0; c < nChunks; ++c) {
+            const size_t count = histograms[c * nBuckets + d];
+            histograms[c * nBuckets + d] = sum;
+            sum += count;
+          }
+          if(sum - bucketStart == n) {
+            trivialPass = true;
+            break;
+          }
+        }
+        if(trivialPass) {
+          continue;
+        }
+
+        // 3. scatter
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(nThreads) schedule(static, 1)
+#endif // TTK_ENABLE_OPENMP
+        for(size_t c = 0; c < nChunks; ++c) {
+          auto pos = &histograms[c * nBuckets];
+          const size_t end = std::min(n, (c + 1) * chunkSize);
+          for(size_t i = c * chunkSize; i < end; ++i) {
+            const size_t dst = pos[(keys[i] >> shift) & (nBuckets - 1)]++;
+            keysTmp[dst] = keys[i];
+            idsTmp[dst] = ids[i];
+          }
+        }
+
+        keys.swap(keysTmp);
+        ids.swap(idsTmp);
+      }
+    }
+
+    /**
+     * @brief Sort @p sortedVertices (initialized with the identity) with a
+     * LSD radix sort on (scalars, offsets) keys
+     */
+    template <typename sortIdType, typename scalarType, typename idType>
+    void sortVerticesIds(std::vector<sortIdType> &sortedVertices,
+                         const scalarType *const scalars,
+                         const idType *const offsets,
+                         const int nThreads,
+                         std::true_type /* radix sortable */) {
+
+      const size_t nVerts = sortedVertices.size();
+      std::vector<sortIdType> idsTmp{};
+
+      // least significant key first: offsets (if any, vertex identifiers
+      // otherwise, which is the initial order of sortedVertices)
+      if(offsets != nullptr) {
+        using keyType = typename RadixKey<idType>::type;
+        std::vector<keyType> keys(nVerts), keysTmp{};
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(nThreads)
+#endif // TTK_ENABLE_OPENMP
+        for(size_t i = 0; i < nVerts; ++i) {
+          keys[i] = radixKey(offsets[i]);
+        }
+        radixSortByKeys(keys, sortedVertices, keysTmp, idsTmp, nThreads);
+      }
+
+      // then scalars
+      using keyType = typename RadixKey<scalarType>::type;
+      std::vector<keyType> keys(nVerts), keysTmp{};
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(nThreads)
+#endif // TTK_ENABLE_OPENMP
+      for(size_t i = 0; i < nVerts; ++i) {
+        keys[i] = radixKey(scalars[sortedVertices[i]]);
+      }
+      radixSortByKeys(keys, sortedVertices, keysTmp, idsTmp, nThreads);
+    }
+
+    /**
+     * @brief Sort @p sortedVertices (initialized with the identity) with a
+     * comparison sort on (scalars, offsets)
+     */
+    template <typename sortIdType, typename scalarType, typename idType>
+    void sortVerticesIds(std::vector<sortIdType> &sortedVertices,
+                         const scalarType *const scalars,
+                         const idType *const offsets,
+                         const int nThreads,
+                         std::false_type /* radix sortable */) {
+      if(offsets != nullptr) {
+        PSORT(nThreads)
+        (sortedVertices.begin(), sortedVertices.end(),
+         [&](const sortIdType a, const sortIdType b) {
+           return (scalars[a] < scalars[b])
+                  || (scalars[a] == scalars[b] && offsets[a] < offsets[b]);
+         });
+      } else {
+        PSORT(nThreads)
+        (sortedVertices.begin(), sortedVertices.end(),
+         [&](const sortIdType a, const sortIdType b) {
+           return (scalars[a] < scalars[b])
+                  || (scalars[a] == scalars[b] && a < b);
+         });
+      }
+    }
+
+    /**
+     * @brief Sort vertices using a buffer of @p sortIdType identifiers
+     *
+     * See ttk::sortVertices.
+     */
+    template <typename sortIdType,
+              typename scalarType,
+              typename idType,
+              typename orderType>
+    void sortVerticesWithIds(const size_t nVerts,
+                             const scalarType *const scalars,
+                             const idType *const offsets,
+                             orderType *const order,
+                             const int nThreads) {
+
+      // array of pre-sorted vertices
+      std::vector<sortIdType> sortedVertices(nVerts);
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(nThreads)
+#endif // TTK_ENABLE_OPENMP
+      for(size_t i = 0; i < sortedVertices.size(); ++i) {
+        sortedVertices[i] = i;
+      }
+
+      sortVerticesIds(
+        sortedVertices, scalars, offsets, nThreads,
+        std::integral_constant<bool, IsRadixSortable<scalarType>::value
+                                       && IsRadixSortable<idType>::value>{});
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(nThreads)
+#endif // TTK_ENABLE_OPENMP
+      for(size_t i = 0; i < sortedVertices.size(); ++i) {
+        order[sortedVertices[i]] = i;
+      }
+    }
+  } // namespace detail
+
   /**
    * @brief Sort vertices according to scalars disambiguated by offsets
    *
+   * Arithmetic scalars and offsets are sorted with a parallel LSD radix
+   * sort (independent of the compiler), other types fall back to a
+   * comparison sort. The intermediate buffer of sorted vertices uses
+   * 32-bit identifiers (ShortSimplexId) when @p nVerts allows it, even if
+   * SimplexId is 64-bit wide.
+   *
    * @param[in] nVerts number of vertices
    * @param[in] scalars array of size nVerts, main vertex comparator
    * @param[in] offsets array of size nVerts, disambiguate scalars on plateaux
    * @param[out] order array of size nVerts, computed order of vertices
+   * (SimplexId or ShortSimplexId if nVerts fits)
    * @param[in] nThreads number of parallel threads
    */
-  template <typename scalarType, typename idType>
+  template <typename scalarType, typename idType, typename orderType>
   void sortVertices(const size_t nVerts,
                     const scalarType *const scalars,
                     const idType *const offsets,
-                    SimplexId *const order,
+                    orderType *const order,
                     const int nThreads) {
-
-    // array of pre-sorted vertices
-    std::vector<SimplexId> sortedVertices(nVerts);
-
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp parallel for num_threads(nThreads)
-#endif // TTK_ENABLE_OPENMP
-    for(size_t i = 0; i < sortedVertices.size(); ++i) {
-      sortedVertices[i] = i;
-    }
-
-#if defined(_GLIBCXX_PARALLEL_FEATURES_H) && defined(TTK_ENABLE_OPENMP)
-#define PSORT(NTHREADS)          \
-  omp_set_num_threads(NTHREADS); \
-  __gnu_parallel::sort
-#else
-#define PSORT(NTHREADS) std::sort
-#endif // _GLIBCXX_PARALLEL_FEATURES_H && TTK_ENABLE_OPENMP
-
-    if(offsets != nullptr) {
-      PSORT(nThreads)
-      (sortedVertices.begin(), sortedVertices.end(),
-       [&](const SimplexId a, const SimplexId b) {
-         return (scalars[a] < scalars[b])
-                || (scalars[a] == scalars[b] && offsets[a] < offsets[b]);
-       });
+    if(sizeof(ShortSimplexId) < sizeof(SimplexId)
+       && nVerts <= static_cast<size_t>(
+            std::numeric_limits<ShortSimplexId>::max())) {
+      detail::sortVerticesWithIds<ShortSimplexId>(
+        nVerts, scalars, offsets, order, nThreads);
     } else {
-      PSORT(nThreads)
-      (sortedVertices.begin(), sortedVertices.end(),
-       [&](const SimplexId a, const SimplexId b) {
-         return (scalars[a] < scalars[b])
-                || (scalars[a] == scalars[b] && a < b);
-       });
-    }
-
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp parallel for num_threads(nThreads)
-#endif // TTK_ENABLE_OPENMP
-    for(size_t i = 0; i < sortedVertices.size(); ++i) {
-      order[sortedVertices[i]] = i;
+      detail::sortVerticesWithIds<SimplexId>(
+        nVerts, scalars, offsets, order, nThreads);
     }
   }
 
@@ -76,12 +305,13 @@ namespace ttk {
    * @param[in] nVerts number of vertices
    * @param[in] scalars pointer to scalar field buffer of size @p nVerts
    * @param[out] order pointer to pre-allocated order buffer of size @p nVerts
+   * (SimplexId or ShortSimplexId if @p nVerts fits)
    * @param[in] nThreads number of threads to be used
    */
-  template <typename scalarType>
+  template <typename scalarType, typename orderType>
   inline void preconditionOrderArray(const size_t nVerts,
                                      const scalarType *const scalars,
-                                     SimplexId *const order,
+                                     orderType *const order,
                                      const int nThreads
                                      = ttk::globalThreadNumber_) {
     ttk::sortVertices(
@@ -0,0 +1,1693 @@
+#include <CompactTriangulation.h>
+#include <OpenMPLock.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+
+using namespace ttk;
+
+namespace {
+
+  // spread the 21 lowest bits of x (two zero bits between each of them)
+  inline uint64_t spreadBits(uint64_t x) {
+    x &= 0x1fffff;
+    x = (x | x << 32) & 0x1f00000000ffff;
+    x = (x | x << 16) & 0x1f0000ff0000ff;
+    x = (x | x << 8) & 0x100f00f00f00f00f;
+    x = (x | x << 4) & 0x10c30c30c30c30c3;
+    x = (x | x << 2) & 0x1249249249249249;
+    return x;
+  }
+
+  // fill a FlatJaggedArray from a function appending the items of each
+  // sub-vector
+  template <typename Fill>
+  void fillJagged(const SimplexId number, FlatJaggedArray &array, Fill fill) {
+    std::vector<SimplexId> data{}, offsets(number + 1);
+    for(SimplexId i = 0; i < number; ++i) {
+      offsets[i] = data.size();
+      fill(i, data);
+    }
+    offsets[number] = data.size();
+    data.shrink_to_fit();
+    array.setData(std::move(data), std::move(offsets));
+  }
+
+  inline void sortUnique(std::vector<SimplexId> &vec, const size_t begin) {
+    std::sort(vec.begin() + begin, vec.end());
+    vec.erase(std::unique(vec.begin() + begin, vec.end()), vec.end());
+  }
+
+  // The owned edges and triangles of a cluster may be stored as
+  // ShortSimplexId (see FlatJaggedArray::hasShortIds()), the following
+  // functions take both storages.
+
+  // position of v among the nb sorted items at ids, -1 if absent
+  template <typename IdType>
+  SimplexId findSorted(const IdType *const ids,
+                       const SimplexId nb,
+                       const SimplexId v) {
+    const auto pos = std::lower_bound(ids, ids + nb, v) - ids;
+    if(pos == nb || ids[pos] != v) {
+      return -1;
+    }
+    return pos;
+  }
+
+  // position of (v0, v1) among the nb sorted pairs at pairs, -1 if absent
+  template <typename IdType>
+  SimplexId findSortedPair(const IdType *const pairs,
+                           const SimplexId nb,
+                           const SimplexId v0,
+                           const SimplexId v1) {
+    SimplexId first = 0, count = nb;
+    while(count > 0) {
+      const SimplexId step = count / 2;
+      const IdType *const p = pairs + 2 * (first + step);
+      if(p[0] < v0 || (p[0] == v0 && p[1] < v1)) {
+        first += step + 1;
+        count -= step + 1;
+      } else {
+        count = step;
+      }
+    }
+    if(first == nb || pairs[2 * first] != v0 || pairs[2 * first + 1] != v1) {
+      return -1;
+    }
+    return first;
+  }
+
+  // sub-vector holding the item at the given position of the data, among
+  // the first nb sub-vectors of the given offsets
+  template <typename IdType>
+  SimplexId findSubvector(const IdType *const offsets,
+                          const SimplexId nb,
+                          const SimplexId item) {
+    return std::upper_bound(offsets, offsets + nb + 1, item) - offsets - 1;
+  }
+
+  inline SimplexId findSubvector(const FlatJaggedArray &array,
+                                 const SimplexId nb,
+                                 const SimplexId item) {
+    return array.hasShortIds()
+             ? findSubvector(array.short_offset_ptr(), nb, item)
+             : findSubvector(array.offset_ptr(), nb, item);
+  }
+
+} // namespace
+
+struct CompactTriangulation::Cluster {
+  SimplexId id{};
+  // sorted star of each vertex of the cluster
+  FlatJaggedArray vertexStars{};
+  // sorted higher neighbors of each vertex of the cluster (owned edges)
+  FlatJaggedArray edges{};
+  // sorted pairs of higher vertices of each vertex of the cluster, one
+  // after the other (owned triangles)
+  FlatJaggedArray triangles{};
+  // sorted owned cells
+  std::vector<SimplexId> cells{};
+
+  // relations computed on demand, per owned simplex
+  std::array<FlatJaggedArray, BOUNDARY_VERTICES> relations{};
+  std::vector<bool> boundaryVertices{}, boundaryEdges{}, boundaryTriangles{};
+
+  // bit mask of the built relations
+  std::atomic<unsigned> built{0};
+  // serializes the relation computations
+  Lock lock{};
+
+  inline size_t footprint() const {
+    size_t size = sizeof(*this) + vertexStars.footprint() + edges.footprint()
+                  + triangles.footprint() + cells.size() * sizeof(SimplexId)
+                  + (boundaryVertices.size() + boundaryEdges.size()
+                     + boundaryTriangles.size())
+                      / 8;
+    for(const auto &relation : relations) {
+      size += relation.footprint();
+    }
+    return size;
+  }
+};
+
+struct CompactTriangulation::ClusterCache {
+  struct Slot {
+    // protects cluster
+    Lock lock{};
+    std::shared_ptr<Cluster> cluster{};
+    // footprint accounted for in the cache (protected by the cache lock)
+    size_t footprint{};
+    // logical time (number of builds) of the last access
+    std::atomic<size_t> lastUse{0};
+  };
+
+  // one slot per cluster: cache hits only lock their own slot
+  std::vector<Slot> slots;
+  // incremented on cluster and relation builds only, to keep the hits
+  // free of shared writes
+  std::atomic<size_t> clock{0};
+  // protects the footprints and serializes the evictions
+  Lock lock{};
+  size_t footprint{};
+
+  explicit ClusterCache(const SimplexId clusterNumber) : slots(clusterNumber) {
+  }
+
+  inline std::shared_ptr<Cluster> get(const SimplexId clusterId) {
+    auto &slot = this->slots[clusterId];
+    const auto now = this->clock.load(std::memory_order_relaxed);
+    if(slot.lastUse.load(std::memory_order_relaxed) != now) {
+      slot.lastUse.store(now, std::memory_order_relaxed);
+    }
+    slot.lock.lock();
+    auto cluster = slot.cluster;
+    slot.lock.unlock();
+    return cluster;
+  }
+
+  // evict the least recently used clusters not currently in use
+  // (call with the lock held)
+  //
+  // The clusters accessed since the last build are kept even if the budget
+  // is exceeded: evicting them would rebuild a cluster on every query once
+  // the budget is smaller than a few clusters.
+  inline void evict(const size_t budget) {
+    if(this->footprint <= budget) {
+      return;
+    }
+    const auto now = this->clock.load(std::memory_order_relaxed);
+    std::vector<std::pair<size_t, SimplexId>> candidates{};
+    for(size_t i = 0; i < this->slots.size(); ++i) {
+      const auto lastUse
+        = this->slots[i].lastUse.load(std::memory_order_relaxed);
+      if(this->slots[i].footprint > 0 && lastUse != now) {
+        candidates.emplace_back(lastUse, i);
+      }
+    }
+    std::sort(candidates.begin(), candidates.end());
+    for(const auto &candidate : candidates) {
+      if(this->footprint <= budget) {
+        break;
+      }
+      auto &slot = this->slots[candidate.second];
+      slot.lock.lock();
+      // the cache holds the only reference of the clusters not in use
+      if(slot.cluster.use_count() == 1) {
+        slot.cluster.reset();
+        this->footprint -= slot.footprint;
+        slot.footprint = 0;
+      }
+      slot.lock.unlock();
+    }
+  }
+};
+
+CompactTriangulation::CompactTriangulation() {
+
+  setDebugMsgPrefix("CompactTriangulation");
+
+  clear();
+}
+
+CompactTriangulation::~CompactTriangulation() {
+}
+
+int CompactTriangulation::clear() {
+  vertexNumber_ = 0;
+  cellNumber_ = 0;
+  doublePrecision_ = false;
+  pointSet_ = nullptr;
+  maxCellDim_ = -1;
+
+  resetClusters();
+
+  printMsg("Triangulation cleared.", debug::Priority::DETAIL);
+
+  return 0;
+}
+
+void CompactTriangulation::resetClusters() {
+  edgeNumber_ = 0;
+  triangleNumber_ = 0;
+
+  vertexCluster_ = {};
+  clusterVertices_ = {};
+  clusterCells_ = {};
+  clusterEdgeOffsets_ = {};
+  clusterTriangleOffsets_ = {};
+  cache_.reset();
+
+  AbstractTriangulation::clear();
+}
+
+size_t CompactTriangulation::footprint(size_t size, const bool quiet) const {
+
+  // no report if quiet
+  const auto name = [quiet](const char *tableName) {
+    return quiet ? "" : tableName;
+  };
+
+  const auto printArrayFootprint
+    = [this, quiet](const FlatJaggedArray &array, const std::string &label) {
+        if(!quiet && !array.empty() && !label.empty()) {
+          this->printMsg(label + std::string{": "}
+                         + std::to_string(array.footprint()) + " bytes");
+        }
+        return array.footprint();
+      };
+
+  size += tableFootprint(vertexCluster_, name("vertexCluster_"));
+  size += printArrayFootprint(clusterVertices_, "clusterVertices_");
+  size += printArrayFootprint(clusterCells_, "clusterCells_");
+  size += tableFootprint(clusterEdgeOffsets_, name("clusterEdgeOffsets_"));
+  size += tableFootprint(
+    clusterTriangleOffsets_, name("clusterTriangleOffsets_"));
+
+  const auto cacheSize = getCacheFootprint();
+  if(!quiet && cacheSize) {
+    this->printMsg("cache: " + std::to_string(cacheSize) + " bytes");
+  }
+  size += cacheSize;
+
+  return AbstractTriangulation::footprint(size, quiet);
+}
+
+size_t CompactTriangulation::getCacheFootprint() const {
+  if(!cache_) {
+    return 0;
+  }
+  cache_->lock.lock();
+  const auto size = cache_->footprint;
+  cache_->lock.unlock();
+  return size;
+}
+
+int CompactTriangulation::setMemoryBudget(const size_t &memoryBudget) {
+  memoryBudget_ = memoryBudget;
+  if(cache_) {
+    cache_->lock.lock();
+    cache_->evict(memoryBudget_);
+    cache_->lock.unlock();
+  }
+  return 0;
+}
+
+int CompactTriangulation::getCellVertices(
+  const SimplexId cellId, std::array<SimplexId, 4> &vertices) const {
+  const SimplexId nbVerts = cellArray_->getCellVertexNumber(cellId);
+  for(SimplexId i = 0; i < nbVerts; ++i) {
+    vertices[i] = cellArray_->getCellVertex(cellId, i);
+  }
+  return nbVerts;
+}
+
+int CompactTriangulation::buildClusters() {
+
+  if(this->cellArray_ == nullptr || this->vertexNumber_ == 0) {
+    this->printErr("Empty dataset, precondition skipped");
+    return 1;
+  }
+
+  if(!clusterEdgeOffsets_.empty()) {
+    return 0;
+  }
+
+  Timer tm{};
+
+  printMsg("Building clusters", 0, 0, threadNumber_,
+           ttk::debug::LineMode::REPLACE);
+
+  // 1. sort the vertices along a Morton curve of the bounding box and cut
+  // this order into clusters of clusterSize_ vertices
+  std::array<float, 3> lower{}, upper{};
+  getVertexPoint(0, lower[0], lower[1], lower[2]);
+  upper = lower;
+  for(SimplexId i = 1; i < vertexNumber_; ++i) {
+    std::array<float, 3> p{};
+    getVertexPoint(i, p[0], p[1], p[2]);
+    for(int j = 0; j < 3; ++j) {
+      lower[j] = std::min(lower[j], p[j]);
+      upper[j] = std::max(upper[j], p[j]);
+    }
+  }
+
+  std::array<float, 3> scale{};
+  for(int j = 0; j < 3; ++j) {
+    scale[j] = upper[j] > lower[j] ? 2097151.0f / (upper[j] - lower[j]) : 0.0f;
+  }
+
+  std::vector<std::pair<uint64_t, SimplexId>> codes(vertexNumber_);
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif // TTK_ENABLE_OPENMP
+  for(SimplexId i = 0; i < vertexNumber_; ++i) {
+    std::array<float, 3> p{};
+    getVertexPoint(i, p[0], p[1], p[2]);
+    uint64_t code = 0;
+    for(int j = 0; j < 3; ++j) {
+      const auto q
+        = std::min(static_cast<uint64_t>((p[j] - lower[j]) * scale[j]),
+                   uint64_t{0x1fffff});
+      code |= spreadBits(q) << j;
+    }
+    codes[i] = {code, i};
+  }
+
+  std::sort(codes.begin(), codes.end());
+
+  const SimplexId clusterNumber
+    = (vertexNumber_ + clusterSize_ - 1) / clusterSize_;
+
+  vertexCluster_.resize(vertexNumber_);
+  std::vector<SimplexId> vertices(vertexNumber_);
+  std::vector<SimplexId> vertexOffsets(clusterNumber + 1);
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif // TTK_ENABLE_OPENMP
+  for(SimplexId i = 0; i < clusterNumber; ++i) {
+    const SimplexId begin = i * clusterSize_;
+    const SimplexId end = std::min(begin + clusterSize_, vertexNumber_);
+    for(SimplexId j = begin; j < end; ++j) {
+      vertices[j] = codes[j].second;
+      vertexCluster_[vertices[j]] = i;
+    }
+    std::sort(vertices.begin() + begin, vertices.begin() + end);
+    vertexOffsets[i] = begin;
+  }
+  vertexOffsets[clusterNumber] = vertexNumber_;
+
+  codes = {};
+  // the layout arrays are accessed through get_ptr(), keep SimplexId storage
+  clusterVertices_.setData(
+    std::move(vertices), std::move(vertexOffsets), threadNumber_, false);
+
+  // 2. cells with at least one vertex in each cluster
+  std::vector<SimplexId> cellOffsets(clusterNumber + 1);
+  const auto forEachCellCluster = [this](const SimplexId cellId,
+                                         std::array<SimplexId, 4> &clusters) {
+    std::array<SimplexId, 4> cell{};
+    const int nbVerts = getCellVertices(cellId, cell);
+    int nbClusters = 0;
+    for(int i = 0; i < nbVerts; ++i) {
+      const auto c = vertexCluster_[cell[i]];
+      if(std::find(clusters.begin(), clusters.begin() + nbClusters, c)
+         == clusters.begin() + nbClusters) {
+        clusters[nbClusters++] = c;
+      }
+    }
+    return nbClusters;
+  };
+
+  for(SimplexId i = 0; i < cellNumber_; ++i) {
+    std::array<SimplexId, 4> clusters{};
+    const int nbClusters = forEachCellCluster(i, clusters);
+    for(int j = 0; j < nbClusters; ++j) {
+      cellOffsets[clusters[j] + 1]++;
+    }
+  }
+  for(SimplexId i = 0; i < clusterNumber; ++i) {
+    cellOffsets[i + 1] += cellOffsets[i];
+  }
+
+  std::vector<SimplexId> cells(cellOffsets.back());
+  std::vector<SimplexId> cellPositions(cellOffsets.begin(), cellOffsets.end());
+  for(SimplexId i = 0; i < cellNumber_; ++i) {
+    std::array<SimplexId, 4> clusters{};
+    const int nbClusters = forEachCellCluster(i, clusters);
+    for(int j = 0; j < nbClusters; ++j) {
+      cells[cellPositions[clusters[j]]++] = i;
+    }
+  }
+  cellPositions = {};
+  clusterCells_.setData(
+    std::move(cells), std::move(cellOffsets), threadNumber_, false);
+
+  // 3. number of edges and triangles owned by each cluster
+  clusterEdgeOffsets_.resize(clusterNumber + 1);
+  clusterTriangleOffsets_.resize(clusterNumber + 1);
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_) schedule(dynamic)
+#endif // TTK_ENABLE_OPENMP
+  for(SimplexId i = 0; i < clusterNumber; ++i) {
+    const auto cluster = buildCluster(i);
+    clusterEdgeOffsets_[i + 1] = cluster->edges.dataSize();
+    clusterTriangleOffsets_[i + 1] = cluster->triangles.dataSize() / 2;
+  }
+
+  for(SimplexId i = 0; i < clusterNumber; ++i) {
+    clusterEdgeOffsets_[i + 1] += clusterEdgeOffsets_[i];
+    clusterTriangleOffsets_[i + 1] += clusterTriangleOffsets_[i];
+  }
+  edgeNumber_ = clusterEdgeOffsets_.back();
+  triangleNumber_ = clusterTriangleOffsets_.back();
+
+  cache_ = std::make_shared<ClusterCache>(clusterNumber);
+
+  printMsg("Built " + std::to_string(clusterNumber) + " clusters", 1,
+           tm.getElapsedTime(), threadNumber_);
+
+  return 0;
+}
+
+std::shared_ptr<CompactTriangulation::Cluster>
+  CompactTriangulation::buildCluster(const SimplexId clusterId) const {
+
+  auto cluster = std::make_shared<Cluster>();
+  cluster->id = clusterId;
+
+  const SimplexId nbVerts = clusterVertices_.size(clusterId);
+  const SimplexId *const verts = clusterVertices_.get_ptr(clusterId, 0);
+  const SimplexId nbCells = clusterCells_.size(clusterId);
+  const SimplexId *const cells = clusterCells_.get_ptr(clusterId, 0);
+
+  const auto localId = [verts, nbVerts](const SimplexId v) {
+    return std::lower_bound(verts, verts + nbVerts, v) - verts;
+  };
+
+  // vertex stars (the cells are sorted, so are the stars)
+  std::vector<SimplexId> offsets(nbVerts + 1);
+  std::array<SimplexId, 4> cell{};
+  for(SimplexId i = 0; i < nbCells; ++i) {
+    const int nbCellVerts = getCellVertices(cells[i], cell);
+    SimplexId lowest = cell[0];
+    for(int j = 0; j < nbCellVerts; ++j) {
+      lowest = std::min(lowest, cell[j]);
+      if(vertexCluster_[cell[j]] == clusterId) {
+        offsets[localId(cell[j]) + 1]++;
+      }
+    }
+    if(vertexCluster_[lowest] == clusterId) {
+      cluster->cells.emplace_back(cells[i]);
+    }
+  }
+  for(SimplexId i = 0; i < nbVerts; ++i) {
+    offsets[i + 1] += offsets[i];
+  }
+  std::vector<SimplexId> stars(offsets.back());
+  std::vector<SimplexId> positions(offsets.begin(), offsets.end() - 1);
+  for(SimplexId i = 0; i < nbCells; ++i) {
+    const int nbCellVerts = getCellVertices(cells[i], cell);
+    for(int j = 0; j < nbCellVerts; ++j) {
+      if(vertexCluster_[cell[j]] == clusterId) {
+        stars[positions[localId(cell[j])]++] = cells[i];
+      }
+    }
+  }
+  cluster->vertexStars.setData(std::move(stars), std::move(offsets));
+
+  if(maxCellDim_ < 2) {
+    return cluster;
+  }
+
+  // owned edges
+  const auto &vertexStars = cluster->vertexStars;
+  fillJagged(
+    nbVerts, cluster->edges,
+    [this, verts, &vertexStars](const SimplexId i, std::vector<SimplexId> &d) {
+      const auto begin = d.size();
+      std::array<SimplexId, 4> c{};
+      for(SimplexId j = 0; j < vertexStars.size(i); ++j) {
+        const int nbCellVerts = getCellVertices(vertexStars.get(i, j), c);
+        for(int k = 0; k < nbCellVerts; ++k) {
+          if(c[k] > verts[i]) {
+            d.emplace_back(c[k]);
+          }
+        }
+      }
+      sortUnique(d, begin);
+    });
+
+  if(maxCellDim_ < 3) {
+    return cluster;
+  }
+
+  // owned triangles
+  fillJagged(
+    nbVerts, cluster->triangles,
+    [this, verts, &vertexStars](const SimplexId i, std::vector<SimplexId> &d) {
+      std::vector<std::array<SimplexId, 2>> pairs{};
+      std::array<SimplexId, 4> c{};
+      for(SimplexId j = 0; j < vertexStars.size(i); ++j) {
+        getCellVertices(vertexStars.get(i, j), c);
+        std::array<SimplexId, 3> higher{};
+        int nbHigher = 0;
+        for(int k = 0; k < 4; ++k) {
+          if(c[k] > verts[i]) {
+            higher[nbHigher++] = c[k];
+          }
+        }
+        std::sort(higher.begin(), higher.begin() + nbHigher);
+        for(int k = 0; k < nbHigher; ++k) {
+          for(int l = k + 1; l < nbHigher; ++l) {
+            pairs.push_back({higher[k], higher[l]});
+          }
+        }
+      }
+      std::sort(pairs.begin(), pairs.end());
+      pairs.erase(std::unique(pairs.begin(), pairs.end()), pairs.end());
+      for(const auto &p : pairs) {
+        d.emplace_back(p[0]);
+        d.emplace_back(p[1]);
+      }
+    });
+
+  return cluster;
+}
+
+std::shared_ptr<CompactTriangulation::Cluster>
+  CompactTriangulation::getCluster(const SimplexId clusterId) const {
+
+  auto &cache = *cache_;
+  auto cluster = cache.get(clusterId);
+  if(cluster) {
+    return cluster;
+  }
+
+  // build the cluster outside of the locks
+  auto fresh = buildCluster(clusterId);
+  const auto size = fresh->footprint();
+
+  auto &slot = cache.slots[clusterId];
+  cache.lock.lock();
+  slot.lastUse.store(++cache.clock, std::memory_order_relaxed);
+  slot.lock.lock();
+  if(slot.cluster) {
+    // another thread was faster
+    cluster = slot.cluster;
+    slot.lock.unlock();
+  } else {
+    slot.cluster = cluster = std::move(fresh);
+    slot.footprint = size;
+    slot.lock.unlock();
+    cache.footprint += size;
+    cache.evict(memoryBudget_);
+  }
+  cache.lock.unlock();
+
+  return cluster;
+}
+
+std::shared_ptr<CompactTriangulation::Cluster>
+  CompactTriangulation::getCluster(const SimplexId clusterId,
+                                   const Relation relation) const {
+
+  auto cluster = getCluster(clusterId);
+
+  if(!(cluster->built.load(std::memory_order_acquire) & (1u << relation))) {
+    cluster->lock.lock();
+    const auto before = cluster->footprint();
+    buildRelation(*cluster, relation);
+    const auto after = cluster->footprint();
+    cluster->lock.unlock();
+
+    // account for the new relation in the cache
+    auto &cache = *cache_;
+    auto &slot = cache.slots[clusterId];
+    cache.lock.lock();
+    slot.lastUse.store(++cache.clock, std::memory_order_relaxed);
+    slot.lock.lock();
+    const bool cached = slot.cluster == cluster;
+    if(cached) {
+      slot.footprint += after - before;
+    }
+    slot.lock.unlock();
+    if(cached) {
+      cache.footprint += after - before;
+      cache.evict(memoryBudget_);
+    }
+    cache.lock.unlock();
+  }
+
+  return cluster;
+}
+
+void CompactTriangulation::buildRelation(Cluster &cluster,
+                                         const Relation relation) const {
+
+  // called with the cluster lock held
+  if(cluster.built.load(std::memory_order_acquire) & (1u << relation)) {
+    return;
+  }
+
+  const SimplexId nbVerts = clusterVertices_.size(cluster.id);
+  const SimplexId *const verts = clusterVertices_.get_ptr(cluster.id, 0);
+  const auto &vertexStars = cluster.vertexStars;
+  const auto &edges = cluster.edges;
+  const auto &triangles = cluster.triangles;
+  const SimplexId nbEdges = edges.empty() ? 0 : edges.dataSize();
+  const SimplexId nbTriangles
+    = triangles.empty() ? 0 : triangles.dataSize() / 2;
+  const SimplexId nbCells = cluster.cells.size();
+  const int dim = maxCellDim_;
+  using List = std::vector<SimplexId>;
+
+  // vertices of the owned edges and triangles, in their local order
+  std::vector<std::array<SimplexId, 3>> simplices{};
+  const auto listEdges = [&]() {
+    simplices.resize(nbEdges);
+    for(SimplexId i = 0; i < nbVerts; ++i) {
+      for(SimplexId j = 0; j < edges.size(i); ++j) {
+        simplices[edges.offset(i) + j] = {verts[i], edges.get(i, j), -1};
+      }
+    }
+  };
+  const auto listTriangles = [&]() {
+    simplices.resize(nbTriangles);
+    for(SimplexId i = 0; i < nbVerts; ++i) {
+      for(SimplexId j = 0; j < triangles.size(i) / 2; ++j) {
+        simplices[triangles.offset(i) / 2 + j]
+          = {verts[i], triangles.get(i, 2 * j), triangles.get(i, 2 * j + 1)};
+      }
+    }
+  };
+
+  // local identifier of a vertex of the cluster
+  const auto localVertex = [verts, nbVerts](const SimplexId v) {
+    return std::lower_bound(verts, verts + nbVerts, v) - verts;
+  };
+
+  // cells of the star of the owned simplex (listed in simplices)
+  const auto &edgeStars = cluster.relations[EDGE_STARS];
+  const auto &triangleStars = cluster.relations[TRIANGLE_STARS];
+
+  std::array<SimplexId, 4> cell{};
+  const auto contains = [&cell](const int nbCellVerts, const SimplexId v) {
+    return std::find(cell.begin(), cell.begin() + nbCellVerts, v)
+           != cell.begin() + nbCellVerts;
+  };
+  // vertices of the cell that are not in the given simplex
+  const auto others
+    = [&cell](const int nbCellVerts, const std::array<SimplexId, 3> &simplex,
+              std::array<SimplexId, 4> &res) {
+        int nb = 0;
+        for(int i = 0; i < nbCellVerts; ++i) {
+          if(std::find(simplex.begin(), simplex.end(), cell[i])
+             == simplex.end()) {
+            res[nb++] = cell[i];
+          }
+        }
+        return nb;
+      };
+
+  auto &output = cluster.relations[std::min(relation, CELL_NEIGHBORS)];
+
+  switch(relation) {
+
+    case VERTEX_NEIGHBORS:
+      fillJagged(nbVerts, output, [&](const SimplexId i, List &d) {
+        const auto begin = d.size();
+        for(SimplexId j = 0; j < vertexStars.size(i); ++j) {
+          const int n = getCellVertices(vertexStars.get(i, j), cell);
+          for(int k = 0; k < n; ++k) {
+            if(cell[k] != verts[i]) {
+              d.emplace_back(cell[k]);
+            }
+          }
+        }
+        sortUnique(d, begin);
+      });
+      break;
+
+    case VERTEX_EDGES:
+      buildRelation(cluster, VERTEX_NEIGHBORS);
+      fillJagged(nbVerts, output, [&](const SimplexId i, List &d) {
+        const auto &neighbors = cluster.relations[VERTEX_NEIGHBORS];
+        for(SimplexId j = 0; j < neighbors.size(i); ++j) {
+          d.emplace_back(findEdge(verts[i], neighbors.get(i, j)));
+        }
+      });
+      break;
+
+    case VERTEX_TRIANGLES:
+      fillJagged(nbVerts, output, [&](const SimplexId i, List &d) {
+        const auto begin = d.size();
+        std::array<SimplexId, 4> o{};
+        for(SimplexId j = 0; j < vertexStars.size(i); ++j) {
+          const int n = getCellVertices(vertexStars.get(i, j), cell);
+          const int nbOthers = others(n, {verts[i], -1, -1}, o);
+          for(int k = 0; k < nbOthers; ++k) {
+            for(int l = k + 1; l < nbOthers; ++l) {
+              d.emplace_back(findTriangle(verts[i], o[k], o[l]));
+            }
+          }
+        }
+        sortUnique(d, begin);
+      });
+      break;
+
+    case VERTEX_LINKS:
+      // one link simplex per star cell
+      fillJagged(nbVerts, output, [&](const SimplexId i, List &d) {
+        std::array<SimplexId, 4> o{};
+        for(SimplexId j = 0; j < vertexStars.size(i); ++j) {
+          const int n = getCellVertices(vertexStars.get(i, j), cell);
+          others(n, {verts[i], -1, -1}, o);
+          if(dim == 1) {
+            d.emplace_back(o[0]);
+          } else if(dim == 2) {
+            d.emplace_back(findEdge(o[0], o[1]));
+          } else {
+            d.emplace_back(findTriangle(o[0], o[1], o[2]));
+          }
+        }
+      });
+      break;
+
+    case EDGE_STARS:
+      listEdges();
+      fillJagged(nbEdges, output, [&](const SimplexId i, List &d) {
+        const auto lv = localVertex(simplices[i][0]);
+        for(SimplexId j = 0; j < vertexStars.size(lv); ++j) {
+          const int n = getCellVertices(vertexStars.get(lv, j), cell);
+          if(contains(n, simplices[i][1])) {
+            d.emplace_back(vertexStars.get(lv, j));
+          }
+        }
+      });
+      break;
+
+    case EDGE_LINKS:
+      buildRelation(cluster, EDGE_STARS);
+      listEdges();
+      // one link simplex per star cell
+      fillJagged(nbEdges, output, [&](const SimplexId i, List &d) {
+        std::array<SimplexId, 4> o{};
+        for(SimplexId j = 0; j < edgeStars.size(i); ++j) {
+          const int n = getCellVertices(edgeStars.get(i, j), cell);
+          others(n, simplices[i], o);
+          if(dim == 2) {
+            d.emplace_back(o[0]);
+          } else {
+            d.emplace_back(findEdge(o[0], o[1]));
+          }
+        }
+      });
+      break;
+
+    case EDGE_TRIANGLES:
+      buildRelation(cluster, EDGE_STARS);
+      listEdges();
+      fillJagged(nbEdges, output, [&](const SimplexId i, List &d) {
+        const auto begin = d.size();
+        std::array<SimplexId, 4> o{};
+        for(SimplexId j = 0; j < edgeStars.size(i); ++j) {
+          const int n = getCellVertices(edgeStars.get(i, j), cell);
+          const int nbOthers = others(n, simplices[i], o);
+          for(int k = 0; k < nbOthers; ++k) {
+            d.emplace_back(
+              findTriangle(simplices[i][0], simplices[i][1], o[k]));
+          }
+        }
+        sortUnique(d, begin);
+      });
+      break;
+
+    case TRIANGLE_STARS:
+      listTriangles();
+      fillJagged(nbTriangles, output, [&](const SimplexId i, List &d) {
+        const auto lv = localVertex(simplices[i][0]);
+        for(SimplexId j = 0; j < vertexStars.size(lv); ++j) {
+          const int n = getCellVertices(vertexStars.get(lv, j), cell);
+          if(contains(n, simplices[i][1]) && contains(n, simplices[i][2])) {
+            d.emplace_back(vertexStars.get(lv, j));
+          }
+        }
+      });
+      break;
+
+    case TRIANGLE_LINKS:
+      buildRelation(cluster, TRIANGLE_STARS);
+      listTriangles();
+      // one link vertex per star cell
+      fillJagged(nbTriangles, output, [&](const SimplexId i, List &d) {
+        std::array<SimplexId, 4> o{};
+        for(SimplexId j = 0; j < triangleStars.size(i); ++j) {
+          const int n = getCellVertices(triangleStars.get(i, j), cell);
+          others(n, simplices[i], o);
+          d.emplace_back(o[0]);
+        }
+      });
+      break;
+
+    case TRIANGLE_EDGES:
+      listTriangles();
+      fillJagged(nbTriangles, output, [&](const SimplexId i, List &d) {
+        const auto &t = simplices[i];
+        d.emplace_back(findEdge(t[0], t[1]));
+        d.emplace_back(findEdge(t[0], t[2]));
+        d.emplace_back(findEdge(t[1], t[2]));
+      });
+      break;
+
+    case CELL_EDGES:
+      fillJagged(nbCells, output, [&](const SimplexId i, List &d) {
+        const int n = getCellVertices(cluster.cells[i], cell);
+        for(int j = 0; j < n; ++j) {
+          for(int k = j + 1; k < n; ++k) {
+            d.emplace_back(findEdge(cell[j], cell[k]));
+          }
+        }
+      });
+      break;
+
+    case CELL_TRIANGLES:
+      fillJagged(nbCells, output, [&](const SimplexId i, List &d) {
+        getCellVertices(cluster.cells[i], cell);
+        d.emplace_back(findTriangle(cell[0], cell[1], cell[2]));
+        d.emplace_back(findTriangle(cell[0], cell[1], cell[3]));
+        d.emplace_back(findTriangle(cell[0], cell[2], cell[3]));
+        d.emplace_back(findTriangle(cell[1], cell[2], cell[3]));
+      });
+      break;
+
+    case CELL_NEIGHBORS:
+      // cells sharing a facet, looked for in the star of the first vertex
+      // of the facet (possibly in another cluster)
+      fillJagged(nbCells, output, [&](const SimplexId i, List &d) {
+        const SimplexId cellId = cluster.cells[i];
+        const int n = getCellVertices(cellId, cell);
+        for(int j = 0; j < n; ++j) {
+          std::array<SimplexId, 3> facet{-1, -1, -1};
+          for(int k = 0, l = 0; k < n; ++k) {
+            if(k != j) {
+              facet[l++] = cell[k];
+            }
+          }
+          const auto pivot = getCluster(vertexCluster_[facet[0]]);
+          const auto lv = getVertexLocalId(facet[0]);
+          for(SimplexId k = 0; k < pivot->vertexStars.size(lv); ++k) {
+            const SimplexId other = pivot->vertexStars.get(lv, k);
+            if(other == cellId) {
+              continue;
+            }
+            std::array<SimplexId, 4> oc{};
+            const int m = getCellVertices(other, oc);
+            bool shared = true;
+            for(int l = 1; l < n - 1; ++l) {
+              shared = shared
+                       && std::find(oc.begin(), oc.begin() + m, facet[l])
+                            != oc.begin() + m;
+            }
+            if(shared) {
+              d.emplace_back(other);
+              break;
+            }
+          }
+        }
+      });
+      break;
+
+    case BOUNDARY_VERTICES:
+      // a vertex is on the boundary if it belongs to a boundary facet
+      // (facet in the star of only one cell)
+      cluster.boundaryVertices.resize(nbVerts, false);
+      if(dim == 1) {
+        for(SimplexId i = 0; i < nbVerts; ++i) {
+          cluster.boundaryVertices[i] = vertexStars.size(i) == 1;
+        }
+        break;
+      }
+      for(SimplexId i = 0; i < nbVerts; ++i) {
+        std::array<SimplexId, 4> o{};
+        for(SimplexId j = 0;
+            j < vertexStars.size(i) && !cluster.boundaryVertices[i]; ++j) {
+          const int n = getCellVertices(vertexStars.get(i, j), cell);
+          const int nbOthers = others(n, {verts[i], -1, -1}, o);
+          // facets of this cell containing the vertex
+          for(int k = 0; k < nbOthers; ++k) {
+            const auto a = o[k];
+            const auto b = (dim == 3) ? o[(k + 1) % nbOthers] : -1;
+            SimplexId count = 0;
+            for(SimplexId l = 0; l < vertexStars.size(i); ++l) {
+              const int m = getCellVertices(vertexStars.get(i, l), cell);
+              if(contains(m, a) && (b == -1 || contains(m, b))) {
+                count++;
+              }
+            }
+            if(count == 1) {
+              cluster.boundaryVertices[i] = true;
+              break;
+            }
+          }
+        }
+      }
+      break;
+
+    case BOUNDARY_EDGES:
+      buildRelation(cluster, EDGE_STARS);
+      cluster.boundaryEdges.resize(nbEdges, false);
+      if(dim == 2) {
+        for(SimplexId i = 0; i < nbEdges; ++i) {
+          cluster.boundaryEdges[i] = edgeStars.size(i) == 1;
+        }
+        break;
+      }
+      listEdges();
+      for(SimplexId i = 0; i < nbEdges; ++i) {
+        std::array<SimplexId, 4> o{};
+        for(SimplexId j = 0;
+            j < edgeStars.size(i) && !cluster.boundaryEdges[i]; ++j) {
+          int n = getCellVertices(edgeStars.get(i, j), cell);
+          const int nbOthers = others(n, simplices[i], o);
+          // triangles of this cell containing the edge
+          for(int k = 0; k < nbOthers; ++k) {
+            SimplexId count = 0;
+            for(SimplexId l = 0; l < edgeStars.size(i); ++l) {
+              n = getCellVertices(edgeStars.get(i, l), cell);
+              if(contains(n, o[k])) {
+                count++;
+              }
+            }
+            if(count == 1) {
+              cluster.boundaryEdges[i] = true;
+              break;
+            }
+          }
+        }
+      }
+      break;
+
+    case BOUNDARY_TRIANGLES:
+      buildRelation(cluster, TRIANGLE_STARS);
+      cluster.boundaryTriangles.resize(nbTriangles, false);
+      for(SimplexId i = 0; i < nbTriangles; ++i) {
+        cluster.boundaryTriangles[i] = triangleStars.size(i) == 1;
+      }
+      break;
+  }
+
+  cluster.built.fetch_or(1u << relation, std::memory_order_release);
+}
+
+SimplexId
+  CompactTriangulation::getVertexLocalId(const SimplexId vertexId) const {
+  const auto clusterId = vertexCluster_[vertexId];
+  const SimplexId *const verts = clusterVertices_.get_ptr(clusterId, 0);
+  return std::lower_bound(
+           verts, verts + clusterVertices_.size(clusterId), vertexId)
+         - verts;
+}
+
+SimplexId CompactTriangulation::getEdgeCluster(const SimplexId edgeId) const {
+  return std::upper_bound(
+           clusterEdgeOffsets_.begin(), clusterEdgeOffsets_.end(), edgeId)
+         - clusterEdgeOffsets_.begin() - 1;
+}
+
+SimplexId
+  CompactTriangulation::getTriangleCluster(const SimplexId triangleId) const {
+  return std::upper_bound(clusterTriangleOffsets_.begin(),
+                          clusterTriangleOffsets_.end(), triangleId)
+         - clusterTriangleOffsets_.begin() - 1;
+}
+
+SimplexId CompactTriangulation::getCellCluster(const SimplexId cellId) const {
+  std::array<SimplexId, 4> cell{};
+  const int n = getCellVertices(cellId, cell);
+  return vertexCluster_[*std::min_element(cell.begin(), cell.begin() + n)];
+}
+
+SimplexId CompactTriangulation::getCellLocalId(const Cluster &cluster,
+                                               const SimplexId cellId) const {
+  return std::lower_bound(cluster.cells.begin(), cluster.cells.end(), cellId)
+         - cluster.cells.begin();
+}
+
+SimplexId CompactTriangulation::findEdge(SimplexId v0, SimplexId v1) const {
+  if(v0 > v1) {
+    std::swap(v0, v1);
+  }
+  const auto clusterId = vertexCluster_[v0];
+  const auto cluster = getCluster(clusterId);
+  const auto lv = getVertexLocalId(v0);
+  const SimplexId nb = cluster->edges.size(lv);
+  if(nb <= 0) {
+    return -1;
+  }
+  const auto &edges = cluster->edges;
+  const SimplexId pos = edges.hasShortIds()
+                          ? findSorted(edges.get_short_ptr(lv, 0), nb, v1)
+                          : findSorted(edges.get_ptr(lv, 0), nb, v1);
+  if(pos == -1) {
+    return -1;
+  }
+  return clusterEdgeOffsets_[clusterId] + cluster->edges.offset(lv) + pos;
+}
+
+SimplexId CompactTriangulation::findTriangle(SimplexId v0,
+                                             SimplexId v1,
+                                             SimplexId v2) const {
+  if(v0 > v1) {
+    std::swap(v0, v1);
+  }
+  if(v1 > v2) {
+    std::swap(v1, v2);
+  }
+  if(v0 > v1) {
+    std::swap(v0, v1);
+  }
+  const auto clusterId = vertexCluster_[v0];
+  const auto cluster = getCluster(clusterId);
+  const auto lv = getVertexLocalId(v0);
+  const SimplexId nb = cluster->triangles.size(lv) / 2;
+  if(nb <= 0) {
+    return -1;
+  }
+  // binary search among the sorted pairs
+  const auto &triangles = cluster->triangles;
+  const SimplexId first
+    = triangles.hasShortIds()
+        ? findSortedPair(triangles.get_short_ptr(lv, 0), nb, v1, v2)
+        : findSortedPair(triangles.get_ptr(lv, 0), nb, v1, v2);
+  if(first == -1) {
+    return -1;
+  }
+  return clusterTriangleOffsets_[clusterId] + cluster->triangles.offset(lv) / 2
+         + first;
+}
+
+int CompactTriangulation::getVertexRelation(const Relation relation,
+                                            const SimplexId vertexId,
+                                            const int localId,
+                                            SimplexId &id) const {
+#ifndef TTK_ENABLE_KAMIKAZE
+  if((vertexId < 0) || (vertexId >= vertexNumber_))
+    return -1;
+#endif
+  const auto cluster = getCluster(vertexCluster_[vertexId], relation);
+  id = cluster->relations[relation].get(getVertexLocalId(vertexId), localId);
+  return 0;
+}
+
+SimplexId CompactTriangulation::getVertexRelationNumber(
+  const Relation relation, const SimplexId vertexId) const {
+#ifndef TTK_ENABLE_KAMIKAZE
+  if((vertexId < 0) || (vertexId >= vertexNumber_))
+    return -1;
+#endif
+  const auto cluster = getCluster(vertexCluster_[vertexId], relation);
+  return cluster->relations[relation].size(getVertexLocalId(vertexId));
+}
+
+int CompactTriangulation::getEdgeRelation(const Relation relation,
+                                          const SimplexId edgeId,
+                                          const int localId,
+                                          SimplexId &id) const {
+#ifndef TTK_ENABLE_KAMIKAZE
+  if((edgeId < 0) || (edgeId >= edgeNumber_))
+    return -1;
+#endif
+  const auto clusterId = getEdgeCluster(edgeId);
+  const auto cluster = getCluster(clusterId, relation);
+  id = cluster->relations[relation].get(
+    edgeId - clusterEdgeOffsets_[clusterId], localId);
+  return 0;
+}
+
+SimplexId
+  CompactTriangulation::getEdgeRelationNumber(const Relation relation,
+                                              const SimplexId edgeId) const {
+#ifndef TTK_ENABLE_KAMIKAZE
+  if((edgeId < 0) || (edgeId >= edgeNumber_))
+    return -1;
+#endif
+  const auto clusterId = getEdgeCluster(edgeId);
+  const auto cluster = getCluster(clusterId, relation);
+  return cluster->relations[relation].size(edgeId
+                                           - clusterEdgeOffsets_[clusterId]);
+}
+
+int CompactTriangulation::getTriangleRelation(const Relation relation,
+                                              const SimplexId triangleId,
+                                              const int localId,
+                                              SimplexId &id) const {
+#ifndef TTK_ENABLE_KAMIKAZE
+  if((triangleId < 0) || (triangleId >= triangleNumber_))
+    return -1;
+#endif
+  const auto clusterId = getTriangleCluster(triangleId);
+  const auto cluster = getCluster(clusterId, relation);
+  id = cluster->relations[relation].get(
+    triangleId - clusterTriangleOffsets_[clusterId], localId);
+  return 0;
+}
+
+SimplexId CompactTriangulation::getTriangleRelationNumber(
+  const Relation relation, const SimplexId triangleId) const {
+#ifndef TTK_ENABLE_KAMIKAZE
+  if((triangleId < 0) || (triangleId >= triangleNumber_))
+    return -1;
+#endif
+  const auto clusterId = getTriangleCluster(triangleId);
+  const auto cluster = getCluster(clusterId, relation);
+  return cluster->relations[relation].size(
+    triangleId - clusterTriangleOffsets_[clusterId]);
+}
+
+int CompactTriangulation::getCellRelation(const Relation relation,
+                                          const SimplexId cellId,
+                                          const int localId,
+                                          SimplexId &id) const {
+#ifndef TTK_ENABLE_KAMIKAZE
+  if((cellId < 0) || (cellId >= cellNumber_))
+    return -1;
+#endif
+  const auto cluster = getCluster(getCellCluster(cellId), relation);
+  id = cluster->relations[relation].get(
+    getCellLocalId(*cluster, cellId), localId);
+  return 0;
+}
+
+SimplexId
+  CompactTriangulation::getCellRelationNumber(const Relation relation,
+                                              const SimplexId cellId) const {
+#ifndef TTK_ENABLE_KAMIKAZE
+  if((cellId < 0) || (cellId >= cellNumber_))
+    return -1;
+#endif
+  const auto cluster = getCluster(getCellCluster(cellId), relation);
+  return cluster->relations[relation].size(getCellLocalId(*cluster, cellId));
+}
+
+const std::vector<std::vector<SimplexId>> *CompactTriangulation::fillList(
+  const SimplexId number,
+  const Counter counter,
+  const Getter getter,
+  std::vector<std::vector<SimplexId>> &list) const {
+
+  list.resize(number);
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_) schedule(dynamic, 1024)
+#endif // TTK_ENABLE_OPENMP
+  for(SimplexId i = 0; i < number; ++i) {
+    list[i].resize((this->*counter)(i));
+    for(size_t j = 0; j < list[i].size(); ++j) {
+      (this->*getter)(i, j, list[i][j]);
+    }
+  }
+
+  return &list;
+}
+
+int CompactTriangulation::getCellEdgeInternal(const SimplexId &cellId,
+                                              const int &localEdgeId,
+                                              SimplexId &edgeId) const {
+  return getCellRelation(CELL_EDGES, cellId, localEdgeId, edgeId);
+}
+
+SimplexId CompactTriangulation::getCellEdgeNumberInternal(
+  const SimplexId &cellId) const {
+  return getCellRelationNumber(CELL_EDGES, cellId);
+}
+
+const std::vector<std::vector<SimplexId>> *
+  CompactTriangulation::getCellEdgesInternal() {
+  return fillList(cellNumber_, &CompactTriangulation::getCellEdgeNumberInternal,
+                  &CompactTriangulation::getCellEdgeInternal, cellEdgeVector_);
+}
+
+int CompactTriangulation::TTK_TRIANGULATION_INTERNAL(getCellNeighbor)(
+  const SimplexId &cellId,
+  const int &localNeighborId,
+  SimplexId &neighborId) const {
+  return getCellRelation(CELL_NEIGHBORS, cellId, localNeighborId, neighborId);
+}
+
+SimplexId CompactTriangulation::TTK_TRIANGULATION_INTERNAL(
+  getCellNeighborNumber)(const SimplexId &cellId) const {
+  return getCellRelationNumber(CELL_NEIGHBORS, cellId);
+}
+
+const std::vector<std::vector<SimplexId>> *
+  CompactTriangulation::TTK_TRIANGULATION_INTERNAL(getCellNeighbors)() {
+  return fillList(
+    cellNumber_,
+    &CompactTriangulation::TTK_TRIANGULATION_INTERNAL(getCellNeighborNumber),
+    &CompactTriangulation::TTK_TRIANGULATION_INTERNAL(getCellNeighbor),
+    cellNeighborList_);
+}
+
+int CompactTriangulation::getCellTriangleInternal(
+  const SimplexId &cellId,
+  const int &localTriangleId,
+  SimplexId &triangleId) const {
+  return getCellRelation(CELL_TRIANGLES, cellId, localTriangleId, triangleId);
+}
+
+SimplexId CompactTriangulation::getCellTriangleNumberInternal(
+  const SimplexId &cellId) const {
+  return getCellRelationNumber(CELL_TRIANGLES, cellId);
+}
+
+const std::vector<std::vector<SimplexId>> *
+  CompactTriangulation::getCellTrianglesInternal() {
+  return fillList(cellNumber_,
+                  &CompactTriangulation::getCellTriangleNumberInternal,
+                  &CompactTriangulation::getCellTriangleInternal,
+                  cellTriangleVector_);
+}
+
+const std::vector<std::array<SimplexId, 2>> *
+  CompactTriangulation::TTK_TRIANGULATION_INTERNAL(getEdges)() {
+
+  if((SimplexId)edgeList_.size() != edgeNumber_) {
+    edgeList_.resize(edgeNumber_);
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif // TTK_ENABLE_OPENMP
+    for(SimplexId i = 0; i < edgeNumber_; ++i) {
+      getEdgeVertexInternal(i, 0, edgeList_[i][0]);
+      getEdgeVertexInternal(i, 1, edgeList_[i][1]);
+    }
+  }
+
+  return &edgeList_;
+}
+
+int CompactTriangulation::TTK_TRIANGULATION_INTERNAL(getEdgeLink)(
+  const SimplexId &edgeId, const int &localLinkId, SimplexId &linkId) const {
+  return getEdgeRelation(EDGE_LINKS, edgeId, localLinkId, linkId);
+}
+
+SimplexId CompactTriangulation::TTK_TRIANGULATION_INTERNAL(getEdgeLinkNumber)(
+  const SimplexId &edgeId) const {
+  return getEdgeRelationNumber(EDGE_LINKS, edgeId);
+}
+
+const std::vector<std::vector<SimplexId>> *
+  CompactTriangulation::TTK_TRIANGULATION_INTERNAL(getEdgeLinks)() {
+  return fillList(
+    edgeNumber_,
+    &CompactTriangulation::TTK_TRIANGULATION_INTERNAL(getEdgeLinkNumber),
+    &CompactTriangulation::TTK_TRIANGULATION_INTERNAL(getEdgeLink),
+    edgeLinkList_);
+}
+
+int CompactTriangulation::TTK_TRIANGULATION_INTERNAL(getEdgeStar)(
+  const SimplexId &edgeId, const int &localStarId, SimplexId &starId) const {
+  return getEdgeRelation(EDGE_STARS, edgeId, localStarId, starId);
+}
+
+SimplexId CompactTriangulation::TTK_TRIANGULATION_INTERNAL(getEdgeStarNumber)(
+  const SimplexId &edgeId) const {
+  return getEdgeRelationNumber(EDGE_STARS, edgeId);
+}
+
+const std::vector<std::vector<SimplexId>> *
+  CompactTriangulation::TTK_TRIANGULATION_INTERNAL(getEdgeStars)() {
+  return fillList(
+    edgeNumber_,
+    &CompactTriangulation::TTK_TRIANGULATION_INTERNAL(getEdgeStarNumber),
+    &CompactTriangulation::TTK_TRIANGULATION_INTERNAL(getEdgeStar),
+    edgeStarList_);
+}
+
+int CompactTriangulation::getEdgeTriangleInternal(
+  const SimplexId &edgeId,
+  const int &localTriangleId,
+  SimplexId &triangleId) const {
+  return getEdgeRelation(EDGE_TRIANGLES, edgeId, localTriangleId, triangleId);
+}
+
+SimplexId CompactTriangulation::getEdgeTriangleNumberInternal(
+  const SimplexId &edgeId) const {
+  return getEdgeRelationNumber(EDGE_TRIANGLES, edgeId);
+}
+
+const std::vector<std::vector<SimplexId>> *
+  CompactTriangulation::getEdgeTrianglesInternal() {
+  return fillList(edgeNumber_,
+                  &CompactTriangulation::getEdgeTriangleNumberInternal,
+                  &CompactTriangulation::getEdgeTriangleInternal,
+                  edgeTriangleList_);
+}
+
+int CompactTriangulation::getEdgeVertexInternal(const SimplexId &edgeId,
+                                                const int &localVertexId,
+                                                SimplexId &vertexId) const {
+#ifndef TTK_ENABLE_KAMIKAZE
+  if((edgeId < 0) || (edgeId >= edgeNumber_))
+    return -1;
+  if((localVertexId != 0) && (localVertexId != 1))
+    return -2;
+#endif
+  const auto clusterId = getEdgeCluster(edgeId);
+  const auto cluster = getCluster(clusterId);
+  const SimplexId localEdgeId = edgeId - clusterEdgeOffsets_[clusterId];
+  // the owned edges are stored per lowest vertex
+  const SimplexId nbVerts = clusterVertices_.size(clusterId);
+  const SimplexId lv = findSubvector(cluster->edges, nbVerts, localEdgeId);
+  if(!localVertexId) {
+    vertexId = clusterVertices_.get(clusterId, lv);
+  } else {
+    vertexId
+      = cluster->edges.get(lv, localEdgeId - cluster->edges.offset(lv));
+  }
+  return 0;
+}
+
+const std::vector<std::array<SimplexId, 3>> *
+  CompactTriangulation::TTK_TRIANGULATION_INTERNAL(getTriangles)() {
+
+  if((SimplexId)triangleList_.size() != triangleNumber_) {
+    triangleList_.resize(triangleNumber_);
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif // TTK_ENABLE_OPENMP
+    for(SimplexId i = 0; i < triangleNumber_; ++i) {
+      for(int j = 0; j < 3; ++j) {
+        getTriangleVertexInternal(i, j, triangleList_[i][j]);
+      }
+    }
+  }
+
+  return &triangleList_;
+}
+
+int CompactTriangulation::getTriangleEdgeInternal(const SimplexId &triangleId,
+                                                  const int &localEdgeId,
+                                                  SimplexId &edgeId) const {
+  // in 2D, triangles are cells
+  if(maxCellDim_ == 2) {
+    return getCellRelation(CELL_EDGES, triangleId, localEdgeId, edgeId);
+  }
+  return getTriangleRelation(TRIANGLE_EDGES, triangleId, localEdgeId, edgeId);
+}
+
+SimplexId CompactTriangulation::getTriangleEdgeNumberInternal(
+  const SimplexId &triangleId) const {
+  if(maxCellDim_ == 2) {
+    return getCellRelationNumber(CELL_EDGES, triangleId);
+  }
+  return getTriangleRelationNumber(TRIANGLE_EDGES, triangleId);
+}
+
+const std::vector<std::vector<SimplexId>> *
+  CompactTriangulation::getTriangleEdgesInternal() {
+  return fillList(maxCellDim_ == 2 ? cellNumber_ : triangleNumber_,
+                  &CompactTriangulation::getTriangleEdgeNumberInternal,
+                  &CompactTriangulation::getTriangleEdgeInternal,
+                  triangleEdgeVector_);
+}
+
+int CompactTriangulation::TTK_TRIANGULATION_INTERNAL(getTriangleLink)(
+  const SimplexId &triangleId,
+  const int &localLinkId,
+  SimplexId &linkId) const {
+  return getTriangleRelation(TRIANGLE_LINKS, triangleId, localLinkId, linkId);
+}
+
+SimplexId CompactTriangulation::TTK_TRIANGULATION_INTERNAL(
+  getTriangleLinkNumber)(const SimplexId &triangleId) const {
+  return getTriangleRelationNumber(TRIANGLE_LINKS, triangleId);
+}
+
+const std::vector<std::vector<SimplexId>> *
+  CompactTriangulation::TTK_TRIANGULATION_INTERNAL(getTriangleLinks)() {
+  return fillList(
+    triangleNumber_,
+    &CompactTriangulation::TTK_TRIANGULATION_INTERNAL(getTriangleLinkNumber),
+    &CompactTriangulation::TTK_TRIANGULATION_INTERNAL(getTriangleLink),
+    triangleLinkList_);
+}
+
+int CompactTriangulation::TTK_TRIANGULATION_INTERNAL(getTriangleStar)(
+  const SimplexId &triangleId,
+  const int &localStarId,
+  SimplexId &starId) const {
+  return getTriangleRelation(TRIANGLE_STARS, triangleId, localStarId, starId);
+}
+
+SimplexId CompactTriangulation::TTK_TRIANGULATION_INTERNAL(
+  getTriangleStarNumber)(const SimplexId &triangleId) const {
+  return getTriangleRelationNumber(TRIANGLE_STARS, triangleId);
+}
+
+const std::vector<std::vector<SimplexId>> *
+  CompactTriangulation::TTK_TRIANGULATION_INTERNAL(getTriangleStars)() {
+  return fillList(
+    triangleNumber_,
+    &CompactTriangulation::TTK_TRIANGULATION_INTERNAL(getTriangleStarNumber),
+    &CompactTriangulation::TTK_TRIANGULATION_INTERNAL(getTriangleStar),
+    triangleStarList_);
+}
+
+int CompactTriangulation::getTriangleVertexInternal(
+  const SimplexId &triangleId,
+  const int &localVertexId,
+  SimplexId &vertexId) const {
+#ifndef TTK_ENABLE_KAMIKAZE
+  if((triangleId < 0) || (triangleId >= triangleNumber_))
+    return -1;
+  if((localVertexId < 0) || (localVertexId > 2))
+    return -2;
+#endif
+  const auto clusterId = getTriangleCluster(triangleId);
+  const auto cluster = getCluster(clusterId);
+  const SimplexId localTriangleId
+    = triangleId - clusterTriangleOffsets_[clusterId];
+  // the owned triangles are stored per lowest vertex, as pairs
+  const SimplexId nbVerts = clusterVertices_.size(clusterId);
+  const SimplexId lv
+    = findSubvector(cluster->triangles, nbVerts, 2 * localTriangleId);
+  if(!localVertexId) {
+    vertexId = clusterVertices_.get(clusterId, lv);
+  } else {
+    vertexId = cluster->triangles.get(
+      lv,
+      2 * localTriangleId - cluster->triangles.offset(lv) + localVertexId - 1);
+  }
+  return 0;
+}
+
+int CompactTriangulation::getVertexEdgeInternal(const SimplexId &vertexId,
+                                                const int &localEdgeId,
+                                                SimplexId &edgeId) const {
+  return getVertexRelation(VERTEX_EDGES, vertexId, localEdgeId, edgeId);
+}
+
+SimplexId CompactTriangulation::getVertexEdgeNumberInternal(
+  const SimplexId &vertexId) const {
+  return getVertexRelationNumber(VERTEX_EDGES, vertexId);
+}
+
+const std::vector<std::vector<SimplexId>> *
+  CompactTriangulation::getVertexEdgesInternal() {
+  return fillList(vertexNumber_,
+                  &CompactTriangulation::getVertexEdgeNumberInternal,
+                  &CompactTriangulation::getVertexEdgeInternal,
+                  vertexEdgeList_);
+}
+
+int CompactTriangulation::TTK_TRIANGULATION_INTERNAL(getVertexLink)(
+  const SimplexId &vertexId, const int &localLinkId, SimplexId &linkId) const {
+  return getVertexRelation(VERTEX_LINKS, vertexId, localLinkId, linkId);
+}
+
+SimplexId CompactTriangulation::TTK_TRIANGULATION_INTERNAL(
+  getVertexLinkNumber)(const SimplexId &vertexId) const {
+  return getVertexRelationNumber(VERTEX_LINKS, vertexId);
+}
+
+const std::vector<std::vector<SimplexId>> *
+  CompactTriangulation::TTK_TRIANGULATION_INTERNAL(getVertexLinks)() {
+  return fillList(
+    vertexNumber_,
+    &CompactTriangulation::TTK_TRIANGULATION_INTERNAL(getVertexLinkNumber),
+    &CompactTriangulation::TTK_TRIANGULATION_INTERNAL(getVertexLink),
+    vertexLinkList_);
+}
+
+int CompactTriangulation::TTK_TRIANGULATION_INTERNAL(getVertexNeighbor)(
+  const SimplexId &vertexId,
+  const int &localNeighborId,
+  SimplexId &neighborId) const {
+  return getVertexRelation(
+    VERTEX_NEIGHBORS, vertexId, localNeighborId, neighborId);
+}
+
+SimplexId CompactTriangulation::TTK_TRIANGULATION_INTERNAL(
+  getVertexNeighborNumber)(const SimplexId &vertexId) const {
+  return getVertexRelationNumber(VERTEX_NEIGHBORS, vertexId);
+}
+
+const std::vector<std::vector<SimplexId>> *
+  CompactTriangulation::TTK_TRIANGULATION_INTERNAL(getVertexNeighbors)() {
+  return fillList(
+    vertexNumber_,
+    &CompactTriangulation::TTK_TRIANGULATION_INTERNAL(getVertexNeighborNumber),
+    &CompactTriangulation::TTK_TRIANGULATION_INTERNAL(getVertexNeighbor),
+    vertexNeighborList_);
+}
+
+int CompactTriangulation::TTK_TRIANGULATION_INTERNAL(getVertexStar)(
+  const SimplexId &vertexId, const int &localStarId, SimplexId &starId) const {
+#ifndef TTK_ENABLE_KAMIKAZE
+  if((vertexId < 0) || (vertexId >= vertexNumber_))
+    return -1;
+#endif
+  // the vertex stars are part of the cluster skeleton
+  const auto cluster = getCluster(vertexCluster_[vertexId]);
+  starId = cluster->vertexStars.get(getVertexLocalId(vertexId), localStarId);
+  return 0;
+}
+
+SimplexId CompactTriangulation::TTK_TRIANGULATION_INTERNAL(
+  getVertexStarNumber)(const SimplexId &vertexId) const {
+#ifndef TTK_ENABLE_KAMIKAZE
+  if((vertexId < 0) || (vertexId >= vertexNumber_))
+    return -1;
+#endif
+  const auto cluster = getCluster(vertexCluster_[vertexId]);
+  return cluster->vertexStars.size(getVertexLocalId(vertexId));
+}
+
+const std::vector<std::vector<SimplexId>> *
+  CompactTriangulation::TTK_TRIANGULATION_INTERNAL(getVertexStars)() {
+  return fillList(
+    vertexNumber_,
+    &CompactTriangulation::TTK_TRIANGULATION_INTERNAL(getVertexStarNumber),
+    &CompactTriangulation::TTK_TRIANGULATION_INTERNAL(getVertexStar),
+    vertexStarList_);
+}
+
+int CompactTriangulation::getVertexTriangleInternal(
+  const SimplexId &vertexId,
+  const int &localTriangleId,
+  SimplexId &triangleId) const {
+  return getVertexRelation(
+    VERTEX_TRIANGLES, vertexId, localTriangleId, triangleId);
+}
+
+SimplexId CompactTriangulation::getVertexTriangleNumberInternal(
+  const SimplexId &vertexId) const {
+  return getVertexRelationNumber(VERTEX_TRIANGLES, vertexId);
+}
+
+const std::vector<std::vector<SimplexId>> *
+  CompactTriangulation::getVertexTrianglesInternal() {
+  return fillList(vertexNumber_,
+                  &CompactTriangulation::getVertexTriangleNumberInternal,
+                  &CompactTriangulation::getVertexTriangleInternal,
+                  vertexTriangleList_);
+}
+
+bool CompactTriangulation::TTK_TRIANGULATION_INTERNAL(isEdgeOnBoundary)(
+  const SimplexId &edgeId) const {
+#ifndef TTK_ENABLE_KAMIKAZE
+  if((edgeId < 0) || (edgeId >= edgeNumber_) || (maxCellDim_ < 2))
+    return false;
+#endif
+  const auto clusterId = getEdgeCluster(edgeId);
+  const auto cluster = getCluster(clusterId, BOUNDARY_EDGES);
+  return cluster->boundaryEdges[edgeId - clusterEdgeOffsets_[clusterId]];
+}
+
+bool CompactTriangulation::TTK_TRIANGULATION_INTERNAL(isTriangleOnBoundary)(
+  const SimplexId &triangleId) const {
+#ifndef TTK_ENABLE_KAMIKAZE
+  if((triangleId < 0) || (triangleId >= triangleNumber_) || (maxCellDim_ != 3))
+    return false;
+#endif
+  const auto clusterId = getTriangleCluster(triangleId);
+  const auto cluster = getCluster(clusterId, BOUNDARY_TRIANGLES);
+  return cluster
+    ->boundaryTriangles[triangleId - clusterTriangleOffsets_[clusterId]];
+}
+
+bool CompactTriangulation::TTK_TRIANGULATION_INTERNAL(isVertexOnBoundary)(
+  const SimplexId &vertexId) const {
+#ifndef TTK_ENABLE_KAMIKAZE
+  if((vertexId < 0) || (vertexId >= vertexNumber_))
+    return false;
+#endif
+  const auto cluster
+    = getCluster(vertexCluster_[vertexId], BOUNDARY_VERTICES);
+  return cluster->boundaryVertices[getVertexLocalId(vertexId)];
+}
+
+// The relations are computed per cluster on demand: pre-conditioning only
+// builds the cluster layout.
+
+int CompactTriangulation::preconditionBoundaryEdgesInternal() {
+  return buildClusters();
+}
+
+int CompactTriangulation::preconditionBoundaryTrianglesInternal() {
+  return buildClusters();
+}
+
+int CompactTriangulation::preconditionBoundaryVerticesInternal() {
+  return buildClusters();
+}
+
+int CompactTriangulation::preconditionCellEdgesInternal() {
+  return buildClusters();
+}
+
+int CompactTriangulation::preconditionCellNeighborsInternal() {
+  return buildClusters();
+}
+
+int CompactTriangulation::preconditionCellTrianglesInternal() {
+  return buildClusters();
+}
+
+int CompactTriangulation::preconditionEdgesInternal() {
+  return buildClusters();
+}
+
+int CompactTriangulation::preconditionEdgeLinksInternal() {
+  return buildClusters();
+}
+
+int CompactTriangulation::preconditionEdgeStarsInternal() {
+  return buildClusters();
+}
+
+int CompactTriangulation::preconditionEdgeTrianglesInternal() {
+  return buildClusters();
+}
+
+int CompactTriangulation::preconditionTrianglesInternal() {
+  return buildClusters();
+}
+
+int CompactTriangulation::preconditionTriangleEdgesInternal() {
+  return buildClusters();
+}
+
+int CompactTriangulation::preconditionTriangleLinksInternal() {
+  return buildClusters();
+}
+
+int CompactTriangulation::preconditionTriangleStarsInternal() {
+  return buildClusters();
+}
+
+int CompactTriangulation::preconditionVertexEdgesInternal() {
+  return buildClusters();
+}
+
+int CompactTriangulation::preconditionVertexLinksInternal() {
+  return buildClusters();
+}
+
+int CompactTriangulation::preconditionVertexNeighborsInternal() {
+  return buildClusters();
+}
+
+int CompactTriangulation::preconditionVertexStarsInternal() {
+  return buildClusters();
+}
+
+int CompactTriangulation::preconditionVertexTrianglesInternal() {
+  return buildClusters();
+}
@@ -0,0 +1,508 @@
+/// \ingroup base
+/// \class ttk::CompactTriangulation
+/// \date October 2026.
+///
+/// \brief CompactTriangulation is a class that provides memory efficient
+/// traversal methods on triangulations of piecewise linear manifolds.
+///
+/// Contrary to ExplicitTriangulation, which stores every pre-conditioned
+/// relation for the whole mesh, this class partitions the vertices into
+/// spatially coherent clusters (consecutive vertices along a Morton curve
+/// of the bounding box). Only the cluster layout is kept in memory during
+/// the lifetime of the object. The relations of a cluster are computed on
+/// demand, the first time one of its simplices is queried, and stored in a
+/// least-recently-used cache whose size is bounded by a user-defined memory
+/// budget (see setMemoryBudget()).
+///
+/// Edges (respectively triangles) are owned by the cluster of their lowest
+/// vertex. Their global identifiers are contiguous per cluster. Cells keep
+/// their input identifiers and are owned by the cluster of their lowest
+/// vertex as well.
+///
+/// \note The pre-conditioning functions only build the cluster layout (and
+/// count the edges and triangles). Calling them is still required, as for
+/// any other triangulation.
+/// \note The functions returning a pointer to a whole-mesh list (for
+/// instance getVertexNeighbors()) are supported for compatibility but
+/// allocate the whole list.
+/// \sa Triangulation
+/// \sa ExplicitTriangulation
+
+#pragma once
+
+// base code includes
+#include <AbstractTriangulation.h>
+#include <CellArray.h>
+#include <FlatJaggedArray.h>
+
+#include <memory>
+
+namespace ttk {
+
+  class CompactTriangulation final : public AbstractTriangulation {
+
+  public:
+    CompactTriangulation();
+
+    virtual ~CompactTriangulation();
+
+    int clear();
+
+    size_t footprint(size_t size = 0, const bool quiet = false) const;
+
+    int getCellEdgeInternal(const SimplexId &cellId,
+                            const int &localEdgeId,
+                            SimplexId &edgeId) const override;
+
+    SimplexId
+      getCellEdgeNumberInternal(const SimplexId &cellId) const override;
+
+    const std::vector<std::vector<SimplexId>> *getCellEdgesInternal() override;
+
+    int TTK_TRIANGULATION_INTERNAL(getCellNeighbor)(
+      const SimplexId &cellId,
+      const int &localNeighborId,
+      SimplexId &neighborId) const override;
+
+    SimplexId TTK_TRIANGULATION_INTERNAL(getCellNeighborNumber)(
+      const SimplexId &cellId) const override;
+
+    const std::vector<std::vector<SimplexId>> *
+      TTK_TRIANGULATION_INTERNAL(getCellNeighbors)() override;
+
+    int getCellTriangleInternal(const SimplexId &cellId,
+                                const int &localTriangleId,
+                                SimplexId &triangleId) const override;
+
+    SimplexId
+      getCellTriangleNumberInternal(const SimplexId &cellId) const override;
+
+    const std::vector<std::vector<SimplexId>> *
+      getCellTrianglesInternal() override;
+
+    inline int TTK_TRIANGULATION_INTERNAL(getCellVertex)(
+      const SimplexId &cellId,
+      const int &localVertexId,
+      SimplexId &vertexId) const override {
+#ifndef TTK_ENABLE_KAMIKAZE
+      if((!cellArray_) || (!cellNumber_))
+        return -1;
+#endif
+      vertexId = cellArray_->getCellVertex(cellId, localVertexId);
+      return 0;
+    }
+
+    inline SimplexId TTK_TRIANGULATION_INTERNAL(getCellVertexNumber)(
+      const SimplexId &cellId) const override {
+#ifndef TTK_ENABLE_KAMIKAZE
+      if((!cellArray_) || (!cellNumber_))
+        return -1;
+#endif
+      return cellArray_->getCellVertexNumber(cellId);
+    }
+
+    int TTK_TRIANGULATION_INTERNAL(getDimensionality)() const override {
+      return maxCellDim_;
+    }
+
+    const std::vector<std::array<SimplexId, 2>> *
+      TTK_TRIANGULATION_INTERNAL(getEdges)() override;
+
+    int TTK_TRIANGULATION_INTERNAL(getEdgeLink)(
+      const SimplexId &edgeId,
+      const int &localLinkId,
+      SimplexId &linkId) const override;
+
+    SimplexId TTK_TRIANGULATION_INTERNAL(getEdgeLinkNumber)(
+      const SimplexId &edgeId) const override;
+
+    const std::vector<std::vector<SimplexId>> *
+      TTK_TRIANGULATION_INTERNAL(getEdgeLinks)() override;
+
+    int TTK_TRIANGULATION_INTERNAL(getEdgeStar)(
+      const SimplexId &edgeId,
+      const int &localStarId,
+      SimplexId &starId) const override;
+
+    SimplexId TTK_TRIANGULATION_INTERNAL(getEdgeStarNumber)(
+      const SimplexId &edgeId) const override;
+
+    const std::vector<std::vector<SimplexId>> *
+      TTK_TRIANGULATION_INTERNAL(getEdgeStars)() override;
+
+    int getEdgeTriangleInternal(const SimplexId &edgeId,
+                                const int &localTriangleId,
+                                SimplexId &triangleId) const override;
+
+    SimplexId
+      getEdgeTriangleNumberInternal(const SimplexId &edgeId) const override;
+
+    const std::vector<std::vector<SimplexId>> *
+      getEdgeTrianglesInternal() override;
+
+    int getEdgeVertexInternal(const SimplexId &edgeId,
+                              const int &localVertexId,
+                              SimplexId &vertexId) const override;
+
+    inline SimplexId
+      TTK_TRIANGULATION_INTERNAL(getNumberOfCells)() const override {
+      return cellNumber_;
+    }
+
+    inline SimplexId getNumberOfEdgesInternal() const override {
+      return edgeNumber_;
+    }
+
+    inline SimplexId getNumberOfTrianglesInternal() const override {
+      return triangleNumber_;
+    }
+
+    inline SimplexId
+      TTK_TRIANGULATION_INTERNAL(getNumberOfVertices)() const override {
+      return vertexNumber_;
+    }
+
+    const std::vector<std::array<SimplexId, 3>> *
+      TTK_TRIANGULATION_INTERNAL(getTriangles)() override;
+
+    int getTriangleEdgeInternal(const SimplexId &triangleId,
+                                const int &localEdgeId,
+                                SimplexId &edgeId) const override;
+
+    SimplexId getTriangleEdgeNumberInternal(
+      const SimplexId &triangleId) const override;
+
+    const std::vector<std::vector<SimplexId>> *
+      getTriangleEdgesInternal() override;
+
+    int TTK_TRIANGULATION_INTERNAL(getTriangleLink)(
+      const SimplexId &triangleId,
+      const int &localLinkId,
+      SimplexId &linkId) const override;
+
+    SimplexId TTK_TRIANGULATION_INTERNAL(getTriangleLinkNumber)(
+      const SimplexId &triangleId) const override;
+
+    const std::vector<std::vector<SimplexId>> *
+      TTK_TRIANGULATION_INTERNAL(getTriangleLinks)() override;
+
+    int TTK_TRIANGULATION_INTERNAL(getTriangleStar)(
+      const SimplexId &triangleId,
+      const int &localStarId,
+      SimplexId &starId) const override;
+
+    SimplexId TTK_TRIANGULATION_INTERNAL(getTriangleStarNumber)(
+      const SimplexId &triangleId) const override;
+
+    const std::vector<std::vector<SimplexId>> *
+      TTK_TRIANGULATION_INTERNAL(getTriangleStars)() override;
+
+    int getTriangleVertexInternal(const SimplexId &triangleId,
+                                  const int &localVertexId,
+                                  SimplexId &vertexId) const override;
+
+    int getVertexEdgeInternal(const SimplexId &vertexId,
+                              const int &localEdgeId,
+                              SimplexId &edgeId) const override;
+
+    SimplexId
+      getVertexEdgeNumberInternal(const SimplexId &vertexId) const override;
+
+    const std::vector<std::vector<SimplexId>> *
+      getVertexEdgesInternal() override;
+
+    int TTK_TRIANGULATION_INTERNAL(getVertexLink)(
+      const SimplexId &vertexId,
+      const int &localLinkId,
+      SimplexId &linkId) const override;
+
+    SimplexId TTK_TRIANGULATION_INTERNAL(getVertexLinkNumber)(
+      const SimplexId &vertexId) const override;
+
+    const std::vector<std::vector<SimplexId>> *
+      TTK_TRIANGULATION_INTERNAL(getVertexLinks)() override;
+
+    int TTK_TRIANGULATION_INTERNAL(getVertexNeighbor)(
+      const SimplexId &vertexId,
+      const int &localNeighborId,
+      SimplexId &neighborId) const override;
+
+    SimplexId TTK_TRIANGULATION_INTERNAL(getVertexNeighborNumber)(
+      const SimplexId &vertexId) const override;
+
+    const std::vector<std::vector<SimplexId>> *
+      TTK_TRIANGULATION_INTERNAL(getVertexNeighbors)() override;
+
+    inline int TTK_TRIANGULATION_INTERNAL(getVertexPoint)(
+      const SimplexId &vertexId, float &x, float &y, float &z) const override {
+#ifndef TTK_ENABLE_KAMIKAZE
+      if((vertexId < 0) || (vertexId >= vertexNumber_))
+        return -1;
+#endif
+
+      if(doublePrecision_) {
+        x = ((double *)pointSet_)[3 * vertexId];
+        y = ((double *)pointSet_)[3 * vertexId + 1];
+        z = ((double *)pointSet_)[3 * vertexId + 2];
+      } else {
+        x = ((float *)pointSet_)[3 * vertexId];
+        y = ((float *)pointSet_)[3 * vertexId + 1];
+        z = ((float *)pointSet_)[3 * vertexId + 2];
+      }
+
+      return 0;
+    }
+
+    int TTK_TRIANGULATION_INTERNAL(getVertexStar)(
+      const SimplexId &vertexId,
+      const int &localStarId,
+      SimplexId &starId) const override;
+
+    SimplexId TTK_TRIANGULATION_INTERNAL(getVertexStarNumber)(
+      const SimplexId &vertexId) const override;
+
+    const std::vector<std::vector<SimplexId>> *
+      TTK_TRIANGULATION_INTERNAL(getVertexStars)() override;
+
+    int getVertexTriangleInternal(const SimplexId &vertexId,
+                                  const int &localTriangleId,
+                                  SimplexId &triangleId) const override;
+
+    SimplexId getVertexTriangleNumberInternal(
+      const SimplexId &vertexId) const override;
+
+    const std::vector<std::vector<SimplexId>> *
+      getVertexTrianglesInternal() override;
+
+    bool TTK_TRIANGULATION_INTERNAL(isEdgeOnBoundary)(
+      const SimplexId &edgeId) const override;
+
+    inline bool isEmpty() const override {
+      return !vertexNumber_;
+    }
+
+    bool TTK_TRIANGULATION_INTERNAL(isTriangleOnBoundary)(
+      const SimplexId &triangleId) const override;
+
+    bool TTK_TRIANGULATION_INTERNAL(isVertexOnBoundary)(
+      const SimplexId &vertexId) const override;
+
+    int preconditionBoundaryEdgesInternal() override;
+    int preconditionBoundaryTrianglesInternal() override;
+    int preconditionBoundaryVerticesInternal() override;
+
+    int preconditionCellEdgesInternal() override;
+    int preconditionCellNeighborsInternal() override;
+    int preconditionCellTrianglesInternal() override;
+
+    int preconditionEdgesInternal() override;
+    int preconditionEdgeLinksInternal() override;
+    int preconditionEdgeStarsInternal() override;
+    int preconditionEdgeTrianglesInternal() override;
+
+    int preconditionTrianglesInternal() override;
+    int preconditionTriangleEdgesInternal() override;
+    int preconditionTriangleLinksInternal() override;
+    int preconditionTriangleStarsInternal() override;
+
+    int preconditionVertexEdgesInternal() override;
+    int preconditionVertexLinksInternal() override;
+    int preconditionVertexNeighborsInternal() override;
+    int preconditionVertexStarsInternal() override;
+    int preconditionVertexTrianglesInternal() override;
+
+#ifdef TTK_CELL_ARRAY_NEW
+    // Layout with connectivity + offset array (new)
+    inline int setInputCells(const SimplexId &cellNumber,
+                             const LongSimplexId *connectivity,
+                             const LongSimplexId *offset) {
+      if(cellNumber_)
+        clear();
+
+      cellNumber_ = cellNumber;
+
+      if(cellNumber) {
+        cellArray_
+          = std::make_shared<CellArray>(connectivity, offset, cellNumber);
+        maxCellDim_ = cellArray_->getCellVertexNumber(0) - 1;
+      }
+      return 0;
+    }
+#else
+    // Flat layout with a single array (legacy & default one)
+    inline int setInputCells(const SimplexId &cellNumber,
+                             const LongSimplexId *cellArray) {
+      if(cellNumber_)
+        clear();
+
+      cellNumber_ = cellNumber;
+
+      if(cellNumber) {
+        // assume regular mesh here to compute dimension
+        cellArray_ = std::make_shared<CellArray>(
+          cellArray, cellNumber, cellArray[0] - 1);
+        maxCellDim_ = cellArray[0] - 1;
+      }
+      return 0;
+    }
+#endif
+
+    inline int setInputPoints(const SimplexId &pointNumber,
+                              const void *pointSet,
+                              const bool &doublePrecision = false) {
+
+      if(vertexNumber_)
+        clear();
+
+      vertexNumber_ = pointNumber;
+      pointSet_ = pointSet;
+      doublePrecision_ = doublePrecision;
+      return 0;
+    }
+
+    /// Set the targeted number of vertices per cluster (default: 1024).
+    ///
+    /// Smaller clusters are faster to (re-)compute but duplicate more cells
+    /// at their boundaries.
+    /// \warning This resets the cluster layout and the cache.
+    inline int setClusterSize(const SimplexId &clusterSize) {
+      if(clusterSize < 1)
+        return -1;
+      if(clusterSize != clusterSize_) {
+        clusterSize_ = clusterSize;
+        resetClusters();
+      }
+      return 0;
+    }
+
+    /// Set the maximum number of bytes used by the cached cluster relations
+    /// (default: 1 GiB).
+    ///
+    /// The least recently used clusters are evicted when this budget is
+    /// exceeded. Clusters being traversed, or accessed since the last
+    /// cluster or relation computation, are never evicted: the budget can
+    /// be temporarily exceeded by a few clusters. A budget smaller than the
+    /// clusters touched by a traversal makes it recompute them repeatedly.
+    int setMemoryBudget(const size_t &memoryBudget);
+
+    /// Get the number of clusters of the current layout (0 before any
+    /// pre-conditioning).
+    inline SimplexId getNumberOfClusters() const {
+      return clusterEdgeOffsets_.empty() ? 0 : clusterEdgeOffsets_.size() - 1;
+    }
+
+    /// Get the number of bytes currently used by the cached cluster
+    /// relations.
+    size_t getCacheFootprint() const;
+
+  private:
+    struct Cluster;
+    struct ClusterCache;
+
+    // relations computed on demand for each cluster (the first ones are
+    // stored in Cluster::relations)
+    enum Relation : unsigned {
+      VERTEX_NEIGHBORS = 0,
+      VERTEX_EDGES,
+      VERTEX_TRIANGLES,
+      VERTEX_LINKS,
+      EDGE_STARS,
+      EDGE_LINKS,
+      EDGE_TRIANGLES,
+      TRIANGLE_STARS,
+      TRIANGLE_LINKS,
+      TRIANGLE_EDGES,
+      CELL_EDGES,
+      CELL_TRIANGLES,
+      CELL_NEIGHBORS,
+      BOUNDARY_VERTICES,
+      BOUNDARY_EDGES,
+      BOUNDARY_TRIANGLES,
+    };
+
+    int buildClusters();
+    void resetClusters();
+    std::shared_ptr<Cluster> buildCluster(const SimplexId clusterId) const;
+    void buildRelation(Cluster &cluster, const Relation relation) const;
+
+    std::shared_ptr<Cluster> getCluster(const SimplexId clusterId) const;
+    std::shared_ptr<Cluster> getCluster(const SimplexId clusterId,
+                                        const Relation relation) const;
+
+    // cluster and local identifier of the given simplex
+    SimplexId getVertexLocalId(const SimplexId vertexId) const;
+    SimplexId getEdgeCluster(const SimplexId edgeId) const;
+    SimplexId getTriangleCluster(const SimplexId triangleId) const;
+    SimplexId getCellCluster(const SimplexId cellId) const;
+    SimplexId getCellLocalId(const Cluster &cluster,
+                             const SimplexId cellId) const;
+
+    // access to the relations of the owning cluster
+    int getVertexRelation(const Relation relation,
+                          const SimplexId vertexId,
+                          const int localId,
+                          SimplexId &id) const;
+    SimplexId getVertexRelationNumber(const Relation relation,
+                                      const SimplexId vertexId) const;
+    int getEdgeRelation(const Relation relation,
+                        const SimplexId edgeId,
+                        const int localId,
+                        SimplexId &id) const;
+    SimplexId getEdgeRelationNumber(const Relation relation,
+                                    const SimplexId edgeId) const;
+    int getTriangleRelation(const Relation relation,
+                            const SimplexId triangleId,
+                            const int localId,
+                            SimplexId &id) const;
+    SimplexId getTriangleRelationNumber(const Relation relation,
+                                        const SimplexId triangleId) const;
+    int getCellRelation(const Relation relation,
+                        const SimplexId cellId,
+                        const int localId,
+                        SimplexId &id) const;
+    SimplexId getCellRelationNumber(const Relation relation,
+                                    const SimplexId cellId) const;
+
+    // global identifiers from vertex identifiers
+    SimplexId findEdge(SimplexId v0, SimplexId v1) const;
+    SimplexId
+      findTriangle(SimplexId v0, SimplexId v1, SimplexId v2) const;
+
+    int getCellVertices(const SimplexId cellId,
+                        std::array<SimplexId, 4> &vertices) const;
+
+    using Getter = int (CompactTriangulation::*)(const SimplexId &,
+                                                  const int &,
+                                                  SimplexId &) const;
+    using Counter
+      = SimplexId (CompactTriangulation::*)(const SimplexId &) const;
+
+    const std::vector<std::vector<SimplexId>> *
+      fillList(const SimplexId number,
+               const Counter counter,
+               const Getter getter,
+               std::vector<std::vector<SimplexId>> &list) const;
+
+    bool doublePrecision_;
+    SimplexId cellNumber_, vertexNumber_, edgeNumber_, triangleNumber_;
+    const void *pointSet_;
+    int maxCellDim_;
+    std::shared_ptr<CellArray> cellArray_;
+
+    SimplexId clusterSize_{1024};
+    size_t memoryBudget_{size_t{1} << 30};
+
+    // cluster of each vertex
+    std::vector<SimplexId> vertexCluster_{};
+    // sorted vertices of each cluster
+    FlatJaggedArray clusterVertices_{};
+    // sorted cells with at least one vertex in each cluster
+    FlatJaggedArray clusterCells_{};
+    // first edge/triangle identifier of each cluster
+    std::vector<SimplexId> clusterEdgeOffsets_{};
+    std::vector<SimplexId> clusterTriangleOffsets_{};
+
+    // shared between copies (the layout is identical)
+    std::shared_ptr<ClusterCache> cache_{};
+  };
+} // namespace ttk
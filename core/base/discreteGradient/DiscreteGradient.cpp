@@ -27,6 +27,56 @@ void DiscreteGradient::initMemory(const AbstractTriangulation &triangulation) {
   dmt1Saddle2PL_.clear();
   dmt2Saddle2PL_.clear();
 
+#ifdef TTK_ENABLE_DCG_OPTIMIZE_MEMORY
+  // number of local identifiers per gradient array (facets have a fixed
+  // number of faces, cofacets are bounded by the largest star)
+  std::array<SimplexId, 6> nLocalIds{0, 2, 0, 3, 0, 4};
+  SimplexId maxVertexEdges{}, maxEdgeCofaces{}, maxTriangleStars{};
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_) \
+  reduction(max : maxVertexEdges)
+#endif // TTK_ENABLE_OPENMP
+  for(SimplexId i = 0; i < numberOfCells[0]; ++i) {
+    maxVertexEdges
+      = std::max(maxVertexEdges, triangulation.getVertexEdgeNumber(i));
+  }
+  if(dimensionality_ >= 2) {
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_) \
+  reduction(max : maxEdgeCofaces)
+#endif // TTK_ENABLE_OPENMP
+    for(SimplexId i = 0; i < numberOfCells[1]; ++i) {
+      maxEdgeCofaces = std::max(maxEdgeCofaces,
+                                dimensionality_ == 2
+                                  ? triangulation.getEdgeStarNumber(i)
+                                  : triangulation.getEdgeTriangleNumber(i));
+    }
+  }
+  if(dimensionality_ == 3) {
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_) \
+  reduction(max : maxTriangleStars)
+#endif // TTK_ENABLE_OPENMP
+    for(SimplexId i = 0; i < numberOfCells[2]; ++i) {
+      maxTriangleStars
+        = std::max(maxTriangleStars, triangulation.getTriangleStarNumber(i));
+    }
+  }
+  nLocalIds[0] = maxVertexEdges;
+  nLocalIds[2] = maxEdgeCofaces;
+  nLocalIds[4] = maxTriangleStars;
+
+  // clear & init gradient memory
+  size_t footprint{};
+  for(int i = 0; i < dimensionality_; ++i) {
+    gradient_[2 * i].clear();
+    gradient_[2 * i].resize(numberOfCells[i], nLocalIds[2 * i]);
+    gradient_[2 * i + 1].clear();
+    gradient_[2 * i + 1].resize(numberOfCells[i + 1], nLocalIds[2 * i + 1]);
+    footprint += gradient_[2 * i].footprint();
+    footprint += gradient_[2 * i + 1].footprint();
+  }
+#else
   // clear & init gradient memory
   for(int i = 0; i < dimensionality_; ++i) {
     gradient_[2 * i].clear();
@@ -34,6 +84,7 @@ void DiscreteGradient::initMemory(const AbstractTriangulation &triangulation) {
     gradient_[2 * i + 1].clear();
     gradient_[2 * i + 1].resize(numberOfCells[i + 1], -1);
   }
+#endif // TTK_ENABLE_DCG_OPTIMIZE_MEMORY
 
   std::vector<std::vector<std::string>> rows{
     {"#Vertices", std::to_string(numberOfCells[0])},
@@ -45,6 +96,11 @@ void DiscreteGradient::initMemory(const AbstractTriangulation &triangulation) {
       std::vector<std::string>{"#Tetras", std::to_string(numberOfCells[3])});
   }
 
+#ifdef TTK_ENABLE_DCG_OPTIMIZE_MEMORY
+  rows.emplace_back(std::vector<std::string>{
+    "Gradient memory", std::to_string(footprint / 1024) + " KiB"});
+#endif // TTK_ENABLE_DCG_OPTIMIZE_MEMORY
+
   this->printMsg(rows);
   this->printMsg("Initialized discrete gradient memory", 1.0,
                  tm.getElapsedTime(), this->threadNumber_);
@@ -98,6 +154,108 @@ std::pair<size_t, SimplexId>
   return res;
 }
 
+void DiscreteGradient::buildGridStencil(
+  GridStencil &stencil, const ImplicitTriangulation &triangulation) const {
+
+  stencil.nEdges_ = 0;
+  if(dimensionality_ < 2) {
+    return;
+  }
+
+  // reference interior vertex
+  const auto nverts = triangulation.getNumberOfVertices();
+  SimplexId a{-1};
+  for(SimplexId i = 0; i < nverts; ++i) {
+    if(!triangulation.isVertexOnBoundary(i)) {
+      a = i;
+      break;
+    }
+  }
+  if(a == -1) {
+    return;
+  }
+
+  const auto nEdges = triangulation.getVertexEdgeNumber(a);
+  const auto nTriangles = dimensionality_ == 2
+                            ? triangulation.getVertexStarNumber(a)
+                            : triangulation.getVertexTriangleNumber(a);
+  const auto nTetras
+    = dimensionality_ == 3 ? triangulation.getVertexStarNumber(a) : 0;
+  if(nEdges > static_cast<SimplexId>(stencil.edgeShifts_.size())
+     || nTriangles > static_cast<SimplexId>(stencil.triangleEdges_.size())
+     || nTetras > static_cast<SimplexId>(stencil.tetraEdges_.size())) {
+    return;
+  }
+
+  std::array<SimplexId, 14> neighbors{};
+  for(SimplexId i = 0; i < nEdges; ++i) {
+    SimplexId edgeId{}, v{};
+    triangulation.getVertexEdge(a, i, edgeId);
+    triangulation.getEdgeVertex(edgeId, 0, v);
+    if(v == a) {
+      triangulation.getEdgeVertex(edgeId, 1, v);
+    }
+    neighbors[i] = v;
+    stencil.edgeShifts_[i] = v - a;
+  }
+
+  // index of the star edge leading to vertex v
+  const auto edgeIndex = [&](const SimplexId v) -> uint8_t {
+    return std::find(neighbors.begin(), neighbors.begin() + nEdges, v)
+           - neighbors.begin();
+  };
+
+  for(SimplexId i = 0; i < nTriangles; ++i) {
+    std::array<SimplexId, 3> verts{};
+    SimplexId triangleId{};
+    if(dimensionality_ == 2) {
+      triangulation.getVertexStar(a, i, triangleId);
+      for(int j = 0; j < 3; ++j) {
+        triangulation.getCellVertex(triangleId, j, verts[j]);
+      }
+    } else {
+      triangulation.getVertexTriangle(a, i, triangleId);
+      for(int j = 0; j < 3; ++j) {
+        triangulation.getTriangleVertex(triangleId, j, verts[j]);
+      }
+    }
+    // same vertex order as in lowerStar
+    size_t k{};
+    for(const auto v : verts) {
+      if(v != a) {
+        stencil.triangleEdges_[i][k++] = edgeIndex(v);
+      }
+    }
+  }
+
+  for(SimplexId i = 0; i < nTetras; ++i) {
+    SimplexId tetraId{};
+    triangulation.getVertexStar(a, i, tetraId);
+    size_t k{};
+    for(int j = 0; j < 4; ++j) {
+      SimplexId v{};
+      triangulation.getCellVertex(tetraId, j, v);
+      if(v != a) {
+        stencil.tetraEdges_[i][k++] = edgeIndex(v);
+      }
+    }
+    // the three tetra faces containing a, in the star triangles order
+    const auto &te = stencil.tetraEdges_[i];
+    k = 0;
+    for(SimplexId j = 0; j < nTriangles; ++j) {
+      const auto &tr = stencil.triangleEdges_[j];
+      if(std::count(te.begin(), te.end(), tr[0])
+         && std::count(te.begin(), te.end(), tr[1])) {
+        stencil.tetraTriangles_[i][k++] = j;
+      }
+    }
+  }
+
+  stencil.nEdges_ = nEdges;
+  stencil.nTriangles_ = nTriangles;
+  stencil.nTetras_ = nTetras;
+}
+
 CriticalType
   DiscreteGradient::criticalTypeFromCellDimension(const int dim) const {
   if(dim == 0) {
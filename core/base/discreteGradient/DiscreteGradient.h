@@ -11,6 +11,11 @@
 /// %DiscreteGradient is a TTK processing package that handles discrete gradient
 /// (in the sense of Discrete Morse Theory).
 ///
+/// By default, the gradient stores one identifier per cell. Configure TTK
+/// with -DTTK_ENABLE_DCG_OPTIMIZE_MEMORY=ON (OFF by default) to bit-pack it
+/// (see dcg::PackedLocalIds): it then takes a few bits per cell, at the
+/// price of a slower gradient construction.
+///
 /// \sa ttk::Triangulation
 
 #pragma once
@@ -23,6 +28,7 @@
 #include <algorithm>
 #include <array>
 #include <functional>
+#include <limits>
 #include <queue>
 #include <set>
 #include <utility>
@@ -120,70 +126,30 @@ namespace ttk {
       explicit VPath() = default;
 
       explicit VPath(const bool isValid,
-                     const SimplexId segmentId,
                      const SimplexId source,
                      const SimplexId destination,
                      const SimplexId sourceSlot,
                      const SimplexId destinationSlot,
                      const double persistence)
-        : isValid_{isValid}, states_{1}, segments_{segmentId}, source_{source},
-          destination_{destination}, sourceSlot_{sourceSlot},
-          destinationSlot_{destinationSlot}, persistence_{persistence} {
-      }
-
-      explicit VPath(const bool isValid,
-                     const std::vector<char> &states,
-                     const std::vector<SimplexId> &segments,
-                     const SimplexId source,
-                     const SimplexId destination,
-                     const SimplexId sourceSlot,
-                     const SimplexId destinationSlot,
-                     const double persistence)
-        : isValid_{isValid}, states_{states}, segments_{segments},
-          source_{source}, destination_{destination}, sourceSlot_{sourceSlot},
-          destinationSlot_{destinationSlot}, persistence_{persistence} {
-      }
-
-      explicit VPath(const bool isValid,
-                     std::vector<char> &&states,
-                     std::vector<SimplexId> &&segments,
-                     const SimplexId source,
-                     const SimplexId destination,
-                     const SimplexId sourceSlot,
-                     const SimplexId destinationSlot,
-                     const double persistence)
-        : isValid_{isValid}, states_{states}, segments_{segments},
-          source_{source}, destination_{destination}, sourceSlot_{sourceSlot},
-          destinationSlot_{destinationSlot}, persistence_{persistence} {
+        : isValid_{isValid}, source_{source}, destination_{destination},
+          sourceSlot_{sourceSlot}, destinationSlot_{destinationSlot},
+          persistence_{persistence} {
       }
 
       /**
        * Invalidate this vpath so that it is ignored in the simplification
-       * process, free memory for economy reasons.
+       * process.
        */
       int invalidate() {
         isValid_ = false;
         source_ = -1;
         destination_ = -1;
         persistence_ = -1;
-        clear();
-
-        return 0;
-      }
-
-      /**
-       * Free internal segments' memory.
-       */
-      int clear() {
-        states_.clear();
-        segments_.clear();
 
         return 0;
       }
 
       bool isValid_{};
-      std::vector<char> states_{};
-      std::vector<SimplexId> segments_{};
       SimplexId source_{-1};
       SimplexId destination_{-1};
       SimplexId sourceSlot_{-1};
@@ -275,6 +241,44 @@ namespace ttk {
       };
     };
 
+    /**
+     * @brief Flat min-heap of (persistence, vpath id, saddle id) tuples,
+     * popped in SaddleSaddleVPathComparator order
+     */
+    template <typename dataType>
+    struct SaddleSaddleVPathGreater {
+      bool
+        operator()(const std::tuple<dataType, SimplexId, SimplexId> &v1,
+                   const std::tuple<dataType, SimplexId, SimplexId> &v2) const {
+        return SaddleSaddleVPathComparator<dataType>{}(v2, v1);
+      }
+    };
+    template <typename dataType>
+    using SaddleSaddleQueue
+      = std::priority_queue<std::tuple<dataType, SimplexId, SimplexId>,
+                            std::vector<std::tuple<dataType, SimplexId, SimplexId>>,
+                            SaddleSaddleVPathGreater<dataType>>;
+
+    /**
+     * @brief Collect the saddles met by getAscendingWall() and
+     * getDescendingWall(), in a set or in a vector (sorted and deduplicated
+     * by sortSaddles())
+     */
+    inline void insertSaddle(std::set<SimplexId> &saddles, const SimplexId id) {
+      saddles.insert(id);
+    }
+    inline void insertSaddle(std::vector<SimplexId> &saddles,
+                             const SimplexId id) {
+      saddles.emplace_back(id);
+    }
+    inline void sortSaddles(std::set<SimplexId> &) {
+    }
+    inline void sortSaddles(std::vector<SimplexId> &saddles) {
+      std::sort(saddles.begin(), saddles.end());
+      saddles.erase(
+        std::unique(saddles.begin(), saddles.end()), saddles.end());
+    }
+
     struct VisitedMask {
       std::vector<bool> &isVisited_;
       std::vector<SimplexId> &visitedIds_;
@@ -294,9 +298,110 @@ namespace ttk {
     };
 
 #ifdef TTK_ENABLE_DCG_OPTIMIZE_MEMORY
-    using gradIdType = char;
+    /**
+     * @brief Bit-packed array of local cell identifiers
+     *
+     * Stores, for every cell, the local index of its paired cell in the
+     * triangulation stencil (e.g. getVertexEdge()) or -1, on the smallest
+     * power-of-two number of bits holding the largest local index. Entries
+     * never straddle 64-bit words and writes are atomic, so neighbor cells
+     * sharing a word can be paired concurrently.
+     *
+     * Only built with -DTTK_ENABLE_DCG_OPTIMIZE_MEMORY=ON, which is OFF by
+     * default: the packed accesses make buildGradient about 1.5 times
+     * slower.
+     */
+    class PackedLocalIds {
+    public:
+      inline void clear() {
+        this->words_ = {};
+        this->size_ = 0;
+      }
+
+      /**
+       * @brief Allocate @p size entries (initialized to -1), for local
+       * indices in [0, @p nLocalIds)
+       */
+      inline void resize(const size_t size, const SimplexId nLocalIds) {
+        // stored values are local indices + 1 (0 for -1)
+        int bits{1};
+        while(bits < 32 && (SimplexId{1} << bits) <= nLocalIds) {
+          bits *= 2;
+        }
+        this->bitsLog2_ = 0;
+        while((1 << this->bitsLog2_) < bits) {
+          this->bitsLog2_++;
+        }
+        this->entriesLog2_ = 6 - this->bitsLog2_;
+        this->mask_ = (uint64_t{1} << bits) - 1;
+        this->size_ = size;
+        this->words_.resize(
+          (size + (size_t{1} << this->entriesLog2_) - 1) >> this->entriesLog2_,
+          0);
+      }
+
+      inline size_t size() const {
+        return this->size_;
+      }
+
+      /**
+       * @brief Local index of entry @p i (-1 if unpaired)
+       */
+      inline SimplexId operator[](const size_t i) const {
+        const auto word = this->words_[i >> this->entriesLog2_];
+        return static_cast<SimplexId>((word >> this->shift(i)) & this->mask_)
+               - 1;
+      }
+
+      /**
+       * @brief Set entry @p i to @p localId (-1 to unpair)
+       *
+       * Concurrent calls must target different entries. The entry is
+       * updated by a single atomic xor with the difference to its current
+       * value, so the other entries of the word are left untouched and
+       * readers never observe a partially written entry.
+       */
+      inline void set(const size_t i, const SimplexId localId) {
+        auto &word = this->words_[i >> this->entriesLog2_];
+        const auto shift = this->shift(i);
+        uint64_t current;
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp atomic read
+#endif // TTK_ENABLE_OPENMP
+        current = word;
+        const uint64_t value = static_cast<uint64_t>(localId + 1) << shift;
+        const uint64_t delta = (current & (this->mask_ << shift)) ^ value;
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp atomic
+#endif // TTK_ENABLE_OPENMP
+        word ^= delta;
+      }
+
+      /**
+       * @brief Allocated memory in bytes
+       */
+      inline size_t footprint() const {
+        return this->words_.size() * sizeof(uint64_t);
+      }
+
+    private:
+      inline int shift(const size_t i) const {
+        return (i & ((size_t{1} << this->entriesLog2_) - 1))
+               << this->bitsLog2_;
+      }
+
+      std::vector<uint64_t> words_{};
+      size_t size_{};
+      // log2 of the number of bits per entry
+      int bitsLog2_{};
+      // log2 of the number of entries per word
+      int entriesLog2_{6};
+      uint64_t mask_{1};
+    };
+
+    using gradientArrayType = PackedLocalIds;
 #else
-    using gradIdType = SimplexId;
+    using gradientArrayType = std::vector<SimplexId>;
 #endif
 
     /**
@@ -309,8 +414,85 @@ namespace ttk {
      * 4: paired tetra id per triangle
      * 5: paired triangle id per tetra
      * -1 if critical or paired to a cell of another dimension
+     *
+     * With TTK_ENABLE_DCG_OPTIMIZE_MEMORY, local indices in the
+     * triangulation stencil are stored instead of global identifiers.
      */
-    using gradientType = std::array<std::vector<gradIdType>, 6>;
+    using gradientType = std::array<gradientArrayType, 6>;
+
+    /**
+     * @brief Log of the v-path reversals of a saddle connectors
+     * filtering pass
+     *
+     * The i-th reversed v-path is stored between offsets_[i] and
+     * offsets_[i + 1] in cells_. Under a persistence threshold t, the
+     * pass performs exactly the reversals with keys_[i] <= t (the keys
+     * are the running maximum of the persistence of the processed
+     * v-paths, hence sorted).
+     */
+    struct CancellationLog {
+      std::vector<double> keys_{};
+      std::vector<Cell> cells_{};
+      std::vector<size_t> offsets_{0};
+      // number of reversals currently applied on the gradient
+      size_t applied_{};
+      // running maximum persistence while recording
+      double maxPersistence_{std::numeric_limits<double>::lowest()};
+
+      inline size_t size() const {
+        return keys_.size();
+      }
+
+      /**
+       * @brief Number of reversals performed under @p threshold
+       */
+      inline size_t count(const double threshold) const {
+        return std::upper_bound(keys_.begin(), keys_.end(), threshold)
+               - keys_.begin();
+      }
+
+      inline void push(const std::vector<Cell> &vpath) {
+        keys_.emplace_back(maxPersistence_);
+        cells_.insert(cells_.end(), vpath.begin(), vpath.end());
+        offsets_.emplace_back(cells_.size());
+        applied_ = keys_.size();
+      }
+    };
+
+    /**
+     * @brief Cancellation hierarchy of the saddle connectors
+     *
+     * Complete logs of the two filtering passes (1-saddle ascending
+     * walls, then 2-saddle descending walls) relative to the
+     * PL-conformant gradient. The second pass depends on the reversals
+     * of the first one: its log is computed on demand for the number of
+     * applied first pass reversals. Only two second pass logs are kept:
+     * the one of the last execution and the one after every first pass
+     * reversal (infinite threshold).
+     */
+    struct SaddleConnectorsHierarchy {
+      bool built_{false};
+      // contour tree critical points and PL critical types
+      std::vector<std::pair<SimplexId, char>> criticalPoints_{};
+      std::vector<char> isPL_{};
+      CancellationLog ascending_{};
+      // second pass logs (see descendingSlot()) and their number of first
+      // pass reversals (none recorded if max)
+      std::array<CancellationLog, 2> descending_{};
+      std::array<size_t, 2> descendingKeys_{
+        {std::numeric_limits<size_t>::max(),
+         std::numeric_limits<size_t>::max()}};
+      // number of first pass reversals of the applied second pass log
+      size_t appliedDescending_{};
+
+      /**
+       * @brief Slot in descending_ of the second pass log for
+       * @p nAscending first pass reversals
+       */
+      inline size_t descendingSlot(const size_t nAscending) const {
+        return nAscending == ascending_.size() ? 1 : 0;
+      }
+    };
 
     /**
      * Compute and manage a discrete gradient of a function on a triangulation.
@@ -358,6 +540,48 @@ saddle-connectors.
         return 0;
       }
 
+      /**
+       * Process the saddle connectors by increasing value of persistence until
+a given threshold is met.
+       */
+      template <typename dataType, typename triangulationType>
+      int filterSaddleConnectors(const bool allowBoundary,
+                                 const triangulationType &triangulation);
+
+      /**
+       * Same as filterSaddleConnectors() through the cancellation
+       * hierarchy of the saddle connectors: the first call records the
+       * complete hierarchy, the next ones only apply or undo the v-path
+       * reversals between the previous and the current persistence
+       * thresholds.
+       *
+       * @pre The gradient is the PL-conformant one with the reversals of
+       * @p hierarchy applied on top (none for a new hierarchy).
+       */
+      template <typename dataType, typename triangulationType>
+      int filterSaddleConnectors(SaddleConnectorsHierarchy &hierarchy,
+                                 const bool allowBoundary,
+                                 const triangulationType &triangulation);
+
+      /**
+       * @brief Initialize/Allocate discrete gradient memory
+       */
+      void initMemory(const AbstractTriangulation &triangulation);
+
+      /**
+       * Copy the current gradient into the given backup.
+       */
+      inline void backupGradient(gradientType &backup) const {
+        backup = gradient_;
+      }
+
+      /**
+       * Replace the current gradient by the given backup.
+       */
+      inline void restoreGradient(const gradientType &backup) {
+        gradient_ = backup;
+      }
+
       /**
        * Set the output data pointer to the container of the persistence pairs
        * (collecting of persistence pairs must be enabled).
@@ -396,12 +620,16 @@ according to them.
       /**
        * Compute the (saddle1, saddle2) pairs not detected by the
        * contour tree.
+       *
+       * Only the pairs of persistence greater or equal to @p
+       * minimumPersistence are returned.
        */
       template <typename dataType, typename triangulationType>
       void computeSaddleSaddlePersistencePairs(
         std::vector<std::tuple<SimplexId, SimplexId, dataType>>
           &pl_saddleSaddlePairs,
-        const triangulationType &triangulation);
+        const triangulationType &triangulation,
+        const double minimumPersistence = 0.0);
 
       /**
        * Set the input scalar function.
@@ -412,8 +640,13 @@ according to them.
 
       /**
        * Preprocess all the required connectivity requests on the triangulation.
+       *
+       * The gradient memory is also (re-)initialized, unless
+       * @p resetGradient is false (the caller then calls initMemory()
+       * before building a gradient on a new triangulation).
        */
-      inline void preconditionTriangulation(AbstractTriangulation *const data) {
+      inline void preconditionTriangulation(AbstractTriangulation *const data,
+                                            const bool resetGradient = true) {
         if(data != nullptr) {
           dimensionality_ = data->getCellVertexNumber(0) - 1;
           numberOfVertices_ = data->getNumberOfVertices();
@@ -438,7 +671,9 @@ according to them.
             // for filterSaddleConnectors
             contourTree_.preconditionTriangulation(data);
           }
-          this->initMemory(*data);
+          if(resetGradient) {
+            this->initMemory(*data);
+          }
         }
       }
 
@@ -545,22 +780,24 @@ in the gradient.
       /**
        * Return the 2-separatrice terminating at the given 2-saddle.
        */
-      template <typename triangulationType>
+      template <typename triangulationType,
+                typename saddlesType = std::set<SimplexId>>
       int getDescendingWall(const Cell &cell,
                             VisitedMask &mask,
                             const triangulationType &triangulation,
                             std::vector<Cell> *const wall = nullptr,
-                            std::set<SimplexId> *const saddles = nullptr) const;
+                            saddlesType *const saddles = nullptr) const;
 
       /**
        * Return the 2-separatrice coming from the given 1-saddle.
        */
-      template <typename triangulationType>
+      template <typename triangulationType,
+                typename saddlesType = std::set<SimplexId>>
       int getAscendingWall(const Cell &cell,
                            VisitedMask &mask,
                            const triangulationType &triangulation,
                            std::vector<Cell> *const wall = nullptr,
-                           std::set<SimplexId> *const saddles = nullptr) const;
+                           saddlesType *const saddles = nullptr) const;
 
       /**
        * Get the vertex id of with the maximum scalar field value on
@@ -657,6 +894,53 @@ in the gradient.
                             const SimplexId *const offsets,
                             const triangulationType &triangulation) const;
 
+      /**
+       * @brief Star of the interior vertices of a regular grid
+       *
+       * On implicit triangulations, the stars of the interior vertices
+       * only differ by a vertex id shift. The star edges, triangles and
+       * tetrahedra are stored once, in the triangulation local order,
+       * along with their lower vertices as indices of star edges.
+       */
+      struct GridStencil {
+        // number of star edges (0 for an invalid stencil), triangles and
+        // tetrahedra
+        size_t nEdges_{}, nTriangles_{}, nTetras_{};
+        // vertex id shift between the vertex and its star edges neighbors
+        std::array<SimplexId, 14> edgeShifts_{};
+        // star edges holding the two other vertices of the star triangles
+        std::array<std::array<uint8_t, 2>, 36> triangleEdges_{};
+        // star edges holding the three other vertices of the star tetras
+        std::array<std::array<uint8_t, 3>, 24> tetraEdges_{};
+        // star triangles that are faces of the star tetras (sorted)
+        std::array<std::array<uint8_t, 3>, 24> tetraTriangles_{};
+      };
+
+      /**
+       * @brief Build the star stencil of the interior vertices of an
+       * implicit triangulation (no-op for the other triangulation types)
+       */
+      template <typename triangulationType>
+      inline void buildGridStencil(GridStencil &,
+                                   const triangulationType &) const {
+      }
+      void buildGridStencil(GridStencil &stencil,
+                            const ImplicitTriangulation &triangulation) const;
+
+      /**
+       * @brief Same as lowerStar for the interior vertices of a regular
+       * grid
+       *
+       * The lower star is classified with bitmasks over the star stencil
+       * instead of querying the vertices of every star simplex.
+       */
+      template <typename triangulationType>
+      inline void lowerStarGrid(lowerStarType &ls,
+                                const SimplexId a,
+                                const SimplexId *const offsets,
+                                const GridStencil &stencil,
+                                const triangulationType &triangulation) const;
+
       /**
        * @brief Return the number of unpaired faces of a given cell in
        * a lower star
@@ -674,6 +958,24 @@ in the gradient.
       std::pair<size_t, SimplexId>
         numUnpairedFacesTetra(const CellExt &c, const lowerStarType &ls) const;
 
+      /**
+       * @brief Get the critical points of the contour tree with their
+       * type, for the saddle connectors filtering
+       */
+      template <typename dataType, typename triangulationType>
+      void getContourTreeCriticalPoints(
+        std::vector<std::pair<SimplexId, char>> &criticalPoints,
+        const triangulationType &triangulation);
+
+      /**
+       * @brief Apply or undo the v-path reversals of @p log until
+       * @p target of them are applied
+       */
+      template <typename triangulationType>
+      void seekCancellationLog(CancellationLog &log,
+                               const size_t target,
+                               const triangulationType &triangulation);
+
       /**
        * @brief Return the critical type corresponding to given
        * dimension
@@ -757,8 +1059,7 @@ in the gradient.
       int orderSaddleSaddleConnections1(
         const std::vector<VPath> &vpaths,
         std::vector<CriticalPoint> &criticalPoints,
-        std::set<std::tuple<dataType, SimplexId, SimplexId>,
-                 SaddleSaddleVPathComparator<dataType>> &S);
+        SaddleSaddleQueue<dataType> &S);
 
       /**
        * Core of the simplification process, modify the gradient and
@@ -771,8 +1072,7 @@ in the gradient.
         const bool allowBoundary,
         const bool allowBruteForce,
         const bool returnSaddleConnectors,
-        std::set<std::tuple<dataType, SimplexId, SimplexId>,
-                 SaddleSaddleVPathComparator<dataType>> &S,
+        SaddleSaddleQueue<dataType> &S,
         std::vector<SimplexId> &pl2dmt_saddle1,
         std::vector<SimplexId> &pl2dmt_saddle2,
         std::vector<char> &isRemovableSaddle1,
@@ -820,8 +1120,7 @@ in the gradient.
       int orderSaddleSaddleConnections2(
         const std::vector<VPath> &vpaths,
         std::vector<CriticalPoint> &criticalPoints,
-        std::set<std::tuple<dataType, SimplexId, SimplexId>,
-                 SaddleSaddleVPathComparator<dataType>> &S);
+        SaddleSaddleQueue<dataType> &S);
 
       /**
        * Core of the simplification process, modify the gradient and
@@ -834,8 +1133,7 @@ in the gradient.
         const bool allowBoundary,
         const bool allowBruteForce,
         const bool returnSaddleConnectors,
-        std::set<std::tuple<dataType, SimplexId, SimplexId>,
-                 SaddleSaddleVPathComparator<dataType>> &S,
+        SaddleSaddleQueue<dataType> &S,
         std::vector<SimplexId> &pl2dmt_saddle1,
         std::vector<SimplexId> &pl2dmt_saddle2,
         std::vector<char> &isRemovableSaddle1,
@@ -867,14 +1165,6 @@ in the gradient.
         const std::vector<std::pair<SimplexId, char>> &criticalPoints,
         std::vector<char> &isPL);
 
-      /**
-       * Process the saddle connectors by increasing value of persistence until
-a given threshold is met.
-       */
-      template <typename dataType, typename triangulationType>
-      int filterSaddleConnectors(const bool allowBoundary,
-                                 const triangulationType &triangulation);
-
       /**
        * Return true if the given cell is a minimum regarding the discrete
 gradient, false otherwise.
@@ -927,11 +1217,6 @@ gradient, false otherwise.
       int reverseDescendingPathOnWall(const std::vector<Cell> &vpath,
                                       const triangulationType &triangulation);
 
-      /**
-       * @brief Initialize/Allocate discrete gradient memory
-       */
-      void initMemory(const AbstractTriangulation &triangulation);
-
     protected:
       ftm::FTMTree contourTree_{};
 
@@ -943,6 +1228,9 @@ gradient, false otherwise.
       int dimensionality_{-1};
       SimplexId numberOfVertices_{};
       gradientType gradient_{};
+      // log of the v-path reversals of the saddle connectors filtering
+      // (recording if not null)
+      CancellationLog *cancellationLog_{};
       std::vector<SimplexId> dmtMax2PL_{};
       std::vector<SimplexId> dmt1Saddle2PL_{};
       std::vector<SimplexId> dmt2Saddle2PL_{};
@@ -400,44 +400,69 @@ int DiscreteGradient::initializeSaddleSaddleConnections1(
 
   // Part 2 : update the structures
   // apriori: by default construction, the vpaths and segments are not valid
-  std::vector<bool> isVisited(numberOfSaddle2Candidates, false);
-  std::vector<SimplexId> visitedTriangles{};
 
+  // 2.a. in parallel, get the 1-saddles linked to each 2-saddle by a
+  // single vpath (read-only on the gradient)
+  std::vector<std::vector<SimplexId>> connectedSaddles1(numberOf2Saddles);
+  std::vector<std::vector<bool>> isVisited(
+    threadNumber_, std::vector<bool>(numberOfSaddle2Candidates, false));
+  std::vector<std::vector<SimplexId>> visitedTriangles(threadNumber_);
+  std::vector<std::vector<SimplexId>> wallSaddles1(threadNumber_);
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_) schedule(dynamic)
+#endif // TTK_ENABLE_OPENMP
   for(SimplexId i = 0; i < numberOf2Saddles; ++i) {
-    const SimplexId destinationIndex = i;
-    CriticalPoint &destination = criticalPoints[destinationIndex];
-    const Cell &saddle2 = destination.cell_;
-    VisitedMask mask{isVisited, visitedTriangles};
+#ifdef TTK_ENABLE_OPENMP
+    const size_t tid = omp_get_thread_num();
+#else
+    const size_t tid = 0;
+#endif // TTK_ENABLE_OPENMP
 
-    std::set<SimplexId> saddles1;
+    const Cell &saddle2 = criticalPoints[i].cell_;
+    VisitedMask mask{isVisited[tid], visitedTriangles[tid]};
+
+    auto &saddles1 = wallSaddles1[tid];
+    saddles1.clear();
     getDescendingWall(saddle2, mask, triangulation, nullptr, &saddles1);
 
-    for(auto &saddle1Id : saddles1) {
+    for(const auto saddle1Id : saddles1) {
       if(!isRemovableSaddle1[saddle1Id]) {
         continue;
       }
 
-      const Cell &saddle1 = Cell(1, saddle1Id);
-
-      std::vector<Cell> path;
       const bool isMultiConnected = getAscendingPathThroughWall(
-        saddle1, saddle2, isVisited, &path, triangulation, true);
+        Cell(1, saddle1Id), saddle2, isVisited[tid], nullptr, triangulation,
+        true);
 
       if(!isMultiConnected) {
-        const SimplexId sourceIndex = saddle1Index[saddle1Id];
-        CriticalPoint &source = criticalPoints[sourceIndex];
+        connectedSaddles1[i].emplace_back(saddle1Id);
+      }
+    }
+  }
+
+  // 2.b. sequentially create the vpaths (deterministic identifiers)
+  for(SimplexId i = 0; i < numberOf2Saddles; ++i) {
+    const SimplexId destinationIndex = i;
+    CriticalPoint &destination = criticalPoints[destinationIndex];
+    const Cell &saddle2 = destination.cell_;
 
-        // update source and destination
-        const SimplexId sourceSlot = source.addSlot();
-        const SimplexId destinationSlot = destination.addSlot();
+    for(const auto saddle1Id : connectedSaddles1[i]) {
+      const Cell saddle1(1, saddle1Id);
 
-        // update vpath
-        const auto persistence
-          = getPersistence(saddle2, saddle1, scalars, offsets, triangulation);
+      const SimplexId sourceIndex = saddle1Index[saddle1Id];
+      CriticalPoint &source = criticalPoints[sourceIndex];
 
-        vpaths.push_back(VPath(true, -1, sourceIndex, destinationIndex,
-                               sourceSlot, destinationSlot, persistence));
-      }
+      // update source and destination
+      const SimplexId sourceSlot = source.addSlot();
+      const SimplexId destinationSlot = destination.addSlot();
+
+      // update vpath
+      const auto persistence
+        = getPersistence(saddle2, saddle1, scalars, offsets, triangulation);
+
+      vpaths.push_back(VPath(true, sourceIndex, destinationIndex, sourceSlot,
+                             destinationSlot, persistence));
     }
   }
 
@@ -483,20 +508,26 @@ template <typename dataType>
 int DiscreteGradient::orderSaddleSaddleConnections1(
   const std::vector<VPath> &vpaths,
   std::vector<CriticalPoint> &criticalPoints,
-  std::set<std::tuple<dataType, SimplexId, SimplexId>,
-           SaddleSaddleVPathComparator<dataType>> &S) {
+  SaddleSaddleQueue<dataType> &S) {
   Timer t;
 
+  std::vector<std::tuple<dataType, SimplexId, SimplexId>> queue{};
+  queue.reserve(vpaths.size());
+
   const SimplexId numberOfVPaths = vpaths.size();
   for(SimplexId i = 0; i < numberOfVPaths; ++i) {
     const VPath &vpath = vpaths[i];
 
     if(vpath.isValid_) {
       const SimplexId saddleId = criticalPoints[vpath.destination_].cell_.id_;
-      S.insert(std::make_tuple(vpath.persistence_, i, saddleId));
+      queue.emplace_back(vpath.persistence_, i, saddleId);
     }
   }
 
+  // heapify in linear time
+  S = SaddleSaddleQueue<dataType>{
+    SaddleSaddleVPathGreater<dataType>{}, std::move(queue)};
+
   this->printMsg(
     " Ordering of the vpaths", 1.0, t.getElapsedTime(), this->threadNumber_);
 
@@ -510,8 +541,7 @@ int DiscreteGradient::processSaddleSaddleConnections1(
   const bool allowBoundary,
   const bool allowBruteForce,
   const bool returnSaddleConnectors,
-  std::set<std::tuple<dataType, SimplexId, SimplexId>,
-           SaddleSaddleVPathComparator<dataType>> &S,
+  SaddleSaddleQueue<dataType> &S,
   std::vector<SimplexId> &pl2dmt_saddle1,
   std::vector<SimplexId> &pl2dmt_saddle2,
   std::vector<char> &isRemovableSaddle1,
@@ -532,21 +562,29 @@ int DiscreteGradient::processSaddleSaddleConnections1(
   std::vector<bool> isVisited(optimizedSize, false);
   std::vector<SimplexId> visitedCells{};
 
+  // buffers reused across iterations
+  std::vector<SimplexId> saddles1{}, saddles2{};
+  std::vector<Cell> path{};
+  std::vector<SimplexId> newSourceIds{}, newDestinationIds{};
+
   int numberOfIterations{};
   while(!S.empty()) {
     if(iterationThreshold >= 0 and numberOfIterations >= iterationThreshold) {
       break;
     }
 
-    auto ptr = S.begin();
-    const SimplexId vpathId = std::get<1>(*ptr);
-    S.erase(ptr);
+    const SimplexId vpathId = std::get<1>(S.top());
+    S.pop();
     VPath &vpath = vpaths[vpathId];
 
     if(vpath.isValid_) {
       if(returnSaddleConnectors) {
         const dataType persistence = vpath.persistence_;
-        if(persistence > SaddleConnectorsPersistenceThreshold) {
+        if(cancellationLog_ != nullptr) {
+          // record every reversal with the lowest threshold performing it
+          auto &key = cancellationLog_->maxPersistence_;
+          key = std::max(key, static_cast<double>(persistence));
+        } else if(persistence > SaddleConnectorsPersistenceThreshold) {
           break;
         }
       }
@@ -554,19 +592,19 @@ int DiscreteGradient::processSaddleSaddleConnections1(
       const Cell &minSaddle1 = criticalPoints[vpath.source_].cell_;
       const Cell &minSaddle2 = criticalPoints[vpath.destination_].cell_;
 
-      std::set<SimplexId> saddles1;
+      saddles1.clear();
       VisitedMask mask{isVisited, visitedCells};
       getDescendingWall(minSaddle2, mask, triangulation, nullptr, &saddles1);
 
       // check if at least one connection exists
-      auto isFound = saddles1.find(minSaddle1.id_);
-      if(isFound == saddles1.end()) {
+      if(!std::binary_search(
+           saddles1.begin(), saddles1.end(), minSaddle1.id_)) {
         ++numberOfIterations;
         continue;
       }
 
       // check if there is multiple connections
-      std::vector<Cell> path;
+      path.clear();
       const bool isMultiConnected = getAscendingPathThroughWall(
         minSaddle1, minSaddle2, isVisited, &path, triangulation, true);
 
@@ -700,6 +738,9 @@ int DiscreteGradient::processSaddleSaddleConnections1(
 
       if(vpath.isValid_) {
         reverseAscendingPathOnWall(path, triangulation);
+        if(cancellationLog_ != nullptr) {
+          cancellationLog_->push(path);
+        }
       }
     }
 
@@ -715,7 +756,7 @@ int DiscreteGradient::processSaddleSaddleConnections1(
       const SimplexId destinationId = vpath.destination_;
 
       // invalidate vpaths connected to destination
-      std::vector<SimplexId> newSourceIds;
+      newSourceIds.clear();
       CriticalPoint &destination = criticalPoints[destinationId];
       for(auto &destinationVPathId : destination.vpaths_) {
         VPath &destinationVPath = vpaths[destinationVPathId];
@@ -732,7 +773,7 @@ int DiscreteGradient::processSaddleSaddleConnections1(
 
       // invalidate vpaths connected to source and save the critical points to
       // update
-      std::vector<SimplexId> newDestinationIds;
+      newDestinationIds.clear();
       CriticalPoint &source = criticalPoints[sourceId];
       for(auto &sourceVPathId : source.vpaths_) {
         VPath &sourceVPath = vpaths[sourceVPathId];
@@ -768,16 +809,15 @@ int DiscreteGradient::processSaddleSaddleConnections1(
         CriticalPoint &newDestination = criticalPoints[newDestinationId];
         const Cell &saddle2 = newDestination.cell_;
 
-        std::set<SimplexId> saddles1;
+        saddles1.clear();
         VisitedMask mask{isVisited, visitedCells};
         getDescendingWall(saddle2, mask, triangulation, nullptr, &saddles1);
 
         for(auto &saddle1Id : saddles1) {
           const Cell saddle1(1, saddle1Id);
 
-          std::vector<Cell> path;
           const bool isMultiConnected = getAscendingPathThroughWall(
-            saddle1, saddle2, isVisited, &path, triangulation, true);
+            saddle1, saddle2, isVisited, nullptr, triangulation, true);
 
           if(isMultiConnected) {
             continue;
@@ -805,15 +845,14 @@ int DiscreteGradient::processSaddleSaddleConnections1(
             = getPersistence(saddle2, saddle1, scalars, offsets, triangulation);
 
           vpaths.push_back(VPath(
-            true, -1, newSourceId, newDestinationId, -1, -1, persistence));
+            true, newSourceId, newDestinationId, -1, -1, persistence));
 
           // update criticalPoints
           newDestination.vpaths_.push_back(newVPathId);
           newSource.vpaths_.push_back(newVPathId);
 
-          // update set
-          S.insert(
-            std::make_tuple(persistence, newVPathId, newDestination.cell_.id_));
+          // update queue
+          S.emplace(persistence, newVPathId, newDestination.cell_.id_);
         }
       }
 
@@ -822,16 +861,15 @@ int DiscreteGradient::processSaddleSaddleConnections1(
         CriticalPoint &newSource = criticalPoints[newSourceId];
         const Cell &saddle1 = newSource.cell_;
 
-        std::set<SimplexId> saddles2;
+        saddles2.clear();
         VisitedMask mask{isVisited, visitedCells};
         getAscendingWall(saddle1, mask, triangulation, nullptr, &saddles2);
 
         for(auto &saddle2Id : saddles2) {
           const Cell saddle2(2, saddle2Id);
 
-          std::vector<Cell> path;
           const bool isMultiConnected = getDescendingPathThroughWall(
-            saddle2, saddle1, isVisited, &path, triangulation, true);
+            saddle2, saddle1, isVisited, nullptr, triangulation, true);
 
           if(isMultiConnected) {
             continue;
@@ -868,15 +906,14 @@ int DiscreteGradient::processSaddleSaddleConnections1(
             = getPersistence(saddle2, saddle1, scalars, offsets, triangulation);
 
           vpaths.push_back(VPath(
-            true, -1, newSourceId, newDestinationId, -1, -1, persistence));
+            true, newSourceId, newDestinationId, -1, -1, persistence));
 
           // update criticalPoints
           newDestination.vpaths_.push_back(newVPathId);
           newSource.vpaths_.push_back(newVPathId);
 
-          // update set
-          S.insert(
-            std::make_tuple(persistence, newVPathId, newDestination.cell_.id_));
+          // update queue
+          S.emplace(persistence, newVPathId, newDestination.cell_.id_);
         }
       }
     }
@@ -924,10 +961,7 @@ int DiscreteGradient::simplifySaddleSaddleConnections1(
     dmt_criticalPoints, saddle1Index, saddle2Index, triangulation);
 
   // Part 2 : push the vpaths and order by persistence
-  SaddleSaddleVPathComparator<dataType> cmp_f;
-  std::set<std::tuple<dataType, SimplexId, SimplexId>,
-           SaddleSaddleVPathComparator<dataType>>
-    S(cmp_f);
+  SaddleSaddleQueue<dataType> S{};
   orderSaddleSaddleConnections1<dataType>(vpaths, dmt_criticalPoints, S);
 
   // Part 3 : process the vpaths
@@ -996,43 +1030,69 @@ int DiscreteGradient::initializeSaddleSaddleConnections2(
 
   // Part 2 : update the structures
   // apriori: by default construction, the vpaths and segments are not valid
-  std::vector<bool> isVisited(numberOfSaddle1Candidates, false);
-  std::vector<SimplexId> visitedEdges{};
+
+  // 2.a. in parallel, get the 2-saddles linked to each 1-saddle by a
+  // single vpath (read-only on the gradient)
+  std::vector<std::vector<SimplexId>> connectedSaddles2(numberOf1Saddles);
+  std::vector<std::vector<bool>> isVisited(
+    threadNumber_, std::vector<bool>(numberOfSaddle1Candidates, false));
+  std::vector<std::vector<SimplexId>> visitedEdges(threadNumber_);
+  std::vector<std::vector<SimplexId>> wallSaddles2(threadNumber_);
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_) schedule(dynamic)
+#endif // TTK_ENABLE_OPENMP
   for(SimplexId i = 0; i < numberOf1Saddles; ++i) {
-    const SimplexId sourceIndex = i;
-    CriticalPoint &source = criticalPoints[sourceIndex];
-    const Cell &saddle1 = source.cell_;
+#ifdef TTK_ENABLE_OPENMP
+    const size_t tid = omp_get_thread_num();
+#else
+    const size_t tid = 0;
+#endif // TTK_ENABLE_OPENMP
+
+    const Cell &saddle1 = criticalPoints[i].cell_;
+    VisitedMask mask{isVisited[tid], visitedEdges[tid]};
 
-    std::set<SimplexId> saddles2;
-    VisitedMask mask{isVisited, visitedEdges};
+    auto &saddles2 = wallSaddles2[tid];
+    saddles2.clear();
     getAscendingWall(saddle1, mask, triangulation, nullptr, &saddles2);
 
-    for(auto &saddle2Id : saddles2) {
+    for(const auto saddle2Id : saddles2) {
       if(!isRemovableSaddle2[saddle2Id]) {
         continue;
       }
 
-      const Cell &saddle2 = Cell(2, saddle2Id);
-
-      std::vector<Cell> path;
       const bool isMultiConnected = getDescendingPathThroughWall(
-        saddle2, saddle1, isVisited, &path, triangulation, true);
+        Cell(2, saddle2Id), saddle1, isVisited[tid], nullptr, triangulation,
+        true);
 
       if(!isMultiConnected) {
-        const SimplexId destinationIndex = saddle2Index[saddle2Id];
-        CriticalPoint &destination = criticalPoints[destinationIndex];
+        connectedSaddles2[i].emplace_back(saddle2Id);
+      }
+    }
+  }
 
-        // update source and destination
-        const SimplexId sourceSlot = source.addSlot();
-        const SimplexId destinationSlot = destination.addSlot();
+  // 2.b. sequentially create the vpaths (deterministic identifiers)
+  for(SimplexId i = 0; i < numberOf1Saddles; ++i) {
+    const SimplexId sourceIndex = i;
+    CriticalPoint &source = criticalPoints[sourceIndex];
+    const Cell &saddle1 = source.cell_;
 
-        // update vpath
-        const auto persistence
-          = getPersistence(saddle2, saddle1, scalars, offsets, triangulation);
+    for(const auto saddle2Id : connectedSaddles2[i]) {
+      const Cell saddle2(2, saddle2Id);
 
-        vpaths.push_back(VPath(true, -1, sourceIndex, destinationIndex,
-                               sourceSlot, destinationSlot, persistence));
-      }
+      const SimplexId destinationIndex = saddle2Index[saddle2Id];
+      CriticalPoint &destination = criticalPoints[destinationIndex];
+
+      // update source and destination
+      const SimplexId sourceSlot = source.addSlot();
+      const SimplexId destinationSlot = destination.addSlot();
+
+      // update vpath
+      const auto persistence
+        = getPersistence(saddle2, saddle1, scalars, offsets, triangulation);
+
+      vpaths.push_back(VPath(true, sourceIndex, destinationIndex, sourceSlot,
+                             destinationSlot, persistence));
     }
   }
 
@@ -1078,20 +1138,26 @@ template <typename dataType>
 int DiscreteGradient::orderSaddleSaddleConnections2(
   const std::vector<VPath> &vpaths,
   std::vector<CriticalPoint> &criticalPoints,
-  std::set<std::tuple<dataType, SimplexId, SimplexId>,
-           SaddleSaddleVPathComparator<dataType>> &S) {
+  SaddleSaddleQueue<dataType> &S) {
   Timer t;
 
+  std::vector<std::tuple<dataType, SimplexId, SimplexId>> queue{};
+  queue.reserve(vpaths.size());
+
   const SimplexId numberOfVPaths = vpaths.size();
   for(SimplexId i = 0; i < numberOfVPaths; ++i) {
     const VPath &vpath = vpaths[i];
 
     if(vpath.isValid_) {
       const SimplexId saddleId = criticalPoints[vpath.source_].cell_.id_;
-      S.insert(std::make_tuple(vpath.persistence_, i, saddleId));
+      queue.emplace_back(vpath.persistence_, i, saddleId);
     }
   }
 
+  // heapify in linear time
+  S = SaddleSaddleQueue<dataType>{
+    SaddleSaddleVPathGreater<dataType>{}, std::move(queue)};
+
   this->printMsg(
     " Ordering of the vpaths", 1.0, t.getElapsedTime(), this->threadNumber_);
 
@@ -1105,8 +1171,7 @@ int DiscreteGradient::processSaddleSaddleConnections2(
   const bool allowBoundary,
   const bool allowBruteForce,
   const bool returnSaddleConnectors,
-  std::set<std::tuple<dataType, SimplexId, SimplexId>,
-           SaddleSaddleVPathComparator<dataType>> &S,
+  SaddleSaddleQueue<dataType> &S,
   std::vector<SimplexId> &pl2dmt_saddle1,
   std::vector<SimplexId> &pl2dmt_saddle2,
   std::vector<char> &isRemovableSaddle1,
@@ -1130,21 +1195,29 @@ int DiscreteGradient::processSaddleSaddleConnections2(
   std::vector<bool> isVisited(optimizedSize, false);
   std::vector<SimplexId> visitedIds{};
 
+  // buffers reused across iterations
+  std::vector<SimplexId> saddles1{}, saddles2{};
+  std::vector<Cell> path{};
+  std::vector<SimplexId> newSourceIds{}, newDestinationIds{};
+
   int numberOfIterations{};
   while(!S.empty()) {
     if(iterationThreshold >= 0 and numberOfIterations >= iterationThreshold) {
       break;
     }
 
-    auto ptr = S.begin();
-    const SimplexId vpathId = std::get<1>(*ptr);
-    S.erase(ptr);
+    const SimplexId vpathId = std::get<1>(S.top());
+    S.pop();
     VPath &vpath = vpaths[vpathId];
 
     if(vpath.isValid_) {
       if(returnSaddleConnectors) {
         const dataType persistence = vpath.persistence_;
-        if(persistence > SaddleConnectorsPersistenceThreshold) {
+        if(cancellationLog_ != nullptr) {
+          // record every reversal with the lowest threshold performing it
+          auto &key = cancellationLog_->maxPersistence_;
+          key = std::max(key, static_cast<double>(persistence));
+        } else if(persistence > SaddleConnectorsPersistenceThreshold) {
           break;
         }
       }
@@ -1152,19 +1225,19 @@ int DiscreteGradient::processSaddleSaddleConnections2(
       const Cell &minSaddle1 = criticalPoints[vpath.source_].cell_;
       const Cell &minSaddle2 = criticalPoints[vpath.destination_].cell_;
 
-      std::set<SimplexId> saddles2;
+      saddles2.clear();
       VisitedMask mask{isVisited, visitedIds};
       getAscendingWall(minSaddle1, mask, triangulation, nullptr, &saddles2);
 
       // check if at least one connection exists
-      auto isFound = saddles2.find(minSaddle2.id_);
-      if(isFound == saddles2.end()) {
+      if(!std::binary_search(
+           saddles2.begin(), saddles2.end(), minSaddle2.id_)) {
         ++numberOfIterations;
         continue;
       }
 
       // check if there is multiple connections
-      std::vector<Cell> path;
+      path.clear();
       const bool isMultiConnected = getDescendingPathThroughWall(
         minSaddle2, minSaddle1, isVisited, &path, triangulation, true);
 
@@ -1296,6 +1369,9 @@ int DiscreteGradient::processSaddleSaddleConnections2(
 
       if(vpath.isValid_) {
         reverseDescendingPathOnWall(path, triangulation);
+        if(cancellationLog_ != nullptr) {
+          cancellationLog_->push(path);
+        }
       }
     }
 
@@ -1311,7 +1387,7 @@ int DiscreteGradient::processSaddleSaddleConnections2(
       const SimplexId destinationId = vpath.destination_;
 
       // invalidate vpaths connected to source
-      std::vector<SimplexId> newDestinationIds;
+      newDestinationIds.clear();
       CriticalPoint &source = criticalPoints[sourceId];
       for(auto &sourceVPathId : source.vpaths_) {
         VPath &sourceVPath = vpaths[sourceVPathId];
@@ -1328,7 +1404,7 @@ int DiscreteGradient::processSaddleSaddleConnections2(
 
       // invalidate vpaths connected to destination and save the critical
       // points to update
-      std::vector<SimplexId> newSourceIds;
+      newSourceIds.clear();
       CriticalPoint &destination = criticalPoints[destinationId];
       for(auto &destinationVPathId : destination.vpaths_) {
         VPath &destinationVPath = vpaths[destinationVPathId];
@@ -1364,7 +1440,7 @@ int DiscreteGradient::processSaddleSaddleConnections2(
         CriticalPoint &newSource = criticalPoints[newSourceId];
         const Cell &saddle1 = newSource.cell_;
 
-        std::set<SimplexId> saddles2;
+        saddles2.clear();
         VisitedMask mask{isVisited, visitedIds};
         getAscendingWall(saddle1, mask, triangulation, nullptr, &saddles2);
 
@@ -1401,15 +1477,14 @@ int DiscreteGradient::processSaddleSaddleConnections2(
             = getPersistence(saddle2, saddle1, scalars, offsets, triangulation);
 
           vpaths.push_back(VPath(
-            true, -1, newSourceId, newDestinationId, -1, -1, persistence));
+            true, newSourceId, newDestinationId, -1, -1, persistence));
 
           // update criticalPoints
           newDestination.vpaths_.push_back(newVPathId);
           newSource.vpaths_.push_back(newVPathId);
 
-          // update set
-          S.insert(
-            std::make_tuple(persistence, newVPathId, newSource.cell_.id_));
+          // update queue
+          S.emplace(persistence, newVPathId, newSource.cell_.id_);
         }
       }
 
@@ -1418,16 +1493,15 @@ int DiscreteGradient::processSaddleSaddleConnections2(
         CriticalPoint &newDestination = criticalPoints[newDestinationId];
         const Cell &saddle2 = newDestination.cell_;
 
-        std::set<SimplexId> saddles1;
+        saddles1.clear();
         VisitedMask mask{isVisited, visitedIds};
         getDescendingWall(saddle2, mask, triangulation, nullptr, &saddles1);
 
         for(auto &saddle1Id : saddles1) {
           const Cell saddle1(1, saddle1Id);
 
-          std::vector<Cell> path;
           const bool isMultiConnected = getAscendingPathThroughWall(
-            saddle1, saddle2, isVisited, &path, triangulation, true);
+            saddle1, saddle2, isVisited, nullptr, triangulation, true);
 
           if(isMultiConnected) {
             continue;
@@ -1463,15 +1537,14 @@ int DiscreteGradient::processSaddleSaddleConnections2(
             = getPersistence(saddle2, saddle1, scalars, offsets, triangulation);
 
           vpaths.push_back(VPath(
-            true, -1, newSourceId, newDestinationId, -1, -1, persistence));
+            true, newSourceId, newDestinationId, -1, -1, persistence));
 
           // update criticalPoints
           newDestination.vpaths_.push_back(newVPathId);
           newSource.vpaths_.push_back(newVPathId);
 
-          // update set
-          S.insert(
-            std::make_tuple(persistence, newVPathId, newSource.cell_.id_));
+          // update queue
+          S.emplace(persistence, newVPathId, newSource.cell_.id_);
         }
       }
     }
@@ -1519,10 +1592,7 @@ int DiscreteGradient::simplifySaddleSaddleConnections2(
     dmt_criticalPoints, saddle1Index, saddle2Index, triangulation);
 
   // Part 2 : push the vpaths and order by persistence
-  SaddleSaddleVPathComparator<dataType> cmp_f;
-  std::set<std::tuple<dataType, SimplexId, SimplexId>,
-           SaddleSaddleVPathComparator<dataType>>
-    S(cmp_f);
+  SaddleSaddleQueue<dataType> S{};
   orderSaddleSaddleConnections2<dataType>(vpaths, dmt_criticalPoints, S);
 
   // Part 3 : process the vpaths
@@ -1539,11 +1609,9 @@ int DiscreteGradient::simplifySaddleSaddleConnections2(
 }
 
 template <typename dataType, typename triangulationType>
-int DiscreteGradient::filterSaddleConnectors(
-  const bool allowBoundary, const triangulationType &triangulation) {
-
-  const bool allowBruteForce = false;
-  const bool returnSaddleConnectors = true;
+void DiscreteGradient::getContourTreeCriticalPoints(
+  std::vector<std::pair<SimplexId, char>> &cpset,
+  const triangulationType &triangulation) {
 
   // get the node type of a contour tree node (for compatibility with
   // ScalarFieldCriticalPoints)
@@ -1572,8 +1640,6 @@ int DiscreteGradient::filterSaddleConnectors(
     return -1;
   };
 
-  std::vector<std::pair<SimplexId, char>> cpset;
-
   const auto *const scalars = static_cast<const dataType *>(inputScalarField_);
   const auto *const offsets = inputOffsets_;
 
@@ -1593,6 +1659,17 @@ int DiscreteGradient::filterSaddleConnectors(
 
     cpset.push_back(std::make_pair(vertexId, getNodeType(node)));
   }
+}
+
+template <typename dataType, typename triangulationType>
+int DiscreteGradient::filterSaddleConnectors(
+  const bool allowBoundary, const triangulationType &triangulation) {
+
+  const bool allowBruteForce = false;
+  const bool returnSaddleConnectors = true;
+
+  std::vector<std::pair<SimplexId, char>> cpset;
+  getContourTreeCriticalPoints<dataType>(cpset, triangulation);
 
   std::vector<char> isPL;
   getCriticalPointMap(cpset, isPL);
@@ -1607,6 +1684,119 @@ int DiscreteGradient::filterSaddleConnectors(
   return 0;
 }
 
+template <typename dataType, typename triangulationType>
+int DiscreteGradient::filterSaddleConnectors(
+  SaddleConnectorsHierarchy &hierarchy,
+  const bool allowBoundary,
+  const triangulationType &triangulation) {
+
+  Timer tm{};
+
+  const bool allowBruteForce = false;
+  const bool returnSaddleConnectors = true;
+  const double threshold = SaddleConnectorsPersistenceThreshold;
+
+  if(!hierarchy.built_) {
+    getContourTreeCriticalPoints<dataType>(
+      hierarchy.criticalPoints_, triangulation);
+    getCriticalPointMap(hierarchy.criticalPoints_, hierarchy.isPL_);
+
+    // first pass under any threshold
+    cancellationLog_ = &hierarchy.ascending_;
+    simplifySaddleSaddleConnections1<dataType>(
+      hierarchy.criticalPoints_, hierarchy.isPL_, IterationThreshold,
+      allowBoundary, allowBruteForce, returnSaddleConnectors, triangulation);
+    cancellationLog_ = nullptr;
+    hierarchy.built_ = true;
+  } else {
+    // the second pass reversals were made after the first pass ones
+    const auto slot = hierarchy.descendingSlot(hierarchy.appliedDescending_);
+    if(hierarchy.descendingKeys_[slot] == hierarchy.appliedDescending_) {
+      seekCancellationLog(hierarchy.descending_[slot], 0, triangulation);
+    }
+  }
+
+  const auto nAscending = hierarchy.ascending_.count(threshold);
+  seekCancellationLog(hierarchy.ascending_, nAscending, triangulation);
+
+  // second pass under any threshold, from the current first pass
+  // reversals (replaces the unapplied log of another number of first pass
+  // reversals)
+  hierarchy.appliedDescending_ = nAscending;
+  const auto slot = hierarchy.descendingSlot(nAscending);
+  auto &descending = hierarchy.descending_[slot];
+  if(hierarchy.descendingKeys_[slot] != nAscending) {
+    descending = {};
+    hierarchy.descendingKeys_[slot] = nAscending;
+    cancellationLog_ = &descending;
+    simplifySaddleSaddleConnections2<dataType>(
+      hierarchy.criticalPoints_, hierarchy.isPL_, IterationThreshold,
+      allowBoundary, allowBruteForce, returnSaddleConnectors, triangulation);
+    cancellationLog_ = nullptr;
+  }
+  const auto nDescending = descending.count(threshold);
+  seekCancellationLog(descending, nDescending, triangulation);
+
+  this->printMsg("Saddle connectors filtered through the hierarchy ("
+                   + std::to_string(nAscending + nDescending) + "/"
+                   + std::to_string(hierarchy.ascending_.size()
+                                    + descending.size())
+                   + " reversals)",
+                 1.0, tm.getElapsedTime(), this->threadNumber_);
+
+  return 0;
+}
+
+template <typename triangulationType>
+void DiscreteGradient::seekCancellationLog(
+  CancellationLog &log,
+  const size_t target,
+  const triangulationType &triangulation) {
+
+  std::vector<Cell> vpath{}, shifted{};
+
+  while(log.applied_ < target) {
+    const auto i = log.applied_++;
+    vpath.assign(log.cells_.begin() + log.offsets_[i],
+                 log.cells_.begin() + log.offsets_[i + 1]);
+    if(vpath.front().dim_ == 1) {
+      reverseAscendingPathOnWall(vpath, triangulation);
+    } else {
+      reverseDescendingPathOnWall(vpath, triangulation);
+    }
+  }
+
+  while(log.applied_ > target) {
+    const auto i = --log.applied_;
+    vpath.assign(log.cells_.begin() + log.offsets_[i],
+                 log.cells_.begin() + log.offsets_[i + 1]);
+
+    // the reversal paired every cell with the next one in the v-path:
+    // pair them back with the previous one, the two ends are critical
+    shifted.clear();
+    for(size_t j = 1; j + 1 < vpath.size(); j += 2) {
+      shifted.emplace_back(vpath[j + 1]);
+      shifted.emplace_back(vpath[j]);
+    }
+    if(vpath.front().dim_ == 1) {
+      reverseAscendingPathOnWall(shifted, triangulation);
+    } else {
+      reverseDescendingPathOnWall(shifted, triangulation);
+    }
+
+    const auto &edge = vpath.front().dim_ == 1 ? vpath.front() : vpath.back();
+    const auto &triangle
+      = vpath.front().dim_ == 1 ? vpath.back() : vpath.front();
+#ifdef TTK_ENABLE_DCG_OPTIMIZE_MEMORY
+    gradient_[2].set(edge.id_, -1);
+    gradient_[3].set(triangle.id_, -1);
+#else
+    gradient_[2][edge.id_] = -1;
+    gradient_[3][triangle.id_] = -1;
+#endif // TTK_ENABLE_DCG_OPTIMIZE_MEMORY
+  }
+}
+
 template <typename dataType, typename triangulationType>
 int DiscreteGradient::reverseGradient(const triangulationType &triangulation,
                                       bool detectCriticalPoints) {
@@ -1690,7 +1880,8 @@ int DiscreteGradient::reverseGradient(const triangulationType &triangulation,
 template <typename dataType, typename triangulationType>
 void DiscreteGradient::computeSaddleSaddlePersistencePairs(
   std::vector<std::tuple<SimplexId, SimplexId, dataType>> &pl_saddleSaddlePairs,
-  const triangulationType &triangulation) {
+  const triangulationType &triangulation,
+  const double minimumPersistence) {
 
   const dataType *scalars = static_cast<const dataType *>(inputScalarField_);
 
@@ -1713,7 +1904,8 @@ void DiscreteGradient::computeSaddleSaddlePersistencePairs(
     const SimplexId v1 = this->getCellGreaterVertex(pair[1], triangulation);
     const dataType persistence = scalars[v1] - scalars[v0];
 
-    if(v0 != -1 and v1 != -1 and persistence >= 0) {
+    if(v0 != -1 and v1 != -1 and persistence >= 0
+       and static_cast<double>(persistence) >= minimumPersistence) {
       if(!triangulation.isVertexOnBoundary(v0)
          or !triangulation.isVertexOnBoundary(v1)) {
         pl_saddleSaddlePairs.emplace_back(v0, v1, persistence);
@@ -1914,11 +2106,100 @@ inline void
   return;
 }
 
+template <typename triangulationType>
+inline void DiscreteGradient::lowerStarGrid(
+  lowerStarType &ls,
+  const SimplexId a,
+  const SimplexId *const offsets,
+  const GridStencil &stencil,
+  const triangulationType &triangulation) const {
+
+  // make sure that ls is cleared
+  for(auto &vec : ls) {
+    vec.clear();
+  }
+
+  // a belongs to its lower star
+  ls[0].emplace_back(CellExt{0, a});
+
+  // gather the neighbors offsets and classify them in a bitmask
+  // (fixed-size branchless loop)
+  std::array<SimplexId, 14> neighbors{};
+  uint32_t lower{};
+  const auto offA = offsets[a];
+  for(size_t i = 0; i < stencil.nEdges_; ++i) {
+    neighbors[i] = a + stencil.edgeShifts_[i];
+    lower |= static_cast<uint32_t>(offsets[neighbors[i]] < offA) << i;
+  }
+
+  // store lower edges, keep their indices in ls[1]
+  std::array<uint8_t, 14> edgeRank{};
+  for(size_t i = 0; i < stencil.nEdges_; ++i) {
+    if(lower & (1U << i)) {
+      SimplexId edgeId;
+      triangulation.getVertexEdge(a, i, edgeId);
+      edgeRank[i] = ls[1].size();
+      ls[1].emplace_back(CellExt{1, edgeId, {neighbors[i]}, {}});
+    }
+  }
+
+  if(ls[1].size() < 2) {
+    // at least two edges in the lower star for one triangle
+    return;
+  }
+
+  // store lower triangles (star triangles with two lower vertices)
+  std::array<uint8_t, 36> triangleRank{};
+  for(size_t i = 0; i < stencil.nTriangles_; ++i) {
+    const auto &e = stencil.triangleEdges_[i];
+    if(!(lower & (1U << e[0])) || !(lower & (1U << e[1]))) {
+      continue;
+    }
+    SimplexId triangleId;
+    if(dimensionality_ == 2) {
+      triangulation.getVertexStar(a, i, triangleId);
+    } else {
+      triangulation.getVertexTriangle(a, i, triangleId);
+    }
+    // faces in the ls[1] order
+    const auto r0 = edgeRank[e[0]];
+    const auto r1 = edgeRank[e[1]];
+    triangleRank[i] = ls[2].size();
+    ls[2].emplace_back(CellExt{
+      2,
+      triangleId,
+      {neighbors[e[0]], neighbors[e[1]]},
+      {std::min(r0, r1), std::max(r0, r1)}});
+  }
+
+  // at least three triangles in the lower star for one tetra
+  if(ls[2].size() < 3) {
+    return;
+  }
+
+  // store lower tetra (star tetras with three lower vertices)
+  for(size_t i = 0; i < stencil.nTetras_; ++i) {
+    const auto &e = stencil.tetraEdges_[i];
+    if(!(lower & (1U << e[0])) || !(lower & (1U << e[1]))
+       || !(lower & (1U << e[2]))) {
+      continue;
+    }
+    SimplexId cellId;
+    triangulation.getVertexStar(a, i, cellId);
+    const auto &t = stencil.tetraTriangles_[i];
+    ls[3].emplace_back(CellExt{
+      3,
+      cellId,
+      {neighbors[e[0]], neighbors[e[1]], neighbors[e[2]]},
+      {triangleRank[t[0]], triangleRank[t[1]], triangleRank[t[2]]}});
+  }
+}
+
 template <typename triangulationType>
 inline void DiscreteGradient::pairCells(
   CellExt &alpha, CellExt &beta, const triangulationType &triangulation) {
 #ifdef TTK_ENABLE_DCG_OPTIMIZE_MEMORY
-  char localBId{0}, localAId{0};
+  SimplexId localBId{0}, localAId{0};
   SimplexId a{}, b{};
 
   if(beta.dim_ == 1) {
@@ -1939,15 +2220,26 @@ inline void DiscreteGradient::pairCells(
     }
   } else if(beta.dim_ == 2) {
     for(SimplexId i = 0; i < 3; ++i) {
-      triangulation.getTriangleEdge(beta.id_, i, a);
+      if(dimensionality_ == 2) {
+        triangulation.getCellEdge(beta.id_, i, a);
+      } else {
+        triangulation.getTriangleEdge(beta.id_, i, a);
+      }
       if(a == alpha.id_) {
         localAId = i;
         break;
       }
     }
-    const auto ntri = triangulation.getEdgeTriangleNumber(alpha.id_);
+    // same stencil as getPairedCell (edge stars in 2D)
+    const auto ntri = dimensionality_ == 2
+                        ? triangulation.getEdgeStarNumber(alpha.id_)
+                        : triangulation.getEdgeTriangleNumber(alpha.id_);
     for(SimplexId i = 0; i < ntri; ++i) {
-      triangulation.getEdgeTriangle(alpha.id_, i, b);
+      if(dimensionality_ == 2) {
+        triangulation.getEdgeStar(alpha.id_, i, b);
+      } else {
+        triangulation.getEdgeTriangle(alpha.id_, i, b);
+      }
       if(b == beta.id_) {
         localBId = i;
       }
@@ -1968,8 +2260,8 @@ inline void DiscreteGradient::pairCells(
       }
     }
   }
-  gradient_[2 * alpha.dim_][alpha.id_] = localBId;
-  gradient_[2 * alpha.dim_ + 1][beta.id_] = localAId;
+  gradient_[2 * alpha.dim_].set(alpha.id_, localBId);
+  gradient_[2 * alpha.dim_ + 1].set(beta.id_, localAId);
 #else
   gradient_[2 * alpha.dim_][alpha.id_] = beta.id_;
   gradient_[2 * alpha.dim_ + 1][beta.id_] = alpha.id_;
@@ -1984,8 +2276,6 @@ int DiscreteGradient::processLowerStars(
 
   /* Compute gradient */
 
-  auto nverts = triangulation.getNumberOfVertices();
-
   // Comparison function for Cells inside priority queues
   const auto orderCells = [&](const CellExt &a, const CellExt &b) -> bool {
     if(a.dim_ == b.dim_) {
@@ -2066,119 +2356,132 @@ int DiscreteGradient::processLowerStars(
   // store lower star structure
   lowerStarType Lx;
 
+  // star stencil of the interior vertices of regular grids
+  GridStencil stencil{};
+  this->buildGridStencil(stencil, triangulation);
+
+  // cache-friendly traversal (bricks on regular grids)
+  const auto blocks = triangulation.getVertexBlocks();
+
 #ifdef TTK_ENABLE_OPENMP
 #pragma omp parallel for num_threads(threadNumber_) \
   firstprivate(Lx, pqZero, pqOne)
 #endif // TTK_ENABLE_OPENMP
-  for(SimplexId x = 0; x < nverts; x++) {
-
-    // clear priority queues (they should be empty at the end of the
-    // previous iteration)
-    while(!pqZero.empty()) {
-      pqZero.pop();
-    }
-    while(!pqOne.empty()) {
-      pqOne.pop();
-    }
-
-    // Insert into pqOne cofacets of cell c_alpha such as numUnpairedFaces == 1
-    const auto insertCofacets = [&](const CellExt &ca, lowerStarType &ls) {
-      if(ca.dim_ == 1) {
-        for(auto &beta : ls[2]) {
-          if(ls[1][beta.faces_[0]].id_ == ca.id_
-             || ls[1][beta.faces_[1]].id_ == ca.id_) {
-            // edge ca belongs to triangle beta
-            if(numUnpairedFacesTriangle(beta, ls).first == 1) {
-              pqOne.push(beta);
+  for(SimplexId block = 0; block < blocks.size(); block++) {
+    blocks.forEach(block, [&](const SimplexId x) {
+      // clear priority queues (they should be empty at the end of the
+      // previous iteration)
+      while(!pqZero.empty()) {
+        pqZero.pop();
+      }
+      while(!pqOne.empty()) {
+        pqOne.pop();
+      }
+
+      // Insert into pqOne cofacets of cell c_alpha such as
+      // numUnpairedFaces == 1
+      const auto insertCofacets = [&](const CellExt &ca, lowerStarType &ls) {
+        if(ca.dim_ == 1) {
+          for(auto &beta : ls[2]) {
+            if(ls[1][beta.faces_[0]].id_ == ca.id_
+               || ls[1][beta.faces_[1]].id_ == ca.id_) {
+              // edge ca belongs to triangle beta
+              if(numUnpairedFacesTriangle(beta, ls).first == 1) {
+                pqOne.push(beta);
+              }
             }
           }
-        }
 
-      } else if(ca.dim_ == 2) {
-        for(auto &beta : ls[3]) {
-          if(ls[2][beta.faces_[0]].id_ == ca.id_
-             || ls[2][beta.faces_[1]].id_ == ca.id_
-             || ls[2][beta.faces_[2]].id_ == ca.id_) {
-            // triangle ca belongs to tetra beta
-            if(numUnpairedFacesTetra(beta, ls).first == 1) {
-              pqOne.push(beta);
+        } else if(ca.dim_ == 2) {
+          for(auto &beta : ls[3]) {
+            if(ls[2][beta.faces_[0]].id_ == ca.id_
+               || ls[2][beta.faces_[1]].id_ == ca.id_
+               || ls[2][beta.faces_[2]].id_ == ca.id_) {
+              // triangle ca belongs to tetra beta
+              if(numUnpairedFacesTetra(beta, ls).first == 1) {
+                pqOne.push(beta);
+              }
             }
           }
         }
-      }
-    };
+      };
 
-    lowerStar(Lx, x, offsets, triangulation);
+      if(stencil.nEdges_ > 0 && !triangulation.isVertexOnBoundary(x)) {
+        lowerStarGrid(Lx, x, offsets, stencil, triangulation);
+      } else {
+        lowerStar(Lx, x, offsets, triangulation);
+      }
 
-    // Lx[1] empty => x is a local minimum
+      // Lx[1] empty => x is a local minimum
 
-    if(!Lx[1].empty()) {
-      // get delta: 1-cell (edge) with minimal G value (steeper gradient)
-      size_t minId = 0;
-      for(size_t i = 1; i < Lx[1].size(); ++i) {
-        const auto &a = Lx[1][minId].lowVerts_[0];
-        const auto &b = Lx[1][i].lowVerts_[0];
-        if(offsets[a] > offsets[b]) {
-          // edge[i] < edge[0]
-          minId = i;
+      if(!Lx[1].empty()) {
+        // get delta: 1-cell (edge) with minimal G value (steeper gradient)
+        size_t minId = 0;
+        for(size_t i = 1; i < Lx[1].size(); ++i) {
+          const auto &a = Lx[1][minId].lowVerts_[0];
+          const auto &b = Lx[1][i].lowVerts_[0];
+          if(offsets[a] > offsets[b]) {
+            // edge[i] < edge[0]
+            minId = i;
+          }
         }
-      }
 
-      auto &c_delta = Lx[1][minId];
+        auto &c_delta = Lx[1][minId];
 
-      // store x (0-cell) -> delta (1-cell) V-path
-      pairCells(Lx[0][0], c_delta, triangulation);
+        // store x (0-cell) -> delta (1-cell) V-path
+        pairCells(Lx[0][0], c_delta, triangulation);
 
-      // push every 1-cell in Lx that is not delta into pqZero
-      for(auto &alpha : Lx[1]) {
-        if(alpha.id_ != c_delta.id_) {
-          pqZero.push(alpha);
+        // push every 1-cell in Lx that is not delta into pqZero
+        for(auto &alpha : Lx[1]) {
+          if(alpha.id_ != c_delta.id_) {
+            pqZero.push(alpha);
+          }
         }
-      }
 
-      // push into pqOne every coface of delta in Lx (2-cells only,
-      // 3-cells have not any facet paired yet) such that
-      // numUnpairedFaces == 1
-      insertCofacets(c_delta, Lx);
-
-      while(!pqOne.empty() || !pqZero.empty()) {
-        while(!pqOne.empty()) {
-          auto &c_alpha = pqOne.top().get();
-          pqOne.pop();
-          auto unpairedFaces = numUnpairedFaces(c_alpha, Lx);
-          if(unpairedFaces.first == 0) {
-            pqZero.push(c_alpha);
-          } else {
-            auto &c_pair_alpha = Lx[c_alpha.dim_ - 1][unpairedFaces.second];
+        // push into pqOne every coface of delta in Lx (2-cells only,
+        // 3-cells have not any facet paired yet) such that
+        // numUnpairedFaces == 1
+        insertCofacets(c_delta, Lx);
+
+        while(!pqOne.empty() || !pqZero.empty()) {
+          while(!pqOne.empty()) {
+            auto &c_alpha = pqOne.top().get();
+            pqOne.pop();
+            auto unpairedFaces = numUnpairedFaces(c_alpha, Lx);
+            if(unpairedFaces.first == 0) {
+              pqZero.push(c_alpha);
+            } else {
+              auto &c_pair_alpha = Lx[c_alpha.dim_ - 1][unpairedFaces.second];
 
-            // store (pair_alpha) -> (alpha) V-path
-            pairCells(c_pair_alpha, c_alpha, triangulation);
+              // store (pair_alpha) -> (alpha) V-path
+              pairCells(c_pair_alpha, c_alpha, triangulation);
 
-            // add cofaces of c_alpha and c_pair_alpha to pqOne
-            insertCofacets(c_alpha, Lx);
-            insertCofacets(c_pair_alpha, Lx);
+              // add cofaces of c_alpha and c_pair_alpha to pqOne
+              insertCofacets(c_alpha, Lx);
+              insertCofacets(c_pair_alpha, Lx);
+            }
           }
-        }
 
-        // skip pair_alpha from pqZero:
-        // cells in pqZero are not critical if already paired
-        while(!pqZero.empty() && pqZero.top().get().paired_) {
-          pqZero.pop();
-        }
+          // skip pair_alpha from pqZero:
+          // cells in pqZero are not critical if already paired
+          while(!pqZero.empty() && pqZero.top().get().paired_) {
+            pqZero.pop();
+          }
 
-        if(!pqZero.empty()) {
-          auto &c_gamma = pqZero.top().get();
-          pqZero.pop();
+          if(!pqZero.empty()) {
+            auto &c_gamma = pqZero.top().get();
+            pqZero.pop();
 
-          // gamma is a critical cell
-          // mark gamma as paired
-          c_gamma.paired_ = true;
+            // gamma is a critical cell
+            // mark gamma as paired
+            c_gamma.paired_ = true;
 
-          // add cofacets of c_gamma to pqOne
-          insertCofacets(c_gamma, Lx);
+            // add cofacets of c_gamma to pqOne
+            insertCofacets(c_gamma, Lx);
+          }
         }
       }
-    }
+    });
   }
 
   return 0;
@@ -2768,13 +3071,13 @@ bool DiscreteGradient::getAscendingPathThroughWall(
   return false;
 }
 
-template <typename triangulationType>
+template <typename triangulationType, typename saddlesType>
 int DiscreteGradient::getDescendingWall(
   const Cell &cell,
   VisitedMask &mask,
   const triangulationType &triangulation,
   std::vector<Cell> *const wall,
-  std::set<SimplexId> *const saddles) const {
+  saddlesType *const saddles) const {
 
   if(dimensionality_ == 3) {
     if(cell.dim_ == 2) {
@@ -2803,7 +3106,7 @@ int DiscreteGradient::getDescendingWall(
             triangulation.getTriangleEdge(triangleId, j, edgeId);
 
             if((saddles != nullptr) and isSaddle1(Cell(1, edgeId))) {
-              saddles->insert(edgeId);
+              insertSaddle(*saddles, edgeId);
             }
 
             const SimplexId pairedCellId
@@ -2815,19 +3118,23 @@ int DiscreteGradient::getDescendingWall(
           }
         }
       }
+
+      if(saddles != nullptr) {
+        sortSaddles(*saddles);
+      }
     }
   }
 
   return 0;
 }
 
-template <typename triangulationType>
+template <typename triangulationType, typename saddlesType>
 int DiscreteGradient::getAscendingWall(
   const Cell &cell,
   VisitedMask &mask,
   const triangulationType &triangulation,
   std::vector<Cell> *const wall,
-  std::set<SimplexId> *const saddles) const {
+  saddlesType *const saddles) const {
 
   if(dimensionality_ == 3) {
     if(cell.dim_ == 1) {
@@ -2858,7 +3165,7 @@ int DiscreteGradient::getAscendingWall(
             triangulation.getEdgeTriangle(edgeId, j, triangleId);
 
             if((saddles != nullptr) and isSaddle2(Cell(2, triangleId))) {
-              saddles->insert(triangleId);
+              insertSaddle(*saddles, triangleId);
             }
 
             const SimplexId pairedCellId
@@ -2870,6 +3177,10 @@ int DiscreteGradient::getAscendingWall(
           }
         }
       }
+
+      if(saddles != nullptr) {
+        sortSaddles(*saddles);
+      }
     }
   }
 
@@ -2892,7 +3203,7 @@ int DiscreteGradient::reverseAscendingPath(
         SimplexId tmp;
         triangulation.getCellEdge(triangleId, k, tmp);
         if(tmp == edgeId) {
-          gradient_[3][triangleId] = k;
+          gradient_[3].set(triangleId, k);
           break;
         }
       }
@@ -2900,7 +3211,7 @@ int DiscreteGradient::reverseAscendingPath(
         SimplexId tmp;
         triangulation.getEdgeStar(edgeId, k, tmp);
         if(tmp == triangleId) {
-          gradient_[2][edgeId] = k;
+          gradient_[2].set(edgeId, k);
           break;
         }
       }
@@ -2921,7 +3232,7 @@ int DiscreteGradient::reverseAscendingPath(
         SimplexId tmp;
         triangulation.getCellTriangle(tetraId, k, tmp);
         if(tmp == triangleId) {
-          gradient_[5][tetraId] = k;
+          gradient_[5].set(tetraId, k);
           break;
         }
       }
@@ -2929,7 +3240,7 @@ int DiscreteGradient::reverseAscendingPath(
         SimplexId tmp;
         triangulation.getTriangleStar(triangleId, k, tmp);
         if(tmp == tetraId) {
-          gradient_[4][triangleId] = k;
+          gradient_[4].set(triangleId, k);
           break;
         }
       }
@@ -2953,21 +3264,20 @@ int DiscreteGradient::reverseDescendingPath(
     const SimplexId vertId = vpath[i + 1].id_;
 
 #ifdef TTK_ENABLE_DCG_OPTIMIZE_MEMORY
-    const auto nneighs = triangulation.getVertexEdgeNumber();
+    const auto nneighs = triangulation.getVertexEdgeNumber(vertId);
     for(int k = 0; k < nneighs; ++k) {
       SimplexId tmp;
       triangulation.getVertexEdge(vertId, k, tmp);
       if(tmp == edgeId) {
-        gradient_[0][vertId] = k;
+        gradient_[0].set(vertId, k);
         break;
       }
     }
-    const auto nverts = triangulation.getEdgeStarNumber(edgeId);
-    for(int k = 0; k < nverts; ++k) {
+    for(int k = 0; k < 2; ++k) {
       SimplexId tmp;
       triangulation.getEdgeVertex(edgeId, k, tmp);
       if(tmp == vertId) {
-        gradient_[1][edgeId] = k;
+        gradient_[1].set(edgeId, k);
         break;
       }
     }
@@ -2996,7 +3306,7 @@ int DiscreteGradient::reverseAscendingPathOnWall(
         SimplexId tmp;
         triangulation.getTriangleEdge(triangleId, k, tmp);
         if(tmp == edgeId) {
-          gradient_[3][triangleId] = k;
+          gradient_[3].set(triangleId, k);
           break;
         }
       }
@@ -3004,7 +3314,7 @@ int DiscreteGradient::reverseAscendingPathOnWall(
         SimplexId tmp;
         triangulation.getEdgeTriangle(edgeId, k, tmp);
         if(tmp == triangleId) {
-          gradient_[2][edgeId] = k;
+          gradient_[2].set(edgeId, k);
           break;
         }
       }
@@ -3034,7 +3344,7 @@ int DiscreteGradient::reverseDescendingPathOnWall(
         SimplexId tmp;
         triangulation.getTriangleEdge(triangleId, k, tmp);
         if(tmp == edgeId) {
-          gradient_[3][triangleId] = k;
+          gradient_[3].set(triangleId, k);
           break;
         }
       }
@@ -3042,7 +3352,7 @@ int DiscreteGradient::reverseDescendingPathOnWall(
         SimplexId tmp;
         triangulation.getEdgeTriangle(edgeId, k, tmp);
         if(tmp == triangleId) {
-          gradient_[2][edgeId] = k;
+          gradient_[2].set(edgeId, k);
           break;
         }
       }
@@ -0,0 +1,5 @@
+#include <DiscreteMorseSandwich.h>
+
+ttk::DiscreteMorseSandwich::DiscreteMorseSandwich() {
+  this->setDebugMsgPrefix("DiscreteMorseSandwich");
+}
@@ -0,0 +1,814 @@
+/// \ingroup base
+/// \class ttk::DiscreteMorseSandwich
+/// \date October 2026.
+///
+/// \brief TTK processing package for the computation of the persistence
+/// pairs of all dimensions from a discrete gradient.
+///
+/// The persistence pairs are computed on the Morse complex of the discrete
+/// gradient of the lower-star filtration (see ttk::dcg::DiscreteGradient),
+/// whose critical cells are much fewer than the simplices of the input
+/// triangulation. The gradient pairs play the role of the apparent pairs of
+/// the filtration: they are removed before any reduction takes place.
+///
+/// 1) the minimum-saddle pairs (D0) are obtained by tracking the minima
+/// connected to each 1-saddle in the order of the filtration (union-find
+/// on the 1-skeleton of the Morse complex),
+///
+/// 2) the saddle-maximum pairs (D1 in 2D, D2 in 3D) are obtained likewise
+/// on the dual graph, processing the (d-1)-saddles in the reverse order of
+/// the filtration (the boundary of the domain is a virtual maximum),
+///
+/// 3) in 3D, the saddle-saddle pairs (D1) are obtained by reducing the
+/// Morse boundary matrix of the remaining 2-saddles, restricted to the
+/// remaining 1-saddles: the 2-saddles paired in D2 have a null reduced
+/// column (clearing) and the 1-saddles paired in D0 cannot be a pivot
+/// (compression).
+///
+/// The gradient paths (D0, D2) and the Morse boundaries (D1) are computed
+/// in parallel, with thread-local buffers only. The union-find and the
+/// column reduction then run sequentially on the (small) Morse complex.
+///
+/// \b Related \b publication \n
+/// "Discrete Morse Sandwich: Fast Computation of Persistence Diagrams for
+/// Scalar Data -- An Algorithm and A Benchmark" \n
+/// Pierre Guillou, Jules Vidal, Julien Tierny \n
+/// IEEE Transactions on Visualization and Computer Graphics, 2023
+///
+/// \sa ttk::PersistenceDiagram
+
+#pragma once
+
+// base code includes
+#include <DiscreteGradient.h>
+#include <OrderDisambiguation.h>
+
+#include <algorithm>
+#include <array>
+#include <unordered_map>
+#include <vector>
+
+namespace ttk {
+
+  class DiscreteMorseSandwich : virtual public Debug {
+
+  public:
+    DiscreteMorseSandwich();
+
+    /**
+     * @brief Persistence pair of critical cells
+     */
+    struct PersistencePair {
+      /** critical cell of dimension type that creates the class */
+      SimplexId birth;
+      /** critical cell of dimension type + 1 that kills the class (-1 if
+          the class is never killed) */
+      SimplexId death;
+      /** pair type (dimension of the birth cell) */
+      int type;
+
+      PersistencePair(const SimplexId b, const SimplexId d, const int t)
+        : birth{b}, death{d}, type{t} {
+      }
+    };
+
+    inline void preconditionTriangulation(AbstractTriangulation *const data) {
+      this->dg_.setDebugLevel(this->debugLevel_);
+      this->dg_.setThreadNumber(this->threadNumber_);
+      this->dg_.preconditionTriangulation(data);
+    }
+
+    /**
+     * @brief Compute the persistence pairs of all dimensions
+     *
+     * @param[out] pairs persistence pairs of critical cells
+     * @param[in] offsets order array of the input scalar field
+     * @param[in] triangulation preconditioned triangulation (2D or 3D)
+     */
+    template <typename triangulationType>
+    inline int computePersistencePairs(std::vector<PersistencePair> &pairs,
+                                       const SimplexId *const offsets,
+                                       const triangulationType &triangulation) {
+      // the offsets stand for the scalar field, nothing is filtered
+      return this->computePersistencePairs(
+        pairs, offsets, triangulation, offsets, 0.0);
+    }
+
+    /**
+     * @brief Compute the persistence pairs of all dimensions whose
+     * persistence is greater or equal to a threshold
+     *
+     * The pairs of the global minimum are always kept. The reduction of
+     * the saddle-saddle pairs is skipped if none of them can reach the
+     * threshold.
+     *
+     * @param[out] pairs persistence pairs of critical cells
+     * @param[in] offsets order array of the input scalar field
+     * @param[in] triangulation preconditioned triangulation (2D or 3D)
+     * @param[in] scalars input scalar field
+     * @param[in] minimumPersistence persistence threshold
+     */
+    template <typename scalarType, typename triangulationType>
+    int computePersistencePairs(std::vector<PersistencePair> &pairs,
+                                const SimplexId *const offsets,
+                                const triangulationType &triangulation,
+                                const scalarType *const scalars,
+                                const double minimumPersistence);
+
+    /**
+     * @brief Get the vertex of highest order of a critical cell
+     */
+    template <typename triangulationType>
+    inline SimplexId
+      getCellGreaterVertex(const dcg::Cell &cell,
+                           const triangulationType &triangulation) const {
+      return this->dg_.getCellGreaterVertex(cell, triangulation);
+    }
+
+  protected:
+    /**
+     * Position of a cell in the lower-star filtration: the offsets of its
+     * vertices in decreasing order (padded with -1)
+     */
+    using CellKey = std::array<SimplexId, 4>;
+
+    /**
+     * Thread-local buffers of the Morse boundary computation
+     */
+    struct WallBuffers {
+      std::unordered_map<SimplexId, SimplexId> localIds{};
+      std::vector<SimplexId> triangles{};
+      std::vector<std::array<SimplexId, 3>> successors{};
+      std::vector<SimplexId> inDegree{};
+      std::vector<char> parity{};
+      std::vector<SimplexId> stack{};
+    };
+
+    template <typename triangulationType>
+    CellKey getCellKey(const int dim,
+                       const SimplexId id,
+                       const SimplexId *const offsets,
+                       const triangulationType &triangulation) const;
+
+    /**
+     * Get the critical cells of dimension @p dim, by increasing identifier
+     */
+    template <typename triangulationType>
+    void getCriticalCells(const int dim,
+                          std::vector<SimplexId> &cells,
+                          const triangulationType &triangulation) const;
+
+    /**
+     * Sort critical cells of dimension @p dim along the filtration
+     */
+    template <typename triangulationType>
+    void sortCriticalCells(const int dim,
+                           std::vector<SimplexId> &cells,
+                           const SimplexId *const offsets,
+                           const triangulationType &triangulation) const;
+
+    /**
+     * Follow the descending gradient path of a vertex to a minimum
+     */
+    template <typename triangulationType>
+    SimplexId getDescendingMinimum(SimplexId vertex,
+                                   const triangulationType &triangulation) const;
+
+    /**
+     * Follow the ascending gradient path of a d-cell to a maximum (-1 if
+     * the path reaches the boundary)
+     */
+    template <typename triangulationType>
+    SimplexId getAscendingMaximum(SimplexId cell,
+                                  const triangulationType &triangulation) const;
+
+    /**
+     * Compute the Morse boundary of a 2-saddle (critical edges reached an
+     * odd number of times by the gradient paths of its descending wall)
+     */
+    template <typename triangulationType>
+    void getSaddle2Boundary(const SimplexId saddle2,
+                            std::vector<SimplexId> &boundary,
+                            WallBuffers &buffers,
+                            const triangulationType &triangulation) const;
+
+    template <typename triangulationType>
+    void computeMinSaddlePairs(std::vector<PersistencePair> &pairs,
+                               std::vector<char> &pairedSaddles1,
+                               const std::vector<SimplexId> &minima,
+                               const std::vector<SimplexId> &saddles1,
+                               const SimplexId *const offsets,
+                               const triangulationType &triangulation) const;
+
+    template <typename triangulationType>
+    void computeSaddleMaxPairs(std::vector<PersistencePair> &pairs,
+                               std::vector<char> &pairedSaddles,
+                               const std::vector<SimplexId> &maxima,
+                               const std::vector<SimplexId> &saddles,
+                               const triangulationType &triangulation) const;
+
+    template <typename triangulationType>
+    void computeSaddleSaddlePairs(std::vector<PersistencePair> &pairs,
+                                  const std::vector<char> &pairedSaddles1,
+                                  const std::vector<char> &pairedSaddles2,
+                                  const std::vector<SimplexId> &saddles1,
+                                  const std::vector<SimplexId> &saddles2,
+                                  const triangulationType &triangulation) const;
+
+    /**
+     * Find the root of @p i with path halving
+     */
+    static inline SimplexId findRoot(std::vector<SimplexId> &parents,
+                                     SimplexId i) {
+      while(parents[i] != i) {
+        parents[i] = parents[parents[i]];
+        i = parents[i];
+      }
+      return i;
+    }
+
+    dcg::DiscreteGradient dg_{};
+  };
+} // namespace ttk
+
+template <typename triangulationType>
+ttk::DiscreteMorseSandwich::CellKey ttk::DiscreteMorseSandwich::getCellKey(
+  const int dim,
+  const SimplexId id,
+  const SimplexId *const offsets,
+  const triangulationType &triangulation) const {
+
+  CellKey key{-1, -1, -1, -1};
+  // clamped to the key size
+  const int nVerts = std::min(std::max(dim, 0), 3) + 1;
+  for(int i = 0; i < nVerts; ++i) {
+    SimplexId v{id};
+    if(dim == 1) {
+      triangulation.getEdgeVertex(id, i, v);
+    } else if(dim == 2 && this->dg_.getDimensionality() == 3) {
+      triangulation.getTriangleVertex(id, i, v);
+    } else if(dim > 1) {
+      triangulation.getCellVertex(id, i, v);
+    }
+    key[i] = offsets[v];
+  }
+  // decreasing insertion sort of the (at most 4) valid entries: std::sort
+  // on a variable sub-range of a std::array triggers false -Warray-bounds
+  // positives with GCC 12 at -O2
+  for(int i = 1; i < nVerts; ++i) {
+    const SimplexId k = key[i];
+    int j = i;
+    for(; j > 0 && key[j - 1] < k; --j) {
+      key[j] = key[j - 1];
+    }
+    key[j] = k;
+  }
+  return key;
+}
+
+template <typename triangulationType>
+void ttk::DiscreteMorseSandwich::getCriticalCells(
+  const int dim,
+  std::vector<SimplexId> &cells,
+  const triangulationType &triangulation) const {
+
+  const SimplexId nCells = this->dg_.getNumberOfCells(dim, triangulation);
+  const SimplexId nChunks = std::max(this->threadNumber_, 1);
+  const SimplexId chunkSize = (nCells + nChunks - 1) / nChunks;
+
+  // contiguous chunks keep the identifiers sorted once concatenated
+  std::vector<std::vector<SimplexId>> chunks(nChunks);
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_) schedule(static, 1)
+#endif // TTK_ENABLE_OPENMP
+  for(SimplexId c = 0; c < nChunks; ++c) {
+    const SimplexId end = std::min(nCells, (c + 1) * chunkSize);
+    for(SimplexId i = c * chunkSize; i < end; ++i) {
+      if(this->dg_.isCellCritical(dim, i)) {
+        chunks[c].emplace_back(i);
+      }
+    }
+  }
+
+  cells.clear();
+  for(const auto &chunk : chunks) {
+    cells.insert(cells.end(), chunk.begin(), chunk.end());
+  }
+}
+
+template <typename triangulationType>
+void ttk::DiscreteMorseSandwich::sortCriticalCells(
+  const int dim,
+  std::vector<SimplexId> &cells,
+  const SimplexId *const offsets,
+  const triangulationType &triangulation) const {
+
+  const size_t nCells = cells.size();
+  std::vector<std::pair<CellKey, SimplexId>> sorted(nCells);
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif // TTK_ENABLE_OPENMP
+  for(size_t i = 0; i < nCells; ++i) {
+    sorted[i] = std::make_pair(
+      this->getCellKey(dim, cells[i], offsets, triangulation), cells[i]);
+  }
+
+  PSORT(this->threadNumber_)(sorted.begin(), sorted.end());
+
+  for(size_t i = 0; i < nCells; ++i) {
+    cells[i] = sorted[i].second;
+  }
+}
+
+template <typename triangulationType>
+ttk::SimplexId ttk::DiscreteMorseSandwich::getDescendingMinimum(
+  SimplexId vertex, const triangulationType &triangulation) const {
+
+  while(!this->dg_.isCellCritical(0, vertex)) {
+    const auto edge
+      = this->dg_.getPairedCell(dcg::Cell{0, vertex}, triangulation);
+    SimplexId next{};
+    triangulation.getEdgeVertex(edge, 0, next);
+    if(next == vertex) {
+      triangulation.getEdgeVertex(edge, 1, next);
+    }
+    vertex = next;
+  }
+  return vertex;
+}
+
+template <typename triangulationType>
+ttk::SimplexId ttk::DiscreteMorseSandwich::getAscendingMaximum(
+  SimplexId cell, const triangulationType &triangulation) const {
+
+  const int dim = this->dg_.getDimensionality();
+
+  while(!this->dg_.isCellCritical(dim, cell)) {
+    const auto facet
+      = this->dg_.getPairedCell(dcg::Cell{dim, cell}, triangulation, true);
+    const auto nStars = dim == 3 ? triangulation.getTriangleStarNumber(facet)
+                                 : triangulation.getEdgeStarNumber(facet);
+    if(nStars < 2) {
+      // boundary of the domain
+      return -1;
+    }
+    SimplexId next{};
+    for(SimplexId i = 0; i < nStars; ++i) {
+      if(dim == 3) {
+        triangulation.getTriangleStar(facet, i, next);
+      } else {
+        triangulation.getEdgeStar(facet, i, next);
+      }
+      if(next != cell) {
+        break;
+      }
+    }
+    cell = next;
+  }
+  return cell;
+}
+
+template <typename triangulationType>
+void ttk::DiscreteMorseSandwich::getSaddle2Boundary(
+  const SimplexId saddle2,
+  std::vector<SimplexId> &boundary,
+  WallBuffers &buffers,
+  const triangulationType &triangulation) const {
+
+  auto &localIds = buffers.localIds;
+  auto &triangles = buffers.triangles;
+  auto &successors = buffers.successors;
+  auto &inDegree = buffers.inDegree;
+  auto &parity = buffers.parity;
+  auto &stack = buffers.stack;
+
+  localIds.clear();
+  triangles.clear();
+  successors.clear();
+  inDegree.clear();
+  boundary.clear();
+
+  // 1. explore the descending wall of saddle2, which is a DAG of
+  // triangles: successors are either local triangle ids or critical
+  // edges (encoded as -2 - edgeId), -1 stands for no successor
+  localIds.emplace(saddle2, 0);
+  triangles.emplace_back(saddle2);
+  inDegree.emplace_back(0);
+  for(size_t i = 0; i < triangles.size(); ++i) {
+    const auto t = triangles[i];
+    const auto pairedEdge
+      = i == 0 ? -1
+               : this->dg_.getPairedCell(dcg::Cell{2, t}, triangulation, true);
+    std::array<SimplexId, 3> next{-1, -1, -1};
+    for(int j = 0; j < 3; ++j) {
+      SimplexId e{};
+      triangulation.getTriangleEdge(t, j, e);
+      if(e == pairedEdge) {
+        continue;
+      }
+      if(this->dg_.isCellCritical(1, e)) {
+        next[j] = -2 - e;
+        continue;
+      }
+      const auto nextTriangle
+        = this->dg_.getPairedCell(dcg::Cell{1, e}, triangulation);
+      if(nextTriangle == -1) {
+        // e is paired with a vertex: the gradient path ends here
+        continue;
+      }
+      const auto it = localIds.emplace(nextTriangle, triangles.size());
+      if(it.second) {
+        triangles.emplace_back(nextTriangle);
+        inDegree.emplace_back(0);
+      }
+      next[j] = it.first->second;
+      inDegree[next[j]]++;
+    }
+    successors.emplace_back(next);
+  }
+
+  // 2. propagate the number of gradient paths (modulo 2) in topological
+  // order
+  parity.assign(triangles.size(), 0);
+  parity[0] = 1;
+  stack.clear();
+  stack.emplace_back(0);
+  while(!stack.empty()) {
+    const auto i = stack.back();
+    stack.pop_back();
+    for(const auto n : successors[i]) {
+      if(n == -1) {
+        continue;
+      }
+      if(n < -1) {
+        if(parity[i] != 0) {
+          boundary.emplace_back(-2 - n);
+        }
+        continue;
+      }
+      parity[n] ^= parity[i];
+      if(--inDegree[n] == 0) {
+        stack.emplace_back(n);
+      }
+    }
+  }
+
+  // 3. keep the critical edges reached an odd number of times
+  std::sort(boundary.begin(), boundary.end());
+  size_t last{};
+  for(size_t i = 0; i < boundary.size();) {
+    size_t j = i;
+    while(j < boundary.size() && boundary[j] == boundary[i]) {
+      ++j;
+    }
+    if((j - i) % 2 == 1) {
+      boundary[last++] = boundary[i];
+    }
+    i = j;
+  }
+  boundary.resize(last);
+}
+
+template <typename triangulationType>
+void ttk::DiscreteMorseSandwich::computeMinSaddlePairs(
+  std::vector<PersistencePair> &pairs,
+  std::vector<char> &pairedSaddles1,
+  const std::vector<SimplexId> &minima,
+  const std::vector<SimplexId> &saddles1,
+  const SimplexId *const offsets,
+  const triangulationType &triangulation) const {
+
+  Timer tm{};
+
+  const size_t nSaddles = saddles1.size();
+  pairedSaddles1.assign(nSaddles, 0);
+
+  // minima reached by the two vertices of each 1-saddle, as indices in
+  // the minima array (sorted by identifier)
+  std::vector<std::array<SimplexId, 2>> saddleMinima(nSaddles);
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_) schedule(dynamic, 64)
+#endif // TTK_ENABLE_OPENMP
+  for(size_t i = 0; i < nSaddles; ++i) {
+    for(int j = 0; j < 2; ++j) {
+      SimplexId v{};
+      triangulation.getEdgeVertex(saddles1[i], j, v);
+      const auto min = this->getDescendingMinimum(v, triangulation);
+      saddleMinima[i][j]
+        = std::lower_bound(minima.begin(), minima.end(), min) - minima.begin();
+    }
+  }
+
+  // union-find on the minima along the filtration: each root is the
+  // oldest minimum of its component
+  std::vector<SimplexId> parents(minima.size());
+  for(size_t i = 0; i < parents.size(); ++i) {
+    parents[i] = i;
+  }
+
+  for(size_t i = 0; i < nSaddles; ++i) {
+    auto r0 = findRoot(parents, saddleMinima[i][0]);
+    auto r1 = findRoot(parents, saddleMinima[i][1]);
+    if(r0 == r1) {
+      continue;
+    }
+    // elder rule: the youngest minimum dies
+    if(offsets[minima[r0]] < offsets[minima[r1]]) {
+      std::swap(r0, r1);
+    }
+    parents[r0] = r1;
+    pairs.emplace_back(minima[r0], saddles1[i], 0);
+    pairedSaddles1[i] = 1;
+  }
+
+  // the global minimum is never killed
+  for(size_t i = 0; i < parents.size(); ++i) {
+    if(parents[i] == static_cast<SimplexId>(i)) {
+      pairs.emplace_back(minima[i], -1, 0);
+    }
+  }
+
+  this->printMsg("Computed " + std::to_string(pairs.size()) + " D0 pairs",
+                 1.0, tm.getElapsedTime(), this->threadNumber_);
+}
+
+template <typename triangulationType>
+void ttk::DiscreteMorseSandwich::computeSaddleMaxPairs(
+  std::vector<PersistencePair> &pairs,
+  std::vector<char> &pairedSaddles,
+  const std::vector<SimplexId> &maxima,
+  const std::vector<SimplexId> &saddles,
+  const triangulationType &triangulation) const {
+
+  Timer tm{};
+
+  const int dim = this->dg_.getDimensionality();
+  const size_t nSaddles = saddles.size();
+  const size_t nPairs = pairs.size();
+  pairedSaddles.assign(nSaddles, 0);
+
+  // maxima are sorted along the filtration, the virtual maximum standing
+  // for the boundary of the domain comes last (oldest)
+  std::vector<SimplexId> maximaIds(maxima.begin(), maxima.end());
+  std::vector<SimplexId> maximaRanks(maxima.size());
+  for(size_t i = 0; i < maxima.size(); ++i) {
+    maximaRanks[i] = i;
+  }
+  std::sort(maximaRanks.begin(), maximaRanks.end(),
+            [&maximaIds](const SimplexId a, const SimplexId b) {
+              return maximaIds[a] < maximaIds[b];
+            });
+  std::sort(maximaIds.begin(), maximaIds.end());
+  const SimplexId virtualMax = maxima.size();
+
+  std::vector<std::array<SimplexId, 2>> saddleMaxima(nSaddles);
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_) schedule(dynamic, 64)
+#endif // TTK_ENABLE_OPENMP
+  for(size_t i = 0; i < nSaddles; ++i) {
+    const auto s = saddles[i];
+    const auto nStars = dim == 3 ? triangulation.getTriangleStarNumber(s)
+                                 : triangulation.getEdgeStarNumber(s);
+    saddleMaxima[i] = {virtualMax, virtualMax};
+    for(SimplexId j = 0; j < nStars && j < 2; ++j) {
+      SimplexId star{};
+      if(dim == 3) {
+        triangulation.getTriangleStar(s, j, star);
+      } else {
+        triangulation.getEdgeStar(s, j, star);
+      }
+      const auto max = this->getAscendingMaximum(star, triangulation);
+      if(max != -1) {
+        saddleMaxima[i][j] = maximaRanks[std::lower_bound(maximaIds.begin(),
+                                                          maximaIds.end(), max)
+                                         - maximaIds.begin()];
+      }
+    }
+  }
+
+  // union-find on the maxima along the reversed filtration: each root is
+  // the oldest maximum (highest rank) of its component
+  std::vector<SimplexId> parents(maxima.size() + 1);
+  for(size_t i = 0; i < parents.size(); ++i) {
+    parents[i] = i;
+  }
+
+  for(size_t i = nSaddles; i-- > 0;) {
+    auto r0 = findRoot(parents, saddleMaxima[i][0]);
+    auto r1 = findRoot(parents, saddleMaxima[i][1]);
+    if(r0 == r1) {
+      continue;
+    }
+    // elder rule: the youngest maximum dies
+    if(r0 > r1) {
+      std::swap(r0, r1);
+    }
+    parents[r0] = r1;
+    pairs.emplace_back(saddles[i], maxima[r0], dim - 1);
+    pairedSaddles[i] = 1;
+  }
+
+  this->printMsg("Computed " + std::to_string(pairs.size() - nPairs) + " D"
+                   + std::to_string(dim - 1) + " pairs",
+                 1.0, tm.getElapsedTime(), this->threadNumber_);
+}
+
+template <typename triangulationType>
+void ttk::DiscreteMorseSandwich::computeSaddleSaddlePairs(
+  std::vector<PersistencePair> &pairs,
+  const std::vector<char> &pairedSaddles1,
+  const std::vector<char> &pairedSaddles2,
+  const std::vector<SimplexId> &saddles1,
+  const std::vector<SimplexId> &saddles2,
+  const triangulationType &triangulation) const {
+
+  Timer tm{};
+
+  const size_t nSaddles1 = saddles1.size();
+  const size_t nSaddles2 = saddles2.size();
+  const size_t nPairs = pairs.size();
+
+  // rank of the 1-saddles along the filtration, by identifier
+  std::vector<SimplexId> saddles1Ids(saddles1.begin(), saddles1.end());
+  std::vector<SimplexId> saddles1Ranks(nSaddles1);
+  for(size_t i = 0; i < nSaddles1; ++i) {
+    saddles1Ranks[i] = i;
+  }
+  std::sort(saddles1Ranks.begin(), saddles1Ranks.end(),
+            [&saddles1Ids](const SimplexId a, const SimplexId b) {
+              return saddles1Ids[a] < saddles1Ids[b];
+            });
+  std::sort(saddles1Ids.begin(), saddles1Ids.end());
+
+  // 1. Morse boundaries of the unpaired 2-saddles, as sorted ranks of
+  // unpaired 1-saddles
+  std::vector<std::vector<SimplexId>> columns(nSaddles2);
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel num_threads(threadNumber_)
+#endif // TTK_ENABLE_OPENMP
+  {
+    WallBuffers buffers{};
+    std::vector<SimplexId> boundary{};
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp for schedule(dynamic)
+#endif // TTK_ENABLE_OPENMP
+    for(size_t i = 0; i < nSaddles2; ++i) {
+      if(pairedSaddles2[i] != 0) {
+        // clearing: this column would be reduced to zero
+        continue;
+      }
+      this->getSaddle2Boundary(saddles2[i], boundary, buffers, triangulation);
+      auto &column = columns[i];
+      for(const auto e : boundary) {
+        const auto rank
+          = saddles1Ranks[std::lower_bound(
+                            saddles1Ids.begin(), saddles1Ids.end(), e)
+                          - saddles1Ids.begin()];
+        if(pairedSaddles1[rank] == 0) {
+          // compression: negative 1-saddles are never pivots
+          column.emplace_back(rank);
+        }
+      }
+      std::sort(column.begin(), column.end());
+    }
+  }
+
+  // 2. standard column reduction along the filtration
+  std::vector<SimplexId> pivotColumns(nSaddles1, -1);
+  std::vector<SimplexId> sum{};
+  for(size_t i = 0; i < nSaddles2; ++i) {
+    auto &column = columns[i];
+    while(!column.empty()) {
+      const auto pivot = column.back();
+      const auto other = pivotColumns[pivot];
+      if(other == -1) {
+        pivotColumns[pivot] = i;
+        pairs.emplace_back(saddles1[pivot], saddles2[i], 1);
+        break;
+      }
+      // Z/2Z column addition
+      sum.clear();
+      std::set_symmetric_difference(column.begin(), column.end(),
+                                    columns[other].begin(),
+                                    columns[other].end(),
+                                    std::back_inserter(sum));
+      column.swap(sum);
+    }
+  }
+
+  this->printMsg("Computed " + std::to_string(pairs.size() - nPairs)
+                   + " D1 pairs",
+                 1.0, tm.getElapsedTime(), this->threadNumber_);
+}
+
+template <typename scalarType, typename triangulationType>
+int ttk::DiscreteMorseSandwich::computePersistencePairs(
+  std::vector<PersistencePair> &pairs,
+  const SimplexId *const offsets,
+  const triangulationType &triangulation,
+  const scalarType *const scalars,
+  const double minimumPersistence) {
+
+  Timer tm{};
+
+  const int dim = this->dg_.getDimensionality();
+  if(dim != 2 && dim != 3) {
+    this->printErr("Unsupported dimension " + std::to_string(dim));
+    return -1;
+  }
+
+  this->dg_.setDebugLevel(this->debugLevel_);
+  this->dg_.setThreadNumber(this->threadNumber_);
+  this->dg_.setInputOffsets(offsets);
+  this->dg_.buildGradient(triangulation);
+
+  // critical cells, sorted along the filtration (except for the
+  // minima, kept sorted by identifier)
+  std::vector<SimplexId> minima{}, saddles1{}, saddles2{}, maxima{};
+  this->getCriticalCells(0, minima, triangulation);
+  this->getCriticalCells(1, saddles1, triangulation);
+  this->getCriticalCells(dim, maxima, triangulation);
+  this->sortCriticalCells(1, saddles1, offsets, triangulation);
+  this->sortCriticalCells(dim, maxima, offsets, triangulation);
+  if(dim == 3) {
+    this->getCriticalCells(2, saddles2, triangulation);
+    this->sortCriticalCells(2, saddles2, offsets, triangulation);
+  }
+
+  pairs.clear();
+  std::vector<char> pairedSaddles1{}, pairedSaddles2{};
+
+  // D0 pairs
+  this->computeMinSaddlePairs(
+    pairs, pairedSaddles1, minima, saddles1, offsets, triangulation);
+
+  if(dim == 2) {
+    // D1 pairs (the 1-saddles are the (d-1)-saddles)
+    this->computeSaddleMaxPairs(
+      pairs, pairedSaddles2, maxima, saddles1, triangulation);
+  } else {
+    // D2 pairs
+    this->computeSaddleMaxPairs(
+      pairs, pairedSaddles2, maxima, saddles2, triangulation);
+
+    // a D1 pair links an unpaired 1-saddle to an unpaired 2-saddle: its
+    // persistence is bounded by the range of these saddles
+    bool skipD1{false};
+    if(minimumPersistence > 0.0) {
+      SimplexId lowest{-1}, highest{-1};
+      for(size_t i = 0; i < saddles1.size(); ++i) {
+        if(pairedSaddles1[i] == 0) {
+          lowest = this->getCellGreaterVertex(
+            dcg::Cell{1, saddles1[i]}, triangulation);
+          break;
+        }
+      }
+      for(size_t i = saddles2.size(); i-- > 0;) {
+        if(pairedSaddles2[i] == 0) {
+          highest = this->getCellGreaterVertex(
+            dcg::Cell{2, saddles2[i]}, triangulation);
+          break;
+        }
+      }
+      skipD1 = lowest == -1 || highest == -1
+               || static_cast<double>(scalars[highest] - scalars[lowest])
+                    < minimumPersistence;
+    }
+
+    // D1 pairs
+    if(skipD1) {
+      this->printMsg("No D1 pair above the persistence threshold");
+    } else {
+      this->computeSaddleSaddlePairs(pairs, pairedSaddles1, pairedSaddles2,
+                                     saddles1, saddles2, triangulation);
+    }
+  }
+
+  if(minimumPersistence > 0.0) {
+    const auto isNegligible = [&](const PersistencePair &p) {
+      if(p.death == -1) {
+        return false;
+      }
+      const auto birth
+        = this->getCellGreaterVertex(dcg::Cell{p.type, p.birth}, triangulation);
+      const auto death = this->getCellGreaterVertex(
+        dcg::Cell{p.type + 1, p.death}, triangulation);
+      return static_cast<double>(scalars[death] - scalars[birth])
+             < minimumPersistence;
+    };
+    pairs.erase(std::remove_if(pairs.begin(), pairs.end(), isNegligible),
+                pairs.end());
+  }
+
+  this->printMsg("Computed " + std::to_string(pairs.size())
+                   + " persistence pairs",
+                 1.0, tm.getElapsedTime(), this->threadNumber_);
+
+  return 0;
+}
@@ -0,0 +1,233 @@
+#include <DistributedContourTree.h>
+
+namespace {
+
+  // sequential union-find on indices with path halving
+  ttk::SimplexId find(std::vector<ttk::SimplexId> &parents, ttk::SimplexId i) {
+    while(parents[i] != i) {
+      parents[i] = parents[parents[i]];
+      i = parents[i];
+    }
+    return i;
+  }
+
+  // sweep of the vertices in increasing order (join tree) or decreasing
+  // order (split tree), edges given as (child, parent)
+  void sweep(const ttk::SimplexId nVertices,
+             std::vector<std::pair<ttk::SimplexId, ttk::SimplexId>> &edges,
+             const bool increasing,
+             std::vector<ttk::SimplexId> &treeParents) {
+
+    // edges sorted by the vertex at which they are processed
+    std::sort(edges.begin(), edges.end(),
+              [increasing](const std::pair<ttk::SimplexId, ttk::SimplexId> &a,
+                           const std::pair<ttk::SimplexId, ttk::SimplexId> &b) {
+                return increasing ? a.second < b.second : a.second > b.second;
+              });
+
+    treeParents.assign(nVertices, -1);
+    std::vector<ttk::SimplexId> sets(nVertices);
+    std::iota(sets.begin(), sets.end(), 0);
+    // last processed vertex of each set
+    std::vector<ttk::SimplexId> tops(nVertices);
+    std::iota(tops.begin(), tops.end(), 0);
+
+    size_t e = 0;
+    for(ttk::SimplexId k = 0; k < nVertices; ++k) {
+      const ttk::SimplexId v = increasing ? k : nVertices - 1 - k;
+      for(; e < edges.size() && edges[e].second == v; ++e) {
+        const ttk::SimplexId root = find(sets, edges[e].first);
+        const ttk::SimplexId vRoot = find(sets, v);
+        if(root != vRoot) {
+          treeParents[tops[root]] = v;
+          sets[root] = vRoot;
+        }
+      }
+      tops[find(sets, v)] = v;
+    }
+  }
+
+  void removeChild(std::vector<ttk::SimplexId> &children,
+                   const ttk::SimplexId child) {
+    children.erase(std::find(children.begin(), children.end(), child));
+  }
+
+  void replaceChild(std::vector<ttk::SimplexId> &children,
+                    const ttk::SimplexId child,
+                    const ttk::SimplexId other) {
+    *std::find(children.begin(), children.end(), child) = other;
+  }
+
+} // namespace
+
+ttk::DistributedContourTree::DistributedContourTree() {
+  this->setDebugMsgPrefix("DistributedContourTree");
+}
+
+int ttk::DistributedContourTree::gatherExtents() {
+#ifdef TTK_ENABLE_MPI
+  int nRanks{};
+  MPI_Comm_size(Communicator, &nRanks);
+  Extents.resize(6 * nRanks);
+  MPI_Allgather(LocalExtent.data(), 6, getMPIType(SimplexId{}),
+                Extents.data(), 6, getMPIType(SimplexId{}), Communicator);
+#else
+  Extents.assign(LocalExtent.begin(), LocalExtent.end());
+#endif // TTK_ENABLE_MPI
+  return 0;
+}
+
+bool ttk::DistributedContourTree::isShared(const SimplexId vertexId,
+                                           const int firstRank,
+                                           const int endRank) const {
+  const SimplexId p[3]
+    = {vertexId % GlobalDimensions[0],
+       (vertexId / GlobalDimensions[0]) % GlobalDimensions[1],
+       vertexId / (GlobalDimensions[0] * GlobalDimensions[1])};
+  const int nRanks = Extents.size() / 6;
+  for(int r = 0; r < nRanks; ++r) {
+    if(r >= firstRank && r < endRank) {
+      continue;
+    }
+    bool inside = true;
+    for(int d = 0; d < 3; ++d) {
+      inside = inside && Extents[6 * r + 2 * d] <= p[d]
+               && p[d] <= Extents[6 * r + 2 * d + 1];
+    }
+    if(inside) {
+      return true;
+    }
+  }
+  return false;
+}
+
+void ttk::DistributedContourTree::computeTrees(
+  const SimplexId nVertices,
+  std::vector<std::pair<SimplexId, SimplexId>> &joinEdges,
+  std::vector<std::pair<SimplexId, SimplexId>> &splitEdges,
+  std::vector<SimplexId> &joinParents,
+  std::vector<SimplexId> &splitParents) const {
+
+  sweep(nVertices, joinEdges, true, joinParents);
+  sweep(nVertices, splitEdges, false, splitParents);
+}
+
+void ttk::DistributedContourTree::computePairs(
+  const std::vector<SimplexId> &joinParents,
+  const std::vector<SimplexId> &splitParents,
+  std::vector<std::pair<SimplexId, SimplexId>> &minSaddlePairs,
+  std::vector<std::pair<SimplexId, SimplexId>> &saddleMaxPairs) const {
+
+  const SimplexId nVertices = joinParents.size();
+  minSaddlePairs.clear();
+  saddleMaxPairs.clear();
+  if(nVertices < 2) {
+    return;
+  }
+
+  // oldest extremum of the subtree of each vertex, the children being
+  // processed before their parent
+  std::vector<SimplexId> births(nVertices, -1);
+  for(SimplexId i = 0; i < nVertices; ++i) {
+    if(births[i] == -1) {
+      births[i] = i;
+    }
+    const SimplexId p = joinParents[i];
+    if(p == -1) {
+      // global pair
+      minSaddlePairs.emplace_back(births[i], i);
+    } else if(births[p] == -1) {
+      births[p] = births[i];
+    } else {
+      minSaddlePairs.emplace_back(std::max(births[p], births[i]), p);
+      births[p] = std::min(births[p], births[i]);
+    }
+  }
+
+  births.assign(nVertices, -1);
+  for(SimplexId i = nVertices - 1; i >= 0; --i) {
+    if(births[i] == -1) {
+      births[i] = i;
+    }
+    const SimplexId p = splitParents[i];
+    if(p == -1) {
+      continue;
+    } else if(births[p] == -1) {
+      births[p] = births[i];
+    } else {
+      saddleMaxPairs.emplace_back(p, std::min(births[p], births[i]));
+      births[p] = std::max(births[p], births[i]);
+    }
+  }
+}
+
+void ttk::DistributedContourTree::combineTrees(
+  std::vector<SimplexId> joinParents,
+  std::vector<SimplexId> splitParents,
+  std::vector<std::pair<SimplexId, SimplexId>> &arcs) const {
+
+  const SimplexId nVertices = joinParents.size();
+  std::vector<std::vector<SimplexId>> joinChildren(nVertices);
+  std::vector<std::vector<SimplexId>> splitChildren(nVertices);
+  for(SimplexId i = 0; i < nVertices; ++i) {
+    if(joinParents[i] != -1) {
+      joinChildren[joinParents[i]].emplace_back(i);
+    }
+    if(splitParents[i] != -1) {
+      splitChildren[splitParents[i]].emplace_back(i);
+    }
+  }
+
+  // leaves of the contour tree: the join children are its down arcs and
+  // the split children its up arcs
+  const auto isLeaf = [&](const SimplexId i) {
+    return joinChildren[i].size() + splitChildren[i].size() == 1;
+  };
+  std::vector<SimplexId> leaves{};
+  for(SimplexId i = 0; i < nVertices; ++i) {
+    if(isLeaf(i)) {
+      leaves.emplace_back(i);
+    }
+  }
+
+  arcs.clear();
+  std::vector<bool> removed(nVertices, false);
+  SimplexId nRemaining = nVertices;
+  while(nRemaining > 1 && !leaves.empty()) {
+    const SimplexId v = leaves.back();
+    leaves.pop_back();
+    if(removed[v] || !isLeaf(v)) {
+      continue;
+    }
+    SimplexId neighbor{};
+    if(splitChildren[v].empty()) {
+      // upper leaf: arc to its parent in the split tree, v is regular in
+      // the join tree
+      neighbor = splitParents[v];
+      arcs.emplace_back(neighbor, v);
+      removeChild(splitChildren[neighbor], v);
+      const SimplexId child = joinChildren[v][0];
+      const SimplexId parent = joinParents[v];
+      joinParents[child] = parent;
+      if(parent != -1) {
+        replaceChild(joinChildren[parent], v, child);
+      }
+    } else {
+      // lower leaf
+      neighbor = joinParents[v];
+      arcs.emplace_back(v, neighbor);
+      removeChild(joinChildren[neighbor], v);
+      const SimplexId child = splitChildren[v][0];
+      const SimplexId parent = splitParents[v];
+      splitParents[child] = parent;
+      if(parent != -1) {
+        replaceChild(splitChildren[parent], v, child);
+      }
+    }
+    removed[v] = true;
+    nRemaining--;
+    if(isLeaf(neighbor)) {
+      leaves.emplace_back(neighbor);
+    }
+  }
+}
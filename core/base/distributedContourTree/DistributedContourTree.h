@@ -0,0 +1,592 @@
+/// \ingroup base
+/// \class ttk::DistributedContourTree
+/// \date October 2026.
+///
+/// \brief TTK processing package for the computation of the contour tree and
+/// of the extremum-saddle persistence diagram of a regular grid distributed
+/// over MPI processes.
+///
+/// Each process holds a piece of the grid, given by its extent in the whole
+/// grid. Neighboring pieces overlap by at least one layer of vertices
+/// (shared boundary or ghost layers), so that each cell of the grid belongs
+/// to one piece at least.
+///
+/// 1) each process computes the augmented join and split trees of its piece
+/// with ttk::ftm::FTMTree and reduces them to their nodes and to the
+/// vertices shared with other pieces (boundary augmentation),
+///
+/// 2) the reduced trees are then glued along a binary tree of processes: a
+/// process receiving the trees of another group unites both vertex sets
+/// (the shared vertices are identified by their global identifier),
+/// recomputes the join and split trees of the union with two union-find
+/// sweeps and reduces them again to their critical vertices and to the
+/// vertices shared with the processes outside of the group,
+///
+/// 3) the first process eventually holds the join and split trees reduced to
+/// the critical vertices of the whole grid, from which it computes the
+/// persistence pairs (elder rule) and the contour tree (combination of the
+/// join and split trees).
+///
+/// The outputs are only computed by the first process of the communicator
+/// and refer to the global vertex identifiers (x + nx * (y + ny * z)). They
+/// are the same as the FTM backend of ttk::PersistenceDiagram (without the
+/// saddle-saddle pairs) and as the contour tree of ttk::ftm::FTMTree on the
+/// whole grid. Without MPI, the local piece is the whole grid.
+///
+/// \b Related \b publication \n
+/// "Distributed Contour Trees" \n
+/// Dmitriy Morozov, Gunther H. Weber \n
+/// Topological Methods in Data Analysis and Visualization III, 2014
+///
+/// \sa ttk::PersistenceDiagram
+/// \sa ttk::ftm::FTMTree
+
+#pragma once
+
+// base code includes
+#include <FTMTree.h>
+#include <ImplicitTriangulation.h>
+#include <PersistenceDiagram.h>
+
+#ifdef TTK_ENABLE_MPI
+#include <mpi.h>
+#endif // TTK_ENABLE_MPI
+
+#include <algorithm>
+#include <array>
+#include <climits>
+#include <cstddef>
+#include <numeric>
+#include <unordered_map>
+#include <vector>
+
+namespace ttk {
+
+  class DistributedContourTree : virtual public Debug {
+
+  public:
+    DistributedContourTree();
+
+    /**
+     * @brief Vertex of the reduced join and split trees exchanged between
+     * processes
+     */
+    template <typename scalarType>
+    struct TreeVertex {
+      /** global vertex identifier */
+      SimplexId id;
+      scalarType value;
+      /** global identifiers of the parents (-1 on the roots) */
+      SimplexId joinParent;
+      SimplexId splitParent;
+    };
+
+#ifdef TTK_ENABLE_MPI
+    inline void setCommunicator(const MPI_Comm communicator) {
+      Communicator = communicator;
+    }
+#endif // TTK_ENABLE_MPI
+
+    /// Number of vertices of the whole grid along each dimension
+    inline void setGlobalDimensions(const std::array<SimplexId, 3> &dims) {
+      GlobalDimensions = dims;
+    }
+
+    /// First and last vertices of the local piece along each dimension
+    /// (xMin, xMax, yMin, yMax, zMin, zMax, ghost layers included)
+    inline void setLocalExtent(const std::array<SimplexId, 6> &extent) {
+      LocalExtent = extent;
+    }
+
+    /**
+     * Compute the persistence diagram and the contour tree (arcs from their
+     * lower vertex to their upper vertex) of the grid. Collective over the
+     * communicator, the outputs are only filled on the first process.
+     *
+     * @param[out] diagram extremum-saddle pairs, sorted by birth
+     * @param[out] contourTree arcs of the contour tree
+     * @param[in] scalars scalar field of the local piece
+     */
+    template <typename scalarType>
+    int execute(std::vector<PersistencePair> &diagram,
+                std::vector<std::pair<SimplexId, SimplexId>> &contourTree,
+                const scalarType *const scalars);
+
+  protected:
+    // extents of the pieces of all the processes
+    int gatherExtents();
+
+    // whether a vertex of the grid belongs to the piece of a process out
+    // of [firstRank, endRank)
+    bool isShared(const SimplexId vertexId,
+                  const int firstRank,
+                  const int endRank) const;
+
+    // parents of the vertices (sorted by increasing order) in the join and
+    // split trees of the graphs given by their edges (child, parent)
+    void computeTrees(
+      const SimplexId nVertices,
+      std::vector<std::pair<SimplexId, SimplexId>> &joinEdges,
+      std::vector<std::pair<SimplexId, SimplexId>> &splitEdges,
+      std::vector<SimplexId> &joinParents,
+      std::vector<SimplexId> &splitParents) const;
+
+    // minimum-saddle and saddle-maximum pairs (elder rule) of the join and
+    // split trees of sorted vertices, the global pair being a minimum-saddle
+    // one
+    void computePairs(
+      const std::vector<SimplexId> &joinParents,
+      const std::vector<SimplexId> &splitParents,
+      std::vector<std::pair<SimplexId, SimplexId>> &minSaddlePairs,
+      std::vector<std::pair<SimplexId, SimplexId>> &saddleMaxPairs) const;
+
+    // contour tree of the join and split trees of sorted vertices
+    void
+      combineTrees(std::vector<SimplexId> joinParents,
+                   std::vector<SimplexId> splitParents,
+                   std::vector<std::pair<SimplexId, SimplexId>> &arcs) const;
+
+    template <typename scalarType>
+    int computeLocalTrees(std::vector<TreeVertex<scalarType>> &vertices,
+                          const scalarType *const scalars,
+                          const int rank) const;
+
+    template <typename scalarType>
+    int glueTrees(std::vector<TreeVertex<scalarType>> &vertices,
+                  const int firstRank,
+                  const int endRank) const;
+
+    template <typename scalarType>
+    static void sortVertices(std::vector<TreeVertex<scalarType>> &vertices);
+
+#ifdef TTK_ENABLE_MPI
+    // MPI datatypes of the exchanged scalars and identifiers
+    static inline MPI_Datatype getMPIType(const char) {
+      return MPI_CHAR;
+    }
+    static inline MPI_Datatype getMPIType(const signed char) {
+      return MPI_SIGNED_CHAR;
+    }
+    static inline MPI_Datatype getMPIType(const unsigned char) {
+      return MPI_UNSIGNED_CHAR;
+    }
+    static inline MPI_Datatype getMPIType(const short) {
+      return MPI_SHORT;
+    }
+    static inline MPI_Datatype getMPIType(const unsigned short) {
+      return MPI_UNSIGNED_SHORT;
+    }
+    static inline MPI_Datatype getMPIType(const int) {
+      return MPI_INT;
+    }
+    static inline MPI_Datatype getMPIType(const unsigned int) {
+      return MPI_UNSIGNED;
+    }
+    static inline MPI_Datatype getMPIType(const long) {
+      return MPI_LONG;
+    }
+    static inline MPI_Datatype getMPIType(const unsigned long) {
+      return MPI_UNSIGNED_LONG;
+    }
+    static inline MPI_Datatype getMPIType(const long long) {
+      return MPI_LONG_LONG;
+    }
+    static inline MPI_Datatype getMPIType(const unsigned long long) {
+      return MPI_UNSIGNED_LONG_LONG;
+    }
+    static inline MPI_Datatype getMPIType(const float) {
+      return MPI_FLOAT;
+    }
+    static inline MPI_Datatype getMPIType(const double) {
+      return MPI_DOUBLE;
+    }
+
+    // committed MPI datatype of a TreeVertex, made of its members only (its
+    // padding is not sent), to be freed with MPI_Type_free()
+    template <typename scalarType>
+    static MPI_Datatype createTreeVertexType();
+
+    MPI_Comm Communicator{MPI_COMM_WORLD};
+#endif // TTK_ENABLE_MPI
+    std::array<SimplexId, 3> GlobalDimensions{};
+    std::array<SimplexId, 6> LocalExtent{};
+    std::vector<SimplexId> Extents{};
+  };
+} // namespace ttk
+
+#ifdef TTK_ENABLE_MPI
+template <typename scalarType>
+MPI_Datatype ttk::DistributedContourTree::createTreeVertexType() {
+  using Vertex = TreeVertex<scalarType>;
+  const int lengths[4] = {1, 1, 1, 1};
+  const MPI_Aint displacements[4]
+    = {offsetof(Vertex, id), offsetof(Vertex, value),
+       offsetof(Vertex, joinParent), offsetof(Vertex, splitParent)};
+  const MPI_Datatype types[4]
+    = {getMPIType(SimplexId{}), getMPIType(scalarType{}),
+       getMPIType(SimplexId{}), getMPIType(SimplexId{})};
+  MPI_Datatype members, vertexType;
+  MPI_Type_create_struct(4, lengths, displacements, types, &members);
+  // extent of the struct, for arrays of vertices
+  MPI_Type_create_resized(members, 0, sizeof(Vertex), &vertexType);
+  MPI_Type_free(&members);
+  MPI_Type_commit(&vertexType);
+  return vertexType;
+}
+#endif // TTK_ENABLE_MPI
+
+template <typename scalarType>
+void ttk::DistributedContourTree::sortVertices(
+  std::vector<TreeVertex<scalarType>> &vertices) {
+
+  // same order as the offsets of the whole grid, duplicates are adjacent
+  std::sort(
+    vertices.begin(), vertices.end(),
+    [](const TreeVertex<scalarType> &a, const TreeVertex<scalarType> &b) {
+      return a.value < b.value || (a.value == b.value && a.id < b.id);
+    });
+}
+
+template <typename scalarType>
+int ttk::DistributedContourTree::computeLocalTrees(
+  std::vector<TreeVertex<scalarType>> &vertices,
+  const scalarType *const scalars,
+  const int rank) const {
+
+  const auto &e = LocalExtent;
+  const SimplexId dims[3]
+    = {e[1] - e[0] + 1, e[3] - e[2] + 1, e[5] - e[4] + 1};
+  const SimplexId nVertices = dims[0] * dims[1] * dims[2];
+
+  std::vector<SimplexId> globalIds(nVertices);
+  for(SimplexId k = 0; k < dims[2]; ++k) {
+    for(SimplexId j = 0; j < dims[1]; ++j) {
+      for(SimplexId i = 0; i < dims[0]; ++i) {
+        globalIds[i + dims[0] * (j + dims[1] * k)]
+          = e[0] + i
+            + GlobalDimensions[0]
+                * (e[2] + j + GlobalDimensions[1] * (e[4] + k));
+      }
+    }
+  }
+
+  // local offsets, consistent with the offsets of the whole grid
+  std::vector<SimplexId> order(nVertices);
+  std::iota(order.begin(), order.end(), 0);
+  std::sort(
+    order.begin(), order.end(), [&](const SimplexId a, const SimplexId b) {
+      return scalars[a] < scalars[b]
+             || (scalars[a] == scalars[b] && globalIds[a] < globalIds[b]);
+    });
+  std::vector<SimplexId> offsets(nVertices);
+  for(SimplexId i = 0; i < nVertices; ++i) {
+    offsets[order[i]] = i;
+  }
+
+  ImplicitTriangulation triangulation{};
+  triangulation.setInputGrid(0, 0, 0, 1, 1, 1, dims[0], dims[1], dims[2]);
+
+  ftm::FTMTree tree{};
+  tree.setDebugLevel(debugLevel_);
+  tree.setThreadNumber(threadNumber_);
+  tree.preconditionTriangulation(&triangulation);
+  tree.setVertexScalars(scalars);
+  tree.setVertexSoSoffsets(offsets.data());
+  tree.setTreeType(ftm::TreeType::Join_Split);
+  tree.setSegmentation(true);
+  tree.build<scalarType>(&triangulation);
+
+  // kept vertices: shared with other pieces and nodes of the trees
+  std::vector<bool> kept(nVertices, false);
+  const int nRanks = Extents.size() / 6;
+  for(int r = 0; r < nRanks; ++r) {
+    if(r == rank) {
+      continue;
+    }
+    SimplexId lo[3], hi[3];
+    for(int d = 0; d < 3; ++d) {
+      lo[d] = std::max(e[2 * d], Extents[6 * r + 2 * d]) - e[2 * d];
+      hi[d] = std::min(e[2 * d + 1], Extents[6 * r + 2 * d + 1]) - e[2 * d];
+    }
+    for(SimplexId k = lo[2]; k <= hi[2]; ++k) {
+      for(SimplexId j = lo[1]; j <= hi[1]; ++j) {
+        for(SimplexId i = lo[0]; i <= hi[0]; ++i) {
+          kept[i + dims[0] * (j + dims[1] * k)] = true;
+        }
+      }
+    }
+  }
+  ftm::FTMTree_MT *const trees[2] = {tree.getJoinTree(), tree.getSplitTree()};
+  for(const auto t : trees) {
+    for(ftm::idNode n = 0; n < t->getNumberOfNodes(); ++n) {
+      kept[t->getNode(n)->getVertexId()] = true;
+    }
+  }
+
+  // reduction of the trees: consecutive kept vertices along each arc
+  std::vector<SimplexId> parents[2]
+    = {std::vector<SimplexId>(nVertices, -1),
+       std::vector<SimplexId>(nVertices, -1)};
+  std::vector<SimplexId> chain{};
+  for(int t = 0; t < 2; ++t) {
+    for(ftm::idSuperArc a = 0; a < trees[t]->getNumberOfSuperArcs(); ++a) {
+      const auto arc = trees[t]->getSuperArc(a);
+      chain.clear();
+      for(const auto v : *arc) {
+        if(kept[v]) {
+          chain.emplace_back(v);
+        }
+      }
+      // from the down node to the up node of the arc
+      if(t == 0) {
+        std::sort(chain.begin(), chain.end(),
+                  [&](const SimplexId a0, const SimplexId a1) {
+                    return offsets[a0] < offsets[a1];
+                  });
+      } else {
+        std::sort(chain.begin(), chain.end(),
+                  [&](const SimplexId a0, const SimplexId a1) {
+                    return offsets[a0] > offsets[a1];
+                  });
+      }
+      chain.insert(
+        chain.begin(), trees[t]->getNode(arc->getDownNodeId())->getVertexId());
+      chain.emplace_back(
+        trees[t]->getNode(arc->getUpNodeId())->getVertexId());
+      for(size_t i = 0; i + 1 < chain.size(); ++i) {
+        parents[t][chain[i]] = chain[i + 1];
+      }
+    }
+  }
+
+  vertices.clear();
+  for(SimplexId v = 0; v < nVertices; ++v) {
+    if(kept[v]) {
+      const SimplexId jp = parents[0][v];
+      const SimplexId sp = parents[1][v];
+      vertices.push_back({globalIds[v], scalars[v],
+                          jp == -1 ? -1 : globalIds[jp],
+                          sp == -1 ? -1 : globalIds[sp]});
+    }
+  }
+
+  return 0;
+}
+
+template <typename scalarType>
+int ttk::DistributedContourTree::glueTrees(
+  std::vector<TreeVertex<scalarType>> &vertices,
+  const int firstRank,
+  const int endRank) const {
+
+  // union of the vertex sets
+  sortVertices(vertices);
+  std::vector<TreeVertex<scalarType>> unique{};
+  unique.reserve(vertices.size());
+  std::unordered_map<SimplexId, SimplexId> indices{};
+  for(const auto &v : vertices) {
+    if(unique.empty() || unique.back().id != v.id) {
+      indices[v.id] = unique.size();
+      unique.emplace_back(v);
+    }
+  }
+  const SimplexId nVertices = unique.size();
+
+  // union of the edges
+  std::vector<std::pair<SimplexId, SimplexId>> joinEdges{}, splitEdges{};
+  for(const auto &v : vertices) {
+    if(v.joinParent != -1) {
+      joinEdges.emplace_back(indices[v.id], indices[v.joinParent]);
+    }
+    if(v.splitParent != -1) {
+      splitEdges.emplace_back(indices[v.id], indices[v.splitParent]);
+    }
+  }
+
+  std::vector<SimplexId> parents[2];
+  computeTrees(nVertices, joinEdges, splitEdges, parents[0], parents[1]);
+
+  // kept vertices: critical in one tree or shared out of the group
+  std::vector<SimplexId> nChildren[2]
+    = {std::vector<SimplexId>(nVertices, 0),
+       std::vector<SimplexId>(nVertices, 0)};
+  for(int t = 0; t < 2; ++t) {
+    for(const auto p : parents[t]) {
+      if(p != -1) {
+        nChildren[t][p]++;
+      }
+    }
+  }
+  std::vector<bool> kept(nVertices);
+  for(SimplexId i = 0; i < nVertices; ++i) {
+    kept[i] = false;
+    for(int t = 0; t < 2; ++t) {
+      kept[i] = kept[i] || parents[t][i] == -1 || nChildren[t][i] != 1;
+    }
+    kept[i] = kept[i] || isShared(unique[i].id, firstRank, endRank);
+  }
+
+  // reduction of the trees: first kept ancestor (the parents are higher in
+  // the join tree and lower in the split tree)
+  std::vector<SimplexId> keptParents[2]
+    = {std::vector<SimplexId>(nVertices, -1),
+       std::vector<SimplexId>(nVertices, -1)};
+  for(SimplexId i = nVertices - 1; i >= 0; --i) {
+    const SimplexId p = parents[0][i];
+    if(p != -1) {
+      keptParents[0][i] = kept[p] ? p : keptParents[0][p];
+    }
+  }
+  for(SimplexId i = 0; i < nVertices; ++i) {
+    const SimplexId p = parents[1][i];
+    if(p != -1) {
+      keptParents[1][i] = kept[p] ? p : keptParents[1][p];
+    }
+  }
+
+  vertices.clear();
+  for(SimplexId i = 0; i < nVertices; ++i) {
+    if(kept[i]) {
+      const SimplexId jp = keptParents[0][i];
+      const SimplexId sp = keptParents[1][i];
+      vertices.push_back({unique[i].id, unique[i].value,
+                          jp == -1 ? -1 : unique[jp].id,
+                          sp == -1 ? -1 : unique[sp].id});
+    }
+  }
+
+  return 0;
+}
+
+template <typename scalarType>
+int ttk::DistributedContourTree::execute(
+  std::vector<PersistencePair> &diagram,
+  std::vector<std::pair<SimplexId, SimplexId>> &contourTree,
+  const scalarType *const scalars) {
+
+  Timer tm{};
+
+  diagram.clear();
+  contourTree.clear();
+
+  int rank{0}, nRanks{1};
+#ifdef TTK_ENABLE_MPI
+  MPI_Comm_rank(Communicator, &rank);
+  MPI_Comm_size(Communicator, &nRanks);
+#endif // TTK_ENABLE_MPI
+
+  gatherExtents();
+
+  std::vector<TreeVertex<scalarType>> vertices{};
+  computeLocalTrees(vertices, scalars, rank);
+  if(nRanks == 1) {
+    glueTrees(vertices, 0, 1);
+  }
+
+  printMsg("Computed the local trees (" + std::to_string(vertices.size())
+             + " vertices)",
+           1.0, tm.getElapsedTime(), threadNumber_);
+
+  // gluing along a binary tree of processes
+#ifdef TTK_ENABLE_MPI
+  MPI_Datatype vertexType = createTreeVertexType<scalarType>();
+#endif // TTK_ENABLE_MPI
+  for(int step = 1; step < nRanks; step *= 2) {
+    if(rank % (2 * step) == step) {
+#ifdef TTK_ENABLE_MPI
+      // MPI counts are int (reduced trees are far below this limit)
+      if(vertices.size() > static_cast<size_t>(INT_MAX)) {
+        printErr("Too many vertices to send ("
+                 + std::to_string(vertices.size()) + ")");
+        MPI_Abort(Communicator, -1);
+      }
+      MPI_Send(vertices.data(), static_cast<int>(vertices.size()), vertexType,
+               rank - step, 0, Communicator);
+#endif // TTK_ENABLE_MPI
+      vertices.clear();
+      break;
+    }
+    if(rank % (2 * step) == 0 && rank + step < nRanks) {
+#ifdef TTK_ENABLE_MPI
+      MPI_Status status;
+      int count{};
+      MPI_Probe(rank + step, 0, Communicator, &status);
+      MPI_Get_count(&status, vertexType, &count);
+      const size_t nLocal = vertices.size();
+      vertices.resize(nLocal + count);
+      MPI_Recv(&vertices[nLocal], count, vertexType, rank + step, 0,
+               Communicator, MPI_STATUS_IGNORE);
+#endif // TTK_ENABLE_MPI
+      glueTrees(vertices, rank, std::min(rank + 2 * step, nRanks));
+    }
+  }
+#ifdef TTK_ENABLE_MPI
+  MPI_Type_free(&vertexType);
+#endif // TTK_ENABLE_MPI
+
+  if(rank != 0) {
+    return 0;
+  }
+
+  printMsg("Glued the trees (" + std::to_string(vertices.size())
+             + " critical vertices)",
+           1.0, tm.getElapsedTime(), threadNumber_);
+
+  // trees of the critical vertices of the whole grid
+  sortVertices(vertices);
+  const SimplexId nVertices = vertices.size();
+  std::unordered_map<SimplexId, SimplexId> indices{};
+  for(SimplexId i = 0; i < nVertices; ++i) {
+    indices[vertices[i].id] = i;
+  }
+  std::vector<SimplexId> joinParents(nVertices, -1);
+  std::vector<SimplexId> splitParents(nVertices, -1);
+  for(SimplexId i = 0; i < nVertices; ++i) {
+    if(vertices[i].joinParent != -1) {
+      joinParents[i] = indices[vertices[i].joinParent];
+    }
+    if(vertices[i].splitParent != -1) {
+      splitParents[i] = indices[vertices[i].splitParent];
+    }
+  }
+
+  std::vector<std::pair<SimplexId, SimplexId>> minSaddle{}, saddleMax{};
+  computePairs(joinParents, splitParents, minSaddle, saddleMax);
+
+  const auto persistence = [&vertices](const SimplexId birth,
+                                       const SimplexId death) {
+    return static_cast<double>(vertices[death].value - vertices[birth].value);
+  };
+  for(const auto &p : minSaddle) {
+    // the global pair ends at the root of the join tree
+    const auto deathType = joinParents[p.second] == -1
+                             ? CriticalType::Local_maximum
+                             : CriticalType::Saddle1;
+    diagram.emplace_back(vertices[p.first].id, CriticalType::Local_minimum,
+                         vertices[p.second].id, deathType,
+                         persistence(p.first, p.second), 0);
+  }
+  for(const auto &p : saddleMax) {
+    diagram.emplace_back(vertices[p.first].id, CriticalType::Saddle2,
+                         vertices[p.second].id, CriticalType::Local_maximum,
+                         persistence(p.first, p.second), 2);
+  }
+
+  // sorted by birth, as in ttk::PersistenceDiagram
+  std::sort(diagram.begin(), diagram.end(),
+            [&indices](const PersistencePair &a, const PersistencePair &b) {
+              return indices[a.birth] < indices[b.birth];
+            });
+
+  combineTrees(joinParents, splitParents, contourTree);
+  for(auto &arc : contourTree) {
+    arc.first = vertices[arc.first].id;
+    arc.second = vertices[arc.second].id;
+  }
+
+  printMsg("Computed " + std::to_string(diagram.size()) + " pairs and "
+             + std::to_string(contourTree.size()) + " arcs",
+           1.0, tm.getElapsedTime(), threadNumber_);
+
+  return 0;
+}
@@ -141,11 +141,19 @@ int ttk::EigenField::execute(const TriangulationType &triangulation,
   return 0;
 }
 
-// explicit template specializations for double and float types
-#define EIGENFIELD_SPECIALIZE(TYPE)                                            \
-  template int ttk::EigenField::execute<TYPE>(                                 \
-    const Triangulation &, TYPE *const, const unsigned int, bool, TYPE *const) \
-    const
-
-EIGENFIELD_SPECIALIZE(double);
-EIGENFIELD_SPECIALIZE(float);
+// explicit template specializations for double and float types and for
+// every concrete triangulation type (see ttkTemplateMacro)
+#define EIGENFIELD_SPECIALIZE(TYPE, TRIANGULATION)                \
+  template int ttk::EigenField::execute<TYPE>(                    \
+    const TRIANGULATION &, TYPE *const, const unsigned int, bool, \
+    TYPE *const) const
+
+#define EIGENFIELD_SPECIALIZE_ALL(TYPE)                       \
+  EIGENFIELD_SPECIALIZE(TYPE, Triangulation);                 \
+  EIGENFIELD_SPECIALIZE(TYPE, ExplicitTriangulation);         \
+  EIGENFIELD_SPECIALIZE(TYPE, ImplicitTriangulation);         \
+  EIGENFIELD_SPECIALIZE(TYPE, PeriodicImplicitTriangulation); \
+  EIGENFIELD_SPECIALIZE(TYPE, CompactTriangulation)
+
+EIGENFIELD_SPECIALIZE_ALL(double);
+EIGENFIELD_SPECIALIZE_ALL(float);
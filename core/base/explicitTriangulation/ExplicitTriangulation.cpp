@@ -3,8 +3,16 @@
 #include <ThreeSkeleton.h>
 #include <TwoSkeleton.h>
 #include <ZeroSkeleton.h>
+#include <cstdio>
 #include <cstring>
 
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif // _WIN32
+
 using namespace ttk;
 
 ExplicitTriangulation::ExplicitTriangulation() {
@@ -27,11 +35,11 @@ int ExplicitTriangulation::clear() {
   return AbstractTriangulation::clear();
 }
 
-size_t ExplicitTriangulation::footprint(size_t size) const {
+size_t ExplicitTriangulation::footprint(size_t size, const bool quiet) const {
 
   const auto printArrayFootprint
-    = [this](const FlatJaggedArray &array, const std::string &name) {
-        if(!array.empty() && !name.empty()) {
+    = [this, quiet](const FlatJaggedArray &array, const std::string &name) {
+        if(!quiet && !array.empty() && !name.empty()) {
           this->printMsg(name + std::string{": "}
                          + std::to_string(array.footprint()) + " bytes");
         }
@@ -50,7 +58,7 @@ size_t ExplicitTriangulation::footprint(size_t size) const {
   size += printArrayFootprint(edgeLinkData_, "edgeLinkData_");
   size += printArrayFootprint(triangleLinkData_, "triangleLinkData_");
 
-  return AbstractTriangulation::footprint(size);
+  return AbstractTriangulation::footprint(size, quiet);
 }
 
 int ExplicitTriangulation::preconditionBoundaryEdgesInternal() {
@@ -205,11 +213,11 @@ int ExplicitTriangulation::preconditionCellEdgesInternal() {
   os.setWrapper(this);
 
   if(tetraEdgeList_.empty() && getDimensionality() == 3) {
-    os.buildEdgeList(
-      vertexNumber_, *cellArray_, nullptr, nullptr, &tetraEdgeList_);
+    os.buildEdgeList(vertexNumber_, *cellArray_, nullptr, nullptr,
+                     &tetraEdgeList_, &vertexStarData_);
   } else if(triangleEdgeList_.empty() && getDimensionality() == 2) {
-    os.buildEdgeList(
-      vertexNumber_, *cellArray_, nullptr, nullptr, &triangleEdgeList_);
+    os.buildEdgeList(vertexNumber_, *cellArray_, nullptr, nullptr,
+                     &triangleEdgeList_, &vertexStarData_);
   }
 
   return 0;
@@ -254,27 +262,32 @@ int ExplicitTriangulation::preconditionCellTrianglesInternal() {
     if(triangleList_.size()) {
       // we already computed this guy, let's just get the cell triangles
       if(!triangleStarData_.empty()) {
-        return twoSkeleton.buildTriangleList(
-          vertexNumber_, *cellArray_, nullptr, nullptr, &tetraTriangleList_);
+        return twoSkeleton.buildTriangleList(vertexNumber_, *cellArray_,
+                                             nullptr, nullptr,
+                                             &tetraTriangleList_,
+                                             &vertexStarData_);
       } else {
         // let's compute the triangle star while we're at it...
         // it's just a tiny overhead.
         return twoSkeleton.buildTriangleList(vertexNumber_, *cellArray_,
                                              nullptr, &triangleStarData_,
-                                             &tetraTriangleList_);
+                                             &tetraTriangleList_,
+                                             &vertexStarData_);
       }
     } else {
       // we have not computed this guy, let's do it while we're at it
       if(!triangleStarData_.empty()) {
         return twoSkeleton.buildTriangleList(vertexNumber_, *cellArray_,
                                              &triangleList_, nullptr,
-                                             &tetraTriangleList_);
+                                             &tetraTriangleList_,
+                                             &vertexStarData_);
       } else {
         // let's compute the triangle star while we're at it...
         // it's just a tiny overhead.
         return twoSkeleton.buildTriangleList(vertexNumber_, *cellArray_,
                                              &triangleList_, &triangleStarData_,
-                                             &tetraTriangleList_);
+                                             &tetraTriangleList_,
+                                             &vertexStarData_);
       }
     }
   }
@@ -295,10 +308,12 @@ int ExplicitTriangulation::preconditionEdgesInternal() {
     // also computes edgeStar and triangleEdge / tetraEdge lists for free...
     if(getDimensionality() == 2) {
       return oneSkeleton.buildEdgeList(vertexNumber_, *cellArray_, &edgeList_,
-                                       &edgeStarData_, &triangleEdgeList_);
+                                       &edgeStarData_, &triangleEdgeList_,
+                                       &vertexStarData_);
     } else if(getDimensionality() == 3) {
       return oneSkeleton.buildEdgeList(vertexNumber_, *cellArray_, &edgeList_,
-                                       &edgeStarData_, &tetraEdgeList_);
+                                       &edgeStarData_, &tetraEdgeList_,
+                                       &vertexStarData_);
     }
   }
 
@@ -351,8 +366,15 @@ int ExplicitTriangulation::preconditionEdgeStarsInternal() {
   if(edgeStarData_.empty()) {
     OneSkeleton oneSkeleton;
     oneSkeleton.setWrapper(this);
-    return oneSkeleton.buildEdgeList<3>(
-      vertexNumber_, *cellArray_, nullptr, &edgeStarData_, nullptr);
+    // the temporary cell edges list needs the right number of edges per cell
+    if(getDimensionality() == 3) {
+      return oneSkeleton.buildEdgeList<6>(vertexNumber_, *cellArray_, nullptr,
+                                          &edgeStarData_, nullptr,
+                                          &vertexStarData_);
+    }
+    return oneSkeleton.buildEdgeList<3>(vertexNumber_, *cellArray_, nullptr,
+                                        &edgeStarData_, nullptr,
+                                        &vertexStarData_);
   }
   return 0;
 }
@@ -390,7 +412,8 @@ int ExplicitTriangulation::preconditionTrianglesInternal() {
     twoSkeleton.setWrapper(this);
 
     twoSkeleton.buildTriangleList(vertexNumber_, *cellArray_, &triangleList_,
-                                  &triangleStarData_, &tetraTriangleList_);
+                                  &triangleStarData_, &tetraTriangleList_,
+                                  &vertexStarData_);
   }
 
   return 0;
@@ -452,8 +475,9 @@ int ExplicitTriangulation::preconditionTriangleStarsInternal() {
 
     TwoSkeleton twoSkeleton;
     twoSkeleton.setWrapper(this);
-    return twoSkeleton.buildTriangleList(
-      vertexNumber_, *cellArray_, &triangleList_, &triangleStarData_);
+    return twoSkeleton.buildTriangleList(vertexNumber_, *cellArray_,
+                                         &triangleList_, &triangleStarData_,
+                                         nullptr, &vertexStarData_);
   }
 
   return 0;
@@ -472,7 +496,9 @@ int ExplicitTriangulation::preconditionVertexEdgesInternal() {
     if(edgeList_.empty()) {
       OneSkeleton oneSkeleton;
       oneSkeleton.setWrapper(this);
-      oneSkeleton.buildEdgeList(vertexNumber_, *cellArray_, &edgeList_);
+      // no cell edges requested, the template parameter is not used
+      oneSkeleton.buildEdgeList<3>(vertexNumber_, *cellArray_, &edgeList_,
+                                   nullptr, nullptr, &vertexStarData_);
     }
 
     zeroSkeleton.setWrapper(this);
@@ -570,6 +596,130 @@ int ExplicitTriangulation::preconditionVertexTrianglesInternal() {
   return 0;
 }
 
+ExplicitTriangulation::RelationStorage
+  ExplicitTriangulation::getRelationStorage(const Relation &relation) {
+
+  switch(relation) {
+    case Relation::VERTEX_NEIGHBORS:
+      return {&ExplicitTriangulation::vertexNeighborData_,
+              &ExplicitTriangulation::vertexNeighborList_};
+    case Relation::CELL_NEIGHBORS:
+      return {&ExplicitTriangulation::cellNeighborData_,
+              &ExplicitTriangulation::cellNeighborList_};
+    case Relation::VERTEX_EDGES:
+      return {&ExplicitTriangulation::vertexEdgeData_,
+              &ExplicitTriangulation::vertexEdgeList_};
+    case Relation::VERTEX_TRIANGLES:
+      return {&ExplicitTriangulation::vertexTriangleData_,
+              &ExplicitTriangulation::vertexTriangleList_};
+    case Relation::EDGE_TRIANGLES:
+      return {&ExplicitTriangulation::edgeTriangleData_,
+              &ExplicitTriangulation::edgeTriangleList_};
+    case Relation::VERTEX_STARS:
+      return {&ExplicitTriangulation::vertexStarData_,
+              &ExplicitTriangulation::vertexStarList_};
+    case Relation::EDGE_STARS:
+      return {&ExplicitTriangulation::edgeStarData_,
+              &ExplicitTriangulation::edgeStarList_};
+    case Relation::TRIANGLE_STARS:
+      return {&ExplicitTriangulation::triangleStarData_,
+              &ExplicitTriangulation::triangleStarList_};
+    case Relation::VERTEX_LINKS:
+      return {&ExplicitTriangulation::vertexLinkData_,
+              &ExplicitTriangulation::vertexLinkList_};
+    case Relation::EDGE_LINKS:
+      return {&ExplicitTriangulation::edgeLinkData_,
+              &ExplicitTriangulation::edgeLinkList_};
+    case Relation::TRIANGLE_LINKS:
+    default:
+      return {&ExplicitTriangulation::triangleLinkData_,
+              &ExplicitTriangulation::triangleLinkList_};
+  }
+}
+
+size_t
+  ExplicitTriangulation::getRelationFootprint(const Relation &relation) const {
+
+  const auto storage = getRelationStorage(relation);
+
+  size_t size = (this->*storage.data).footprint();
+  for(const auto &vec : this->*storage.list) {
+    size += vec.size() * sizeof(SimplexId);
+  }
+
+  return size;
+}
+
+size_t ExplicitTriangulation::releaseRelation(const Relation &relation) {
+
+  const auto size = getRelationFootprint(relation);
+  const auto storage = getRelationStorage(relation);
+
+  // also drop the external buffers (memory-mapped cache file)
+  this->*storage.data = FlatJaggedArray{};
+  std::vector<std::vector<SimplexId>>{}.swap(this->*storage.list);
+
+  // the relations that are aliases of the released one in lower
+  // dimensions (see the precondition functions in AbstractTriangulation)
+  // have to be pre-conditioned again as well
+  const int dim = getDimensionality();
+  switch(relation) {
+    case Relation::VERTEX_NEIGHBORS:
+      hasPreconditionedVertexNeighbors_ = false;
+      break;
+    case Relation::CELL_NEIGHBORS:
+      hasPreconditionedCellNeighbors_ = false;
+      if(dim == 1) {
+        hasPreconditionedCellEdges_ = false;
+      } else if(dim == 2) {
+        hasPreconditionedCellTriangles_ = false;
+      }
+      break;
+    case Relation::VERTEX_EDGES:
+      hasPreconditionedVertexEdges_ = false;
+      break;
+    case Relation::VERTEX_TRIANGLES:
+      hasPreconditionedVertexTriangles_ = false;
+      break;
+    case Relation::EDGE_TRIANGLES:
+      hasPreconditionedEdgeTriangles_ = false;
+      break;
+    case Relation::VERTEX_STARS:
+      hasPreconditionedVertexStars_ = false;
+      if(dim == 1) {
+        hasPreconditionedVertexEdges_ = false;
+      } else if(dim == 2) {
+        hasPreconditionedVertexTriangles_ = false;
+      }
+      break;
+    case Relation::EDGE_STARS:
+      hasPreconditionedEdgeStars_ = false;
+      if(dim == 2) {
+        hasPreconditionedEdgeTriangles_ = false;
+      }
+      break;
+    case Relation::TRIANGLE_STARS:
+      hasPreconditionedTriangleStars_ = false;
+      break;
+    case Relation::VERTEX_LINKS:
+      hasPreconditionedVertexLinks_ = false;
+      break;
+    case Relation::EDGE_LINKS:
+      hasPreconditionedEdgeLinks_ = false;
+      break;
+    case Relation::TRIANGLE_LINKS:
+      hasPreconditionedTriangleLinks_ = false;
+      break;
+  }
+
+  if(size) {
+    printMsg("Released " + std::to_string(size) + " bytes",
+             debug::Priority::DETAIL);
+  }
+
+  return size;
+}
+
 template <typename T>
 void writeBin(std::ofstream &stream, const T var) {
   stream.write(reinterpret_cast<const char *>(&var), sizeof(var));
@@ -582,23 +732,51 @@ void writeBinArray(std::ofstream &stream,
   stream.write(reinterpret_cast<const char *>(buff), size * sizeof(T));
 }
 
+// the file stores SimplexId identifiers, whatever the storage of the
+// FlatJaggedArray in memory: widen ShortSimplexId buffers by chunks
+void writeBinArrayAsSimplexId(std::ofstream &stream,
+                              const ShortSimplexId *const buff,
+                              const size_t size) {
+  std::array<SimplexId, 4096> chunk{};
+  for(size_t i = 0; i < size; i += chunk.size()) {
+    const size_t n = std::min(chunk.size(), size - i);
+    std::copy(buff + i, buff + i + n, chunk.begin());
+    writeBinArray(stream, chunk.data(), n);
+  }
+}
+
+// alignment (in bytes, relative to the beginning of the file) of the
+// identifier arrays, so they can be used in place when memory-mapped
+static const std::streamoff sectionAlignment{64};
+
+void writePadding(std::ofstream &stream, const std::streampos start) {
+  const auto pos = static_cast<std::streamoff>(stream.tellp() - start);
+  for(auto i = pos; i % sectionAlignment != 0; ++i) {
+    writeBin(stream, char{0});
+  }
+}
+
 // initialize static member variables
 const char *ExplicitTriangulation::magicBytes_ = "TTKTriangulationFileFormat";
-const unsigned long ExplicitTriangulation::formatVersion_ = 1;
+const unsigned long ExplicitTriangulation::formatVersion_ = 2;
 
 int ExplicitTriangulation::writeToFile(std::ofstream &stream) const {
 
+  const auto start = stream.tellp();
+
   // 1. magic bytes (char *)
   stream.write(this->magicBytes_, std::strlen(this->magicBytes_));
   // 2. format version (unsigned long)
   writeBin(stream, this->formatVersion_);
-  // 3. dimensionality (int)
+  // 3. size of identifiers (char, since version 2)
+  writeBin(stream, static_cast<char>(sizeof(SimplexId)));
+  // 4. dimensionality (int)
   const auto dim = this->getDimensionality();
   writeBin(stream, dim);
-  // 4. number of vertices (SimplexId)
+  // 5. number of vertices (SimplexId)
   const auto nVerts = this->getNumberOfVertices();
   writeBin(stream, nVerts);
-  // 5. number of edges (SimplexId)
+  // 6. number of edges (SimplexId)
   const auto edgesNumber = [this, dim]() -> SimplexId {
     if(dim == 1) {
       return this->getNumberOfCells();
@@ -609,7 +787,7 @@ int ExplicitTriangulation::writeToFile(std::ofstream &stream) const {
   };
   const auto nEdges = edgesNumber();
   writeBin(stream, nEdges);
-  // 6. number of triangles (SimplexId, 0 in 1D)
+  // 7. number of triangles (SimplexId, 0 in 1D)
   const auto trianglesNumber = [this, dim]() -> SimplexId {
     if(dim == 2) {
       return this->getNumberOfCells();
@@ -620,7 +798,7 @@ int ExplicitTriangulation::writeToFile(std::ofstream &stream) const {
   };
   const auto nTriangles = trianglesNumber();
   writeBin(stream, nTriangles);
-  // 7. number of tetrahedron (SimplexId, 0 in 2D)
+  // 8. number of tetrahedron (SimplexId, 0 in 2D)
   const auto nTetras = dim > 2 ? this->getNumberOfCells() : 0;
   writeBin(stream, nTetras);
 
@@ -634,18 +812,19 @@ int ExplicitTriangulation::writeToFile(std::ofstream &stream) const {
     writeBin(stream, char{0});                         \
   } else {                                             \
     writeBin(stream, char{1});                         \
+    writePadding(stream, start);                       \
     writeBinArray(stream, ARRAY.data(), ARRAY.size()); \
   }
 
-  // 8. edgeList (SimplexId array)
+  // 9. edgeList (SimplexId array)
   WRITE_FIXED(this->edgeList_);
-  // 9. triangleList (SimplexId array)
+  // 10. triangleList (SimplexId array)
   WRITE_FIXED(this->triangleList_);
-  // 10. triangleEdgeList (SimplexId array)
+  // 11. triangleEdgeList (SimplexId array)
   WRITE_FIXED(this->triangleEdgeList_);
-  // 11. tetraEdgeList (SimplexId array)
+  // 12. tetraEdgeList (SimplexId array)
   WRITE_FIXED(this->tetraEdgeList_);
-  // 12. tetraTriangleList (SimplexId array)
+  // 13. tetraTriangleList (SimplexId array)
   WRITE_FIXED(this->tetraTriangleList_);
 
   // variable-size arrays (FlatJaggedArray in ExplicitTriangulation.h)
@@ -658,34 +837,45 @@ int ExplicitTriangulation::writeToFile(std::ofstream &stream) const {
     writeBin(stream, char{1}); \
   }
 
-  const auto write_variable = [&stream](const FlatJaggedArray &arr) {
+  const auto write_variable = [&stream, start](const FlatJaggedArray &arr) {
     // empty array guard
     WRITE_GUARD(arr);
-    writeBinArray(stream, arr.offset_ptr(), arr.subvectorsNumber() + 1);
-    writeBinArray(stream, arr.get_ptr(0, 0), arr.dataSize());
+    if(arr.hasShortIds()) {
+      writePadding(stream, start);
+      writeBinArrayAsSimplexId(
+        stream, arr.short_offset_ptr(), arr.subvectorsNumber() + 1);
+      writePadding(stream, start);
+      writeBinArrayAsSimplexId(
+        stream, arr.get_short_ptr(0, 0), arr.dataSize());
+    } else {
+      writePadding(stream, start);
+      writeBinArray(stream, arr.offset_ptr(), arr.subvectorsNumber() + 1);
+      writePadding(stream, start);
+      writeBinArray(stream, arr.get_ptr(0, 0), arr.dataSize());
+    }
   };
 
-  // 13. vertexNeighbors (SimplexId array, offsets then data)
+  // 14. vertexNeighbors (SimplexId array, offsets then data)
   write_variable(this->vertexNeighborData_);
-  // 14. cellNeighbors (SimplexId array, offsets then data)
+  // 15. cellNeighbors (SimplexId array, offsets then data)
   write_variable(this->cellNeighborData_);
-  // 15. vertexEdges (SimplexId array, offsets then data)
+  // 16. vertexEdges (SimplexId array, offsets then data)
   write_variable(this->vertexEdgeData_);
-  // 16. vertexTriangles (SimplexId array, offsets then data)
+  // 17. vertexTriangles (SimplexId array, offsets then data)
   write_variable(this->vertexTriangleData_);
-  // 17. edgeTriangles (SimplexId array, offsets then data)
+  // 18. edgeTriangles (SimplexId array, offsets then data)
   write_variable(this->edgeTriangleData_);
-  // 18. vertexStars (SimplexId array, offsets then data)
+  // 19. vertexStars (SimplexId array, offsets then data)
   write_variable(this->vertexStarData_);
-  // 19. edgeStars (SimplexId array, offsets then data)
+  // 20. edgeStars (SimplexId array, offsets then data)
   write_variable(this->edgeStarData_);
-  // 20. triangleStars (SimplexId array, offsets then data)
+  // 21. triangleStars (SimplexId array, offsets then data)
   write_variable(this->triangleStarData_);
-  // 21. vertexLinks (SimplexId array, offsets then data)
+  // 22. vertexLinks (SimplexId array, offsets then data)
   write_variable(this->vertexLinkData_);
-  // 22. edgeLinks (SimplexId array, offsets then data)
+  // 23. edgeLinks (SimplexId array, offsets then data)
   write_variable(this->edgeLinkData_);
-  // 23. triangleLinks (SimplexId array, offsets then data)
+  // 24. triangleLinks (SimplexId array, offsets then data)
   write_variable(this->triangleLinkData_);
 
   const auto write_bool = [&stream](const std::vector<bool> &arr) {
@@ -697,32 +887,255 @@ int ExplicitTriangulation::writeToFile(std::ofstream &stream) const {
     }
   };
 
-  // 24. boundary vertices (bool array)
+  // 25. boundary vertices (bool array)
   write_bool(this->boundaryVertices_);
-  // 25. boundary edges (bool array)
+  // 26. boundary edges (bool array)
   write_bool(this->boundaryEdges_);
-  // 26. boundary triangles (bool array)
+  // 27. boundary triangles (bool array)
   write_bool(this->boundaryTriangles_);
 
   return 0;
 }
 
-template <typename T>
-void readBin(std::ifstream &stream, T &res) {
-  stream.read(reinterpret_cast<char *>(&res), sizeof(res));
-}
+namespace {
+
+  /**
+   * @brief Read the triangulation file format from a std::ifstream
+   *
+   * Every array is copied into memory.
+   */
+  class StreamSource {
+  public:
+    StreamSource(std::ifstream &stream)
+      : stream_{stream}, start_{stream.tellg()} {
+    }
 
-template <typename T>
-void readBinArray(std::ifstream &stream, T *const res, const size_t size) {
-  stream.read(reinterpret_cast<char *>(res), size * sizeof(T));
+    inline void setVersion(const unsigned long version) {
+      this->version_ = version;
+    }
+
+    template <typename T>
+    inline void read(T &res) {
+      this->stream_.read(reinterpret_cast<char *>(&res), sizeof(res));
+    }
+
+    template <typename T>
+    inline void readArray(T *const res, const size_t size) {
+      this->align();
+      this->stream_.read(reinterpret_cast<char *>(res), size * sizeof(T));
+    }
+
+    inline bool readBytes(char *const res, const size_t size) {
+      this->stream_.read(res, size);
+      return this->stream_.good();
+    }
+
+    inline void readJagged(FlatJaggedArray &arr, const SimplexId n_items) {
+      std::vector<SimplexId> offsets{}, data{};
+      offsets.resize(n_items + 1);
+      this->readArray(offsets.data(), offsets.size());
+      data.resize(offsets.back());
+      this->readArray(data.data(), data.size());
+      arr.setData(std::move(data), std::move(offsets));
+    }
+
+    inline bool good() const {
+      return this->stream_.good();
+    }
+
+  private:
+    // skip the padding bytes preceding arrays (since version 2)
+    inline void align() {
+      if(this->version_ < 2) {
+        return;
+      }
+      const auto pos
+        = static_cast<std::streamoff>(this->stream_.tellg() - this->start_);
+      const auto rem = pos % sectionAlignment;
+      if(rem != 0) {
+        this->stream_.seekg(sectionAlignment - rem, std::ios_base::cur);
+      }
+    }
+
+    std::ifstream &stream_;
+    const std::streampos start_;
+    unsigned long version_{1};
+  };
+
+  /**
+   * @brief Read the triangulation file format from a memory mapping
+   *
+   * The FlatJaggedArray buffers directly point into the mapping, the
+   * other arrays are copied.
+   */
+  class MappedSource {
+  public:
+    MappedSource(const char *const base,
+                 const size_t size,
+                 std::shared_ptr<const void> owner)
+      : base_{base}, size_{size}, owner_{std::move(owner)} {
+    }
+
+    inline void setVersion(const unsigned long) {
+    }
+
+    template <typename T>
+    inline void read(T &res) {
+      this->readBytes(reinterpret_cast<char *>(&res), sizeof(res));
+    }
+
+    template <typename T>
+    inline void readArray(T *const res, const size_t size) {
+      this->align();
+      this->readBytes(reinterpret_cast<char *>(res), size * sizeof(T));
+    }
+
+    inline bool readBytes(char *const res, const size_t size) {
+      if(!this->good() || this->pos_ + size > this->size_) {
+        this->pos_ = this->size_ + 1;
+        return false;
+      }
+      std::memcpy(res, this->base_ + this->pos_, size);
+      this->pos_ += size;
+      return true;
+    }
+
+    inline void readJagged(FlatJaggedArray &arr, const SimplexId n_items) {
+      const auto offsets = this->view(n_items + 1);
+      if(offsets == nullptr) {
+        return;
+      }
+      const auto dataSize = offsets[n_items];
+      const auto data = this->view(dataSize);
+      if(data == nullptr) {
+        return;
+      }
+      arr.setExternalData(data, dataSize, offsets, n_items + 1, this->owner_);
+    }
+
+    inline bool good() const {
+      return this->pos_ <= this->size_;
+    }
+
+  private:
+    inline void align() {
+      const auto rem = this->pos_ % sectionAlignment;
+      if(rem != 0) {
+        this->pos_ += sectionAlignment - rem;
+      }
+    }
+
+    // pointer to the next array of size items inside the mapping
+    inline const SimplexId *view(const size_t size) {
+      this->align();
+      const auto nBytes = size * sizeof(SimplexId);
+      if(!this->good() || this->pos_ + nBytes > this->size_) {
+        this->pos_ = this->size_ + 1;
+        return nullptr;
+      }
+      const auto res
+        = reinterpret_cast<const SimplexId *>(this->base_ + this->pos_);
+      this->pos_ += nBytes;
+      return res;
+    }
+
+    const char *const base_;
+    const size_t size_;
+    size_t pos_{};
+    std::shared_ptr<const void> owner_;
+  };
+
+} // namespace
+
+int ExplicitTriangulation::writeToFile(const std::string &fileName) const {
+
+#ifndef _WIN32
+  // readers may have mapped the target file: truncating it would make them
+  // fault (SIGBUS), hence write a new file and rename it over the target
+  const auto path = fileName + "." + std::to_string(getpid()) + ".tmp";
+#else
+  const auto &path = fileName;
+#endif // _WIN32
+
+  std::ofstream stream(path, std::ios::out | std::ios::binary);
+  if(!stream.is_open()) {
+    this->printErr("Could not open `" + path + "'");
+    return -1;
+  }
+  const auto res = this->writeToFile(stream);
+  stream.close();
+  if(res != 0 || stream.fail()) {
+    this->printErr("Could not write `" + path + "'");
+    std::remove(path.data());
+    return -1;
+  }
+
+#ifndef _WIN32
+  if(std::rename(path.data(), fileName.data()) != 0) {
+    this->printErr("Could not rename `" + path + "' to `" + fileName + "'");
+    std::remove(path.data());
+    return -1;
+  }
+#endif // _WIN32
+
+  return 0;
 }
 
 int ExplicitTriangulation::readFromFile(std::ifstream &stream) {
+  StreamSource source{stream};
+  return this->readFromSource(source);
+}
+
+int ExplicitTriangulation::readFromFile(const std::string &fileName) {
+
+#ifndef _WIN32
+  const auto fd = open(fileName.data(), O_RDONLY);
+  if(fd != -1) {
+    struct stat st {};
+    void *addr{MAP_FAILED};
+    if(fstat(fd, &st) == 0 && st.st_size > 0) {
+      addr = mmap(nullptr, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    }
+    // the mapping stays valid after the file descriptor is closed
+    close(fd);
+
+    if(addr != MAP_FAILED) {
+      const size_t size = st.st_size;
+      // unmap when the last array pointing into the file is released
+      std::shared_ptr<const void> mapping{
+        addr, [size](const void *p) { munmap(const_cast<void *>(p), size); }};
+
+      // only the current format version can be used in place
+      const auto magicBytesLen = std::strlen(this->magicBytes_);
+      unsigned long version{};
+      if(size > magicBytesLen + sizeof(version)) {
+        std::memcpy(&version, static_cast<const char *>(addr) + magicBytesLen,
+                    sizeof(version));
+      }
+      if(version == this->formatVersion_) {
+        MappedSource source{static_cast<const char *>(addr), size, mapping};
+        return this->readFromSource(source);
+      }
+      this->printMsg("Format version differs, reading the file into memory");
+    }
+  }
+#endif // _WIN32
+
+  std::ifstream stream(fileName, std::ios::in | std::ios::binary);
+  if(!stream.is_open()) {
+    this->printErr("Could not open `" + fileName + "'");
+    return 0;
+  }
+  return this->readFromFile(stream);
+}
+
+template <typename Source>
+int ExplicitTriangulation::readFromSource(Source &source) {
 
   // 1. magic bytes (char *)
   const auto magicBytesLen = std::strlen(this->magicBytes_);
   std::vector<char> mBytes(magicBytesLen + 1);
-  stream.read(mBytes.data(), magicBytesLen);
+  source.readBytes(mBytes.data(), magicBytesLen);
   const auto hasMagicBytes = std::strcmp(mBytes.data(), this->magicBytes_) == 0;
   if(!hasMagicBytes) {
     this->printErr("Could not find magic bytes in input files!");
@@ -731,26 +1144,39 @@ int ExplicitTriangulation::readFromFile(std::ifstream &stream) {
   }
   // 2. format version (unsigned long)
   unsigned long version{};
-  readBin(stream, version);
+  source.read(version);
   if(version != this->formatVersion_) {
     this->printWrn("File format version (" + std::to_string(version)
                    + ") and software version ("
                    + std::to_string(this->formatVersion_) + ") are different!");
   }
+  source.setVersion(version);
+
+  // 3. size of identifiers (char, since version 2)
+  if(version >= 2) {
+    char idSize{};
+    source.read(idSize);
+    if(idSize != sizeof(SimplexId)) {
+      this->printErr("Incompatible identifiers size ("
+                     + std::to_string(static_cast<int>(idSize))
+                     + " bytes), check TTK_ENABLE_64BIT_IDS!");
+      return 0;
+    }
+  }
 
   int dim{};
   SimplexId nVerts{}, nEdges{}, nTriangles{}, nTetras{};
 
-  // 3. dimensionality (int)
-  readBin(stream, dim);
-  // 4. number of vertices (SimplexId)
-  readBin(stream, nVerts);
-  // 5. number of edges (SimplexId)
-  readBin(stream, nEdges);
-  // 6. number of triangles (SimplexId, 0 in 1D)
-  readBin(stream, nTriangles);
-  // 7. number of tetrahedron (SimplexId, 0 in 2D)
-  readBin(stream, nTetras);
+  // 4. dimensionality (int)
+  source.read(dim);
+  // 5. number of vertices (SimplexId)
+  source.read(nVerts);
+  // 6. number of edges (SimplexId)
+  source.read(nEdges);
+  // 7. number of triangles (SimplexId, 0 in 1D)
+  source.read(nTriangles);
+  // 8. number of tetrahedron (SimplexId, 0 in 2D)
+  source.read(nTetras);
 
   if(dim != this->getDimensionality()) {
     this->printErr("Incorrect dimension!");
@@ -768,73 +1194,68 @@ int ExplicitTriangulation::readFromFile(std::ifstream &stream) {
 
   // fixed-size arrays (in AbstractTriangulation.h)
 
-  const auto read_guard = [&stream]() {
+  const auto read_guard = [&source]() {
     char g{};
-    readBin(stream, g);
+    source.read(g);
     if(g == 0) {
       return true;
     }
     return false;
   };
 
-#define READ_FIXED(ARRAY, N_ITEMS)               \
-  if(!read_guard()) {                            \
-    ARRAY.resize(N_ITEMS);                       \
-    readBinArray(stream, ARRAY.data(), N_ITEMS); \
+#define READ_FIXED(ARRAY, N_ITEMS)           \
+  if(!read_guard()) {                        \
+    ARRAY.resize(N_ITEMS);                   \
+    source.readArray(ARRAY.data(), N_ITEMS); \
   }
 
-  // 8. edgeList (SimplexId array)
+  // 9. edgeList (SimplexId array)
   READ_FIXED(this->edgeList_, nEdges);
-  // 9. triangleList (SimplexId array)
+  // 10. triangleList (SimplexId array)
   READ_FIXED(this->triangleList_, nTriangles);
-  // 10. triangleEdgeList (SimplexId array)
+  // 11. triangleEdgeList (SimplexId array)
   READ_FIXED(this->triangleEdgeList_, nTriangles);
-  // 11. tetraEdgeList (SimplexId array)
+  // 12. tetraEdgeList (SimplexId array)
   READ_FIXED(this->tetraEdgeList_, nTetras);
-  // 12. tetraTriangleList (SimplexId array)
+  // 13. tetraTriangleList (SimplexId array)
   READ_FIXED(this->tetraTriangleList_, nTetras);
 
   // variable-size arrays (FlagJaggedArrays in ExplicitTriangulation.h)
 
   const auto read_variable
-    = [&stream, &read_guard](FlatJaggedArray &arr, const SimplexId n_items) {
+    = [&source, &read_guard](FlatJaggedArray &arr, const SimplexId n_items) {
         // empty array guard
         if(read_guard()) {
           return;
         }
-        std::vector<SimplexId> offsets{}, data{};
-        offsets.resize(n_items + 1);
-        readBinArray(stream, offsets.data(), offsets.size());
-        data.resize(offsets.back());
-        readBinArray(stream, data.data(), data.size());
-        arr.setData(std::move(data), std::move(offsets));
+        source.readJagged(arr, n_items);
       };
 
-  // 13. vertexNeighbors (SimplexId array, offsets then data)
+  // 14. vertexNeighbors (SimplexId array, offsets then data)
   read_variable(this->vertexNeighborData_, nVerts);
-  // 14. cellNeighbors (SimplexId array, offsets then data)
+  // 15. cellNeighbors (SimplexId array, offsets then data)
   read_variable(this->cellNeighborData_, this->getNumberOfCells());
-  // 15. vertexEdges (SimplexId array, offsets then data)
+  // 16. vertexEdges (SimplexId array, offsets then data)
   read_variable(this->vertexEdgeData_, nVerts);
-  // 16. vertexTriangles (SimplexId array, offsets then data)
+  // 17. vertexTriangles (SimplexId array, offsets then data)
   read_variable(this->vertexTriangleData_, nVerts);
-  // 17. edgeTriangles (SimplexId array, offsets then data)
+  // 18. edgeTriangles (SimplexId array, offsets then data)
   read_variable(this->edgeTriangleData_, nEdges);
-  // 18. vertexStars (SimplexId array, offsets then data)
+  // 19. vertexStars (SimplexId array, offsets then data)
   read_variable(this->vertexStarData_, nVerts);
-  // 19. edgeStars (SimplexId array, offsets then data)
+  // 20. edgeStars (SimplexId array, offsets then data)
   read_variable(this->edgeStarData_, nEdges);
-  // 20. triangleStars (SimplexId array, offsets then data)
+  // 21. triangleStars (SimplexId array, offsets then data)
   read_variable(this->triangleStarData_, nTriangles);
-  // 21. vertexLinks (SimplexId array, offsets then data)
+  // 22. vertexLinks (SimplexId array, offsets then data)
   read_variable(this->vertexLinkData_, nVerts);
-  // 22. edgeLinks (SimplexId array, offsets then data)
+  // 23. edgeLinks (SimplexId array, offsets then data)
   read_variable(this->edgeLinkData_, nEdges);
-  // 23. triangleLinks (SimplexId array, offsets then data)
+  // 24. triangleLinks (SimplexId array, offsets then data)
   read_variable(this->triangleLinkData_, nTriangles);
 
   const auto read_bool
-    = [&stream, &read_guard](std::vector<bool> &arr, const SimplexId n_items) {
+    = [&source, &read_guard](std::vector<bool> &arr, const SimplexId n_items) {
         // empty array guard
         if(read_guard()) {
           return;
@@ -843,17 +1264,22 @@ int ExplicitTriangulation::readFromFile(std::ifstream &stream) {
         arr.resize(n_items);
         for(SimplexId i = 0; i < n_items; ++i) {
           char b{};
-          stream.read(&b, sizeof(b));
+          source.read(b);
           arr[i] = static_cast<bool>(b);
         }
       };
 
-  // 24. boundary vertices (bool array)
+  // 25. boundary vertices (bool array)
   read_bool(this->boundaryVertices_, nVerts);
-  // 25. boundary edges (bool array)
+  // 26. boundary edges (bool array)
   read_bool(this->boundaryEdges_, nEdges);
-  // 26. boundary triangles (bool array)
+  // 27. boundary triangles (bool array)
   read_bool(this->boundaryTriangles_, nTriangles);
 
+  if(!source.good()) {
+    this->printErr("Truncated triangulation file!");
+    return 0;
+  }
+
   return 0;
 }
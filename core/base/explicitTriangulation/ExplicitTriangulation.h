@@ -27,7 +27,37 @@ namespace ttk {
 
     int clear();
 
-    size_t footprint(size_t size = 0) const;
+    size_t footprint(size_t size = 0, const bool quiet = false) const;
+
+    /// Pre-conditioned relations whose memory can be released with
+    /// releaseRelation().
+    enum class Relation {
+      VERTEX_NEIGHBORS = 0,
+      CELL_NEIGHBORS,
+      VERTEX_EDGES,
+      VERTEX_TRIANGLES,
+      EDGE_TRIANGLES,
+      VERTEX_STARS,
+      EDGE_STARS,
+      TRIANGLE_STARS,
+      VERTEX_LINKS,
+      EDGE_LINKS,
+      TRIANGLE_LINKS,
+    };
+    static const int RELATION_NUMBER = 11;
+
+    /// Get the memory footprint (in bytes) of the given pre-conditioned
+    /// relation, including the list returned by its whole-mesh getter.
+    size_t getRelationFootprint(const Relation &relation) const;
+
+    /// Release the memory of the given pre-conditioned relation.
+    ///
+    /// The relation is computed again by the next call to its
+    /// pre-conditioning function (e.g. preconditionVertexStars() for
+    /// Relation::VERTEX_STARS), the other relations are left untouched.
+    /// \warning The triangulation should not be traversed concurrently.
+    /// \return Returns the number of released bytes.
+    size_t releaseRelation(const Relation &relation);
 
     inline int getCellEdgeInternal(const SimplexId &cellId,
                                    const int &localEdgeId,
@@ -606,14 +636,42 @@ namespace ttk {
      * Use a custom binary format for fast loading
      */
     int writeToFile(std::ofstream &stream) const;
+    /**
+     * @brief Write internal state to disk
+     *
+     * The file is written under a temporary name, then renamed over
+     * @p fileName: it is never rewritten in place, so that a process that
+     * mapped it (see readFromFile(const std::string &)) keeps reading the
+     * former contents.
+     */
+    int writeToFile(const std::string &fileName) const;
     /**
      * @brief Read from disk into internal state
      *
      * Use a custom binary format for fast loading
      */
     int readFromFile(std::ifstream &stream);
+    /**
+     * @brief Read from disk into internal state
+     *
+     * When supported, the file is memory-mapped and the variable-size
+     * arrays are used in place (no copy, page cache shared between
+     * processes). Falls back to readFromFile(std::ifstream &) for other
+     * format versions.
+     */
+    int readFromFile(const std::string &fileName);
 
   private:
+    template <typename Source>
+    int readFromSource(Source &source);
+
+    // storage of a releasable relation
+    struct RelationStorage {
+      FlatJaggedArray ExplicitTriangulation::*data;
+      std::vector<std::vector<SimplexId>> AbstractTriangulation::*list;
+    };
+    static RelationStorage getRelationStorage(const Relation &relation);
+
     bool doublePrecision_;
     SimplexId cellNumber_, vertexNumber_;
     const void *pointSet_;
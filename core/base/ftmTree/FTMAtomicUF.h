@@ -18,16 +18,16 @@
 #include <memory>
 #include <vector>
 
+#include <AtomicUnionFind.h>
+
 #include "FTMDataTypes.h"
 #include "FTMStructures.h"
 
 namespace ttk {
   namespace ftm {
 
-    class AtomicUF {
+    class AtomicUF : public AtomicUnionFind<AtomicUF> {
     private:
-      unsigned rank_{};
-      AtomicUF *parent_{};
       SharedData data_;
 
     public:
@@ -35,21 +35,6 @@ namespace ttk {
         : data_(extrema) {
       }
 
-      // heavy recursif
-      inline AtomicUF *find() {
-        if(parent_ == nullptr)
-          return this;
-        else {
-          decltype(parent_) tmp = parent_->find();
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp atomic write
-#endif
-          parent_ = tmp;
-
-          return parent_;
-        }
-      }
-
       // Shared data get/set
 
       inline SimplexId getExtrema(void) const {
@@ -120,69 +105,10 @@ namespace ttk {
         return s;
       }
 
-      // UF get / set
-
-      inline int getRank() const {
-        return rank_;
-      }
-
-      inline void setRank(const int &rank) {
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp atomic write
-#endif
-        rank_ = rank;
-      }
-
-      inline void setParent(AtomicUF *parent) {
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp atomic write
-#endif
-        parent_ = parent;
-      }
-
-      static inline AtomicUF *makeUnion(AtomicUF *uf0, AtomicUF *uf1) {
-        uf0 = uf0->find();
-        uf1 = uf1->find();
-
-        if(uf0 == uf1) {
-          return uf0;
-        } else if(uf0->getRank() > uf1->getRank()) {
-          uf1->setParent(uf0);
-          uf0->data_.merge(uf1->data_);
-          return uf0;
-        } else if(uf0->getRank() < uf1->getRank()) {
-          uf0->setParent(uf1);
-          uf1->data_.merge(uf0->data_);
-          return uf1;
-        } else {
-          uf1->setParent(uf0);
-          uf0->setRank(uf0->getRank() + 1);
-          uf0->data_.merge(uf1->data_);
-          return uf0;
-        }
-      }
-
-      static inline AtomicUF *makeUnion(std::vector<AtomicUF *> &sets) {
-        AtomicUF *n = NULL;
-
-        if(!sets.size())
-          return NULL;
-
-        if(sets.size() == 1)
-          return sets[0];
-
-        for(int i = 0; i < (int)sets.size() - 1; i++)
-          n = makeUnion(sets[i], sets[i + 1]);
-
-        return n;
-      }
-
-      inline bool operator<(const AtomicUF &other) const {
-        return rank_ < other.rank_;
-      }
+      // UF union (see AtomicUnionFind::makeUnion)
 
-      inline bool operator>(const AtomicUF &other) const {
-        return rank_ > other.rank_;
+      inline void mergeData(AtomicUF &other) {
+        data_.merge(other.data_);
       }
     };
 
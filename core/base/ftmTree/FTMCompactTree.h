@@ -0,0 +1,153 @@
+/// \ingroup base
+/// \class ttk::ftm::CompactTree
+/// \date October 2026.
+///
+///\brief Read-only copy of a built FTMTree_MT in flat arrays.
+///
+/// The fields of the nodes and of the super arcs are copied in contiguous
+/// arrays (one per field), the arcs of each node and the regular vertices
+/// of each arc in CSR arrays (an offset array and a value array). This is
+/// not the storage of the build: the tree is built with its Node and
+/// SuperArc objects, then copied here, and only the segmentation of the
+/// arcs is moved (the SuperArc accessors then read the CSR array).
+///
+/// \sa ttk::ftm::FTMTree_MT::setCompactStorage
+
+#ifndef COMPACT_TREE_H
+#define COMPACT_TREE_H
+
+#include <memory>
+#include <vector>
+
+#include "FTMDataTypes.h"
+
+namespace ttk {
+  namespace ftm {
+    // range of the regular vertices of an arc, for range-based loops
+    struct ArcVertices {
+      const SimplexId *first, *last;
+
+      inline const SimplexId *begin(void) const {
+        return first;
+      }
+
+      inline const SimplexId *end(void) const {
+        return last;
+      }
+    };
+
+    class CompactTree {
+      friend class FTMTree_MT;
+
+    private:
+      // nodes
+      std::vector<SimplexId> nodeVertices_{};
+      // CSR adjacency of the nodes: arcs of node n in
+      // [offsets[n], offsets[n + 1])
+      std::vector<idSuperArc> upOffsets_{}, upArcs_{};
+      std::vector<idSuperArc> downOffsets_{}, downArcs_{};
+
+      // arcs
+      std::vector<idNode> arcDownNodes_{}, arcUpNodes_{};
+      std::vector<idSuperArc> arcNormalizedIds_{};
+      // CSR segmentation: regular vertices of arc a, sorted along the arc,
+      // in [offsets[a], offsets[a + 1])
+      std::vector<SimplexId> segmOffsets_{}, segmVertices_{};
+
+      // segmentation identifier of each vertex (normalized arc id if the
+      // ids are normalized), null without segmentation or once released
+      std::unique_ptr<SimplexId[]> vertexSegmentation_{};
+
+    public:
+      inline void clear(void) {
+        *this = CompactTree{};
+      }
+
+      // -----
+      // NODES
+      // -----
+
+      inline idNode getNumberOfNodes(void) const {
+        return nodeVertices_.size();
+      }
+
+      inline SimplexId getVertexId(const idNode n) const {
+        return nodeVertices_[n];
+      }
+
+      inline idSuperArc getNumberOfUpSuperArcs(const idNode n) const {
+        return upOffsets_[n + 1] - upOffsets_[n];
+      }
+
+      inline idSuperArc getNumberOfDownSuperArcs(const idNode n) const {
+        return downOffsets_[n + 1] - downOffsets_[n];
+      }
+
+      inline idSuperArc getUpSuperArcId(const idNode n,
+                                        const idSuperArc i) const {
+        return upArcs_[upOffsets_[n] + i];
+      }
+
+      inline idSuperArc getDownSuperArcId(const idNode n,
+                                          const idSuperArc i) const {
+        return downArcs_[downOffsets_[n] + i];
+      }
+
+      // ----
+      // ARCS
+      // ----
+
+      inline idSuperArc getNumberOfSuperArcs(void) const {
+        return arcUpNodes_.size();
+      }
+
+      inline idNode getUpNodeId(const idSuperArc a) const {
+        return arcUpNodes_[a];
+      }
+
+      inline idNode getDownNodeId(const idSuperArc a) const {
+        return arcDownNodes_[a];
+      }
+
+      inline idSuperArc getNormalizedId(const idSuperArc a) const {
+        return arcNormalizedIds_[a];
+      }
+
+      // ------------
+      // SEGMENTATION
+      // ------------
+
+      inline SimplexId getArcSize(const idSuperArc a) const {
+        return segmOffsets_[a + 1] - segmOffsets_[a];
+      }
+
+      inline const SimplexId *arcBegin(const idSuperArc a) const {
+        return segmVertices_.data() + segmOffsets_[a];
+      }
+
+      inline const SimplexId *arcEnd(const idSuperArc a) const {
+        return segmVertices_.data() + segmOffsets_[a + 1];
+      }
+
+      inline ArcVertices getRegularVertices(const idSuperArc a) const {
+        return ArcVertices{arcBegin(a), arcEnd(a)};
+      }
+
+      // contiguous arrays, for exports
+
+      inline const std::vector<SimplexId> &getNodeVertices(void) const {
+        return nodeVertices_;
+      }
+
+      // hand the segmentation identifier of each vertex over to the caller,
+      // who then owns it (allocated with new[], one entry per vertex of the
+      // tree), nullptr without segmentation or if already released
+      inline SimplexId *releaseVertexSegmentation(void) {
+        return vertexSegmentation_.release();
+      }
+    };
+
+  } // namespace ftm
+} // namespace ttk
+
+#endif /* end of include guard: COMPACT_TREE_H */
@@ -84,6 +84,10 @@ namespace ttk {
 
     enum TreeType : char { Join = 0, Split = 1, Contour = 2, Join_Split = 3 };
 
+    // scheduler of the leaf growth and trunk tasks (work stealing is
+    // experimental, see WorkStealingScheduler)
+    enum class TaskScheduler : char { OpenMP = 0, WorkStealing = 1 };
+
     enum SimplifMethod : char { Persist = 0, Span = 1, NbVert = 2, NbArc = 3 };
 
     enum ComponentState : char { Visible, Hidden, Pruned, Merged };
@@ -0,0 +1,278 @@
+/// \ingroup base
+/// \class ttk::ftm::WorkStealingScheduler
+/// \date October 2026.
+///
+/// \brief Work-stealing task scheduler for the growth of the FTM trees.
+///
+/// Each worker owns a deque of tasks: it pushes and pops its own tasks at
+/// the back (the last spawned task, hot in cache, runs first) while idle
+/// workers steal at the front, from a victim chosen at random. The workers
+/// are OpenMP tasks of the enclosing parallel region, so that the join and
+/// split trees can be grown concurrently, each with its own scheduler.
+///
+/// Ranges of vertices are split adaptively (lazy binary splitting): a worker
+/// processing a range gives its second half away only when its own deque is
+/// empty, i.e. when other workers may be starving. Idle workers back off
+/// (see backOff()) rather than poll the deques continuously.
+///
+/// A task is a pair of identifiers passed to the body of the scheduler
+/// (e.g. a leaf and its origin, or a range of vertices): spawning a task
+/// does not allocate memory, except when a deque grows.
+///
+/// The busy time, the number of tasks and the number of steals of each
+/// worker are recorded to measure the load balance.
+///
+/// \warning Experimental: it has only been timed on a single core so far,
+/// where it is not faster than the OpenMP tasks. Whether it shortens the
+/// idle tail of the leaf growth on skewed data with several cores remains
+/// to be measured (see standalone/FTMTreeBenchmark, -S 1 -k).
+///
+/// \sa ttk::ftm::FTMTree_MT
+
+#pragma once
+
+#include <Debug.h>
+#include <OpenMPLock.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <new>
+#include <thread>
+#include <vector>
+
+namespace ttk {
+  namespace ftm {
+
+    /// Load balance of a worker
+    struct WorkerStats {
+      double busyTime{};
+      SimplexId nbTasks{};
+      SimplexId nbSteals{};
+    };
+
+    class WorkStealingScheduler {
+    public:
+      /// Body of the tasks, called with the two identifiers of a task and
+      /// the worker running it
+      using Body = std::function<void(
+        const SimplexId first, const SimplexId second, const int worker)>;
+
+      explicit WorkStealingScheduler(const int nbWorkers)
+        : nbWorkers_{std::max(nbWorkers, 1)},
+          buffer_{new char[nbWorkers_ * sizeof(Worker) + alignof(Worker)]} {
+        // operator new only guarantees the fundamental alignment before
+        // C++17: the workers are aligned by hand in the buffer
+        void *first = buffer_.get();
+        std::size_t space = nbWorkers_ * sizeof(Worker) + alignof(Worker);
+        std::align(alignof(Worker), nbWorkers_ * sizeof(Worker), first, space);
+        workers_ = static_cast<Worker *>(first);
+        for(int w = 0; w < nbWorkers_; ++w) {
+          new(&workers_[w]) Worker{};
+          workers_[w].seed = 2 * w + 1;
+        }
+      }
+
+      ~WorkStealingScheduler() {
+        for(int w = 0; w < nbWorkers_; ++w) {
+          workers_[w].~Worker();
+        }
+      }
+
+      WorkStealingScheduler(const WorkStealingScheduler &) = delete;
+      WorkStealingScheduler &operator=(const WorkStealingScheduler &) = delete;
+
+      inline int getNumberOfWorkers() const {
+        return nbWorkers_;
+      }
+
+      /// Set the body of the tasks, before they run
+      inline void setBody(Body body) {
+        body_ = std::move(body);
+      }
+
+      /// Push a task on the deque of a worker: the body will be called on
+      /// these two identifiers (no allocation but the deque growth)
+      inline void spawn(const int worker,
+                        const SimplexId first,
+                        const SimplexId second) {
+        pending_++;
+        Worker &owner = workers_[worker];
+        owner.lock.lock();
+        owner.tasks.emplace_back(Task{first, second});
+        owner.nbTasks.store(owner.tasks.size(), std::memory_order_relaxed);
+        owner.lock.unlock();
+      }
+
+      /// Whether a worker has no task left in its deque
+      inline bool isHungry(const int worker) const {
+        return workers_[worker].nbTasks.load(std::memory_order_relaxed) == 0;
+      }
+
+      /// Call func on sub-ranges of at most grain elements of [begin, end),
+      /// handing the second half of the remaining range to the other
+      /// workers whenever this worker has nothing left to give away (sets
+      /// the body of the tasks)
+      void spawnRange(const int worker,
+                      const SimplexId begin,
+                      const SimplexId end,
+                      const SimplexId grain,
+                      const std::function<void(SimplexId, SimplexId)> &func) {
+        setBody([this, grain, func](
+                  const SimplexId first, const SimplexId second, const int w) {
+          SimplexId lo = first;
+          SimplexId hi = second;
+          while(lo < hi) {
+            if(hi - lo > 2 * grain && isHungry(w)) {
+              const SimplexId mid = lo + (hi - lo) / 2;
+              spawn(w, mid, hi);
+              hi = mid;
+              continue;
+            }
+            const SimplexId stop = std::min(hi, lo + grain);
+            func(lo, stop);
+            lo = stop;
+          }
+        });
+        spawn(worker, begin, end);
+      }
+
+      /// Run the spawned tasks and the tasks they spawn until none is left
+      void run() {
+        const int nbWorkers = nbWorkers_;
+#ifdef TTK_ENABLE_OPENMP
+        for(int w = 0; w < nbWorkers; ++w) {
+#pragma omp task firstprivate(w)
+          work(w);
+        }
+#pragma omp taskwait
+#else
+        for(int w = 0; w < nbWorkers; ++w) {
+          work(w);
+        }
+#endif
+      }
+
+      /// Statistics of each worker
+      std::vector<WorkerStats> getStats() const {
+        std::vector<WorkerStats> stats{};
+        for(int w = 0; w < nbWorkers_; ++w) {
+          stats.emplace_back(workers_[w].stats);
+        }
+        return stats;
+      }
+
+    protected:
+      // aggregate (no default member initializers in C++11)
+      struct Task {
+        SimplexId first;
+        SimplexId second;
+      };
+
+      // each worker on its own cache lines: no false sharing between the
+      // lock and the task count of a worker and those of its neighbors
+      struct alignas(64) Worker {
+        Lock lock{};
+        std::deque<Task> tasks{};
+        std::atomic<size_t> nbTasks{0};
+        WorkerStats stats{};
+        std::uint32_t seed{};
+      };
+
+      void work(const int worker) {
+        Task task{0, 0};
+        Timer tm{};
+        // failed attempts to find a task since the last one
+        int nbFailures{};
+        while(pending_.load() > 0) {
+          if(pop(worker, task) || steal(worker, task)) {
+            nbFailures = 0;
+            tm.reStart();
+            body_(task.first, task.second, worker);
+            workers_[worker].stats.busyTime += tm.getElapsedTime();
+            workers_[worker].stats.nbTasks++;
+            pending_--;
+          } else {
+            // without OpenMP, the workers run in sequence and the first one
+            // empties every deque
+            backOff(nbFailures++);
+          }
+        }
+      }
+
+      /// Wait before the next attempt of an idle worker to find a task:
+      /// first give the core away, then sleep for exponentially longer
+      /// periods (capped), so that idle workers neither hog their core nor
+      /// hammer the deques of the busy ones (taskyield does nothing with
+      /// some OpenMP runtimes, e.g. libgomp)
+      static void backOff(const int nbFailures) {
+        constexpr int nbYields = 16;
+        constexpr int maxSleepLog2 = 7;
+        if(nbFailures < nbYields) {
+          std::this_thread::yield();
+        } else {
+          const int sleepLog2 = std::min(nbFailures - nbYields, maxSleepLog2);
+          std::this_thread::sleep_for(
+            std::chrono::microseconds(1 << sleepLog2));
+        }
+      }
+
+      bool pop(const int worker, Task &task) {
+        Worker &owner = workers_[worker];
+        owner.lock.lock();
+        const bool found = !owner.tasks.empty();
+        if(found) {
+          task = std::move(owner.tasks.back());
+          owner.tasks.pop_back();
+          owner.nbTasks.store(owner.tasks.size(), std::memory_order_relaxed);
+        }
+        owner.lock.unlock();
+        return found;
+      }
+
+      bool steal(const int worker, Task &task) {
+        const int nbWorkers = nbWorkers_;
+        if(nbWorkers == 1) {
+          return false;
+        }
+        // xorshift random victim
+        auto &seed = workers_[worker].seed;
+        seed ^= seed << 13;
+        seed ^= seed >> 17;
+        seed ^= seed << 5;
+        const int first = seed % nbWorkers;
+        for(int i = 0; i < nbWorkers; ++i) {
+          const int victim = (first + i) % nbWorkers;
+          if(victim == worker || isHungry(victim)) {
+            continue;
+          }
+          Worker &other = workers_[victim];
+          other.lock.lock();
+          const bool found = !other.tasks.empty();
+          if(found) {
+            task = std::move(other.tasks.front());
+            other.tasks.pop_front();
+            other.nbTasks.store(other.tasks.size(), std::memory_order_relaxed);
+          }
+          other.lock.unlock();
+          if(found) {
+            workers_[worker].stats.nbSteals++;
+            return true;
+          }
+        }
+        return false;
+      }
+
+      const int nbWorkers_;
+      Body body_{};
+      std::unique_ptr<char[]> buffer_;
+      Worker *workers_{};
+      std::atomic<SimplexId> pending_{0};
+    };
+
+  } // namespace ftm
+} // namespace ttk
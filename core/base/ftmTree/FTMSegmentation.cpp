@@ -224,6 +224,27 @@ void ArcRegion::createSegmentation(const Scalars *s) {
 #endif
 }
 
+void ArcRegion::updateSegmentation(vector<SimplexId> &removed,
+                                   vector<SimplexId> &added,
+                                   const Scalars *s) {
+  auto comp = [s](SimplexId a, SimplexId b) { return s->isLower(a, b); };
+
+  sort(removed.begin(), removed.end());
+  segmentation_.erase(remove_if(segmentation_.begin(), segmentation_.end(),
+                                [&removed](const SimplexId v) {
+                                  return binary_search(
+                                    removed.begin(), removed.end(), v);
+                                }),
+                      segmentation_.end());
+
+  // the remaining vertices kept their relative order
+  sort(added.begin(), added.end(), comp);
+  const auto nbKept = segmentation_.size();
+  segmentation_.insert(segmentation_.end(), added.begin(), added.end());
+  inplace_merge(segmentation_.begin(), segmentation_.begin() + nbKept,
+                segmentation_.end(), comp);
+}
+
 SimplexId ArcRegion::findBelow(SimplexId v,
                                const Scalars *s,
                                const vector<idCorresp> &vert2treeOther) const {
@@ -312,9 +333,10 @@ tuple<SimplexId, ArcRegion> ArcRegion::splitBack(SimplexId v,
   for(decltype(segmentsIn_)::iterator it = segmentsIn_.begin();
       it != segmentsIn_.end(); ++it) {
     auto &reg = *it;
-    if(s->isLower(*reg.segmentBegin, v)
-       && s->isHigher(*(reg.segmentEnd - 1), v)) {
-      // is v is between beg/end
+    if(!s->isHigher(*reg.segmentBegin, v)
+       && !s->isLower(*(reg.segmentEnd - 1), v)) {
+      // is v is between beg/end (bounds included: v may be the first or
+      // last vertex of the region if it is a node of the other tree)
       // append once
       const auto &oldBeg = reg.segmentBegin;
       auto posV = lower_bound(oldBeg, reg.segmentEnd, v, comp);
@@ -367,9 +389,9 @@ tuple<SimplexId, ArcRegion> ArcRegion::splitFront(SimplexId v,
   for(decltype(segmentsIn_)::iterator it = segmentsIn_.begin();
       it != segmentsIn_.end(); ++it) {
     auto &reg = *it;
-    if(s->isLower(*reg.segmentBegin, v)
-       && s->isHigher(*(reg.segmentEnd - 1), v)) {
-      // is v is between beg/end
+    if(!s->isHigher(*reg.segmentBegin, v)
+       && !s->isLower(*(reg.segmentEnd - 1), v)) {
+      // is v is between beg/end (bounds included, see splitBack)
       // append once
       const auto &oldEnd = reg.segmentEnd;
       auto posV = lower_bound(reg.segmentBegin, oldEnd, v, comp);
@@ -145,6 +145,12 @@ namespace ttk {
       // a segment can contain vertices for several arcs
       void createSegmentation(const Scalars *s);
 
+      // Remove then insert vertices in the (created) segmentation, keeping
+      // it sorted, for the incremental update of a tree
+      void updateSegmentation(std::vector<SimplexId> &removed,
+                              std::vector<SimplexId> &added,
+                              const Scalars *s);
+
       inline SimplexId count(void) const {
         SimplexId res = 0;
         for(const auto &reg : segmentsIn_) {
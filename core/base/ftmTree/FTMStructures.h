@@ -31,6 +31,8 @@ namespace ttk {
       bool normalize = true;
       bool advStats = true;
       int samplingLvl = 0;
+      TaskScheduler scheduler = TaskScheduler::OpenMP;
+      bool compact = false;
     };
 
 #ifdef TTK_ENABLE_FTM_TREE_STATS_TIME
@@ -50,6 +52,9 @@ namespace ttk {
       // [0] -> vertex id of the global miminum
       // [size-1] -> vertex id of the global maximum
       std::vector<SimplexId> sortedVertices{};
+      // offset of each vertex in sortedVertices, kept by FTMTree::update()
+      // for the next update (empty after a sort)
+      std::vector<SimplexId> sortedOffsets{};
 
       bool isLower(SimplexId a, SimplexId b) const {
         return offsets[a] < offsets[b];
@@ -40,6 +40,10 @@ namespace ttk {
       ArcRegion region_;
       SimplexId verticesSeen_;
       idSuperArc normalizedId_;
+      // segmentation moved to the CompactTree (see releaseSegmentation):
+      // range of the regular vertices of this arc in its CSR array
+      bool released_;
+      std::vector<SimplexId>::iterator compactBegin_, compactEnd_;
 
     public:
       // -----------------
@@ -50,14 +54,15 @@ namespace ttk {
       SuperArc()
         : downNodeId_(nullNodes), upNodeId_(nullNodes),
           state_(ComponentState::Visible), lastVisited_(nullVertex), region_(),
-          verticesSeen_(0), normalizedId_(nullSuperArc) {
+          verticesSeen_(0), normalizedId_(nullSuperArc), released_(false) {
       }
 
       SuperArc(idNode d,
                idNode u,
                const ComponentState &state = ComponentState::Visible)
         : downNodeId_(d), upNodeId_(u), state_(state), lastVisited_(nullVertex),
-          region_(), verticesSeen_(0), normalizedId_(nullSuperArc) {
+          region_(), verticesSeen_(0), normalizedId_(nullSuperArc),
+          released_(false) {
       }
 
       // ------------------
@@ -157,6 +162,12 @@ namespace ttk {
         region_.createSegmentation(s);
       }
 
+      inline void updateSegmentation(std::vector<SimplexId> &removed,
+                                     std::vector<SimplexId> &added,
+                                     const Scalars *s) {
+        region_.updateSegmentation(removed, added, s);
+      }
+
       // Direct read access to the list of region
       const std::list<Region> &getRegions(void) const {
         return region_.getRegions();
@@ -178,37 +189,67 @@ namespace ttk {
         region_.clear();
       }
 
+      // free the segmentation once copied in the CompactTree of the tree,
+      // the accessors below then read [begin, end) of its CSR array (see
+      // FTMTree_MT::setCompactStorage)
+      void releaseSegmentation(const std::vector<SimplexId>::iterator &begin,
+                               const std::vector<SimplexId>::iterator &end) {
+        region_ = ArcRegion{};
+        released_ = true;
+        compactBegin_ = begin;
+        compactEnd_ = end;
+      }
+
+      inline bool isSegmentationReleased(void) const {
+        return released_;
+      }
+
       // access segmentation (after createSegmentation)
       // vector-like
 
       inline size_t size(void) const {
+        if(released_) {
+          return compactEnd_ - compactBegin_;
+        }
         return region_.size();
       }
 
       std::vector<SimplexId>::iterator begin(void) {
+        if(released_) {
+          return compactBegin_;
+        }
         return region_.begin();
       }
 
       std::vector<SimplexId>::iterator end(void) {
+        if(released_) {
+          return compactEnd_;
+        }
         return region_.end();
       }
 
       SimplexId operator[](SimplexId v) const {
+        if(released_) {
+          return compactBegin_[v];
+        }
         return region_[v];
       }
 
       SimplexId &operator[](SimplexId v) {
+        if(released_) {
+          return compactBegin_[v];
+        }
         return region_[v];
       }
 
       // Access Segmentation legacy
 
       SimplexId getNumberOfRegularNodes() const {
-        return region_.size();
+        return size();
       }
 
       SimplexId getRegularNodeId(SimplexId id) const {
-        return region_[id];
+        return (*this)[id];
       }
 
       // process segmentation
@@ -47,6 +47,27 @@ namespace ttk {
       // Need triangulation, scalars and all params set before call
       template <typename scalarType, class triangulationType>
       void build(const triangulationType *mesh);
+
+      // Update the tree of the previous build (or update) once the order of
+      // changedVertices changed, the other vertices keeping their relative
+      // order (time-varying fields). Return true if the tree was repaired in
+      // place, false if it was rebuilt.
+      // The tree is only repaired in place if a local certificate proves
+      // that no changed vertex alters the join and split trees (each stays
+      // regular, or a leaf crossing no neighbor, and the global extrema are
+      // kept): the changed regular vertices then move to their new arc.
+      // Creating, cancelling or moving a critical point past a neighbor
+      // rebuilds the tree, which is frequent on noisy fields (see
+      // FTMTreeBenchmark). The certificate reads the changed vertices and
+      // their neighbors only and is checked first, so a rebuild costs about
+      // as much as build(); a repair still makes a few O(n) passes.
+      // With TreeType::Contour, only the contour tree is repaired: the join
+      // and split trees (getJoinTree(), getSplitTree()) are intermediate
+      // results of build() and are invalid after an update that did not
+      // rebuild.
+      template <typename scalarType, class triangulationType>
+      bool update(const triangulationType *mesh,
+                  const std::vector<SimplexId> &changedVertices);
     };
 
 #include "FTMTree_Template.h"
@@ -325,6 +325,58 @@ void FTMTree_CT::finalizeSegmentation(void) {
   printTime(finSegmTime, "post-process segm", -1, 4);
 }
 
+idSuperArc FTMTree_CT::getArcBetween(const SimplexId v,
+                                     const SimplexId below,
+                                     const SimplexId above) {
+  // arcs spanning v above below
+  vector<idSuperArc> spanning, toVisit;
+  if(isCorrespondingArc(below)) {
+    toVisit.emplace_back(getCorrespondingSuperArcId(below));
+  } else {
+    const Node *node = vertex2Node(below);
+    for(idSuperArc i = 0; i < node->getNumberOfUpSuperArcs(); ++i) {
+      toVisit.emplace_back(node->getUpSuperArcId(i));
+    }
+  }
+  while(!toVisit.empty()) {
+    const idSuperArc arc = toVisit.back();
+    toVisit.pop_back();
+    const Node *up = getUpNode(getSuperArc(arc));
+    if(scalars_->isLower(v, up->getVertexId())) {
+      spanning.emplace_back(arc);
+    } else {
+      for(idSuperArc i = 0; i < up->getNumberOfUpSuperArcs(); ++i) {
+        toVisit.emplace_back(up->getUpSuperArcId(i));
+      }
+    }
+  }
+
+  // the edges below-v and v-above map to the monotone path between them
+  if(isCorrespondingArc(above)) {
+    toVisit.emplace_back(getCorrespondingSuperArcId(above));
+  } else {
+    const Node *node = vertex2Node(above);
+    for(idSuperArc i = 0; i < node->getNumberOfDownSuperArcs(); ++i) {
+      toVisit.emplace_back(node->getDownSuperArcId(i));
+    }
+  }
+  while(!toVisit.empty()) {
+    const idSuperArc arc = toVisit.back();
+    toVisit.pop_back();
+    if(find(spanning.begin(), spanning.end(), arc) != spanning.end()) {
+      return arc;
+    }
+    const Node *down = getDownNode(getSuperArc(arc));
+    if(scalars_->isLower(v, down->getVertexId())) {
+      for(idSuperArc i = 0; i < down->getNumberOfDownSuperArcs(); ++i) {
+        toVisit.emplace_back(down->getDownSuperArcId(i));
+      }
+    }
+  }
+
+  return nullSuperArc;
+}
+
 void FTMTree_CT::insertNodes(void) {
   vector<idNode> sortedJTNodes = jt_->sortedNodes(true);
   vector<idNode> sortedSTNodes = st_->sortedNodes(true);
@@ -44,6 +44,8 @@ namespace ttk {
       // ACCESSOR
       // -----------------
 
+      // the join and split trees of a contour tree are not repaired by
+      // FTMTree::update()
       inline FTMTree_MT *getJoinTree(void) const {
         return jt_;
       }
@@ -111,6 +113,12 @@ namespace ttk {
                                    idSuperArc xtArc);
 
       void finalizeSegmentation(void);
+
+      /// \brief Arc of the regular vertex v, on the monotone path between
+      /// its neighbors below and above (see FTMTree::update)
+      idSuperArc getArcBetween(const SimplexId v,
+                               const SimplexId below,
+                               const SimplexId above);
     };
 
   } // namespace ftm
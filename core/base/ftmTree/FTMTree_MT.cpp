@@ -552,6 +552,12 @@ void FTMTree_MT::normalizeIds(void) {
   Timer normTime;
   sortLeaves(true);
 
+  // ids of a previous normalization (incremental update)
+  const idSuperArc nbArcs = getNumberOfSuperArcs();
+  for(idSuperArc a = 0; a < nbArcs; ++a) {
+    getSuperArc(a)->setNormalizeIds(nullSuperArc);
+  }
+
   auto getNodeParentArcNb
     = [&](const idNode curNode, const bool goUp) -> idSuperArc {
     if(goUp) {
@@ -647,6 +653,142 @@ void FTMTree_MT::normalizeIds(void) {
   printTime(normTime, "normalize ids", -1, 4);
 }
 
+void FTMTree_MT::compact(void) {
+  Timer compactTime;
+  CompactTree &compact = mt_data_.compact;
+  const idNode nbNodes = getNumberOfNodes();
+  const idSuperArc nbArcs = getNumberOfSuperArcs();
+  const bool segm = params_->segm;
+  const bool normalize = params_->normalize;
+
+  // nodes and their CSR adjacency
+  compact.nodeVertices_.resize(nbNodes);
+  compact.upOffsets_.resize(nbNodes + 1);
+  compact.downOffsets_.resize(nbNodes + 1);
+  compact.upOffsets_[0] = 0;
+  compact.downOffsets_[0] = 0;
+  for(idNode n = 0; n < nbNodes; ++n) {
+    const Node *node = getNode(n);
+    compact.nodeVertices_[n] = node->getVertexId();
+    compact.upOffsets_[n + 1]
+      = compact.upOffsets_[n] + node->getNumberOfUpSuperArcs();
+    compact.downOffsets_[n + 1]
+      = compact.downOffsets_[n] + node->getNumberOfDownSuperArcs();
+  }
+  compact.upArcs_.resize(compact.upOffsets_[nbNodes]);
+  compact.downArcs_.resize(compact.downOffsets_[nbNodes]);
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif
+  for(idNode n = 0; n < nbNodes; ++n) {
+    const Node *node = getNode(n);
+    for(idSuperArc i = 0; i < node->getNumberOfUpSuperArcs(); ++i) {
+      compact.upArcs_[compact.upOffsets_[n] + i] = node->getUpSuperArcId(i);
+    }
+    for(idSuperArc i = 0; i < node->getNumberOfDownSuperArcs(); ++i) {
+      compact.downArcs_[compact.downOffsets_[n] + i]
+        = node->getDownSuperArcId(i);
+    }
+  }
+
+  // arcs and their CSR segmentation
+  compact.arcDownNodes_.resize(nbArcs);
+  compact.arcUpNodes_.resize(nbArcs);
+  compact.arcNormalizedIds_.resize(nbArcs);
+  compact.segmOffsets_.resize(nbArcs + 1);
+  compact.segmOffsets_[0] = 0;
+  for(idSuperArc a = 0; a < nbArcs; ++a) {
+    const SuperArc *arc = getSuperArc(a);
+    compact.arcDownNodes_[a] = arc->getDownNodeId();
+    compact.arcUpNodes_[a] = arc->getUpNodeId();
+    compact.arcNormalizedIds_[a] = arc->getNormalizedId();
+    compact.segmOffsets_[a + 1]
+      = compact.segmOffsets_[a] + (segm ? arc->size() : 0);
+  }
+  compact.segmVertices_.resize(compact.segmOffsets_[nbArcs]);
+
+  // segmentation identifier of each vertex: the arcs set the vertices of
+  // their nodes in increasing order, then their regular vertices
+  if(segm) {
+    compact.vertexSegmentation_.reset(new SimplexId[scalars_->size]);
+    std::fill_n(
+      compact.vertexSegmentation_.get(), scalars_->size, nullVertex);
+    for(idSuperArc a = 0; a < nbArcs; ++a) {
+      const SimplexId id = normalize ? compact.arcNormalizedIds_[a] : a;
+      const SimplexId up = compact.getVertexId(compact.getUpNodeId(a));
+      const SimplexId down = compact.getVertexId(compact.getDownNodeId(a));
+      compact.vertexSegmentation_[up] = id;
+      compact.vertexSegmentation_[down] = id;
+    }
+  } else {
+    compact.vertexSegmentation_.reset();
+  }
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for schedule(dynamic) num_threads(threadNumber_)
+#endif
+  for(idSuperArc a = 0; a < nbArcs; ++a) {
+    SuperArc *arc = getSuperArc(a);
+    const auto first = compact.segmVertices_.begin() + compact.segmOffsets_[a];
+    const auto last
+      = compact.segmVertices_.begin() + compact.segmOffsets_[a + 1];
+    std::copy(arc->begin(), arc->end(), first);
+    if(segm) {
+      const SimplexId id = normalize ? compact.arcNormalizedIds_[a] : a;
+      for(const SimplexId v : *arc) {
+        compact.vertexSegmentation_[v] = id;
+      }
+    }
+    arc->releaseSegmentation(first, last);
+  }
+  mt_data_.segments_.clear();
+
+  printTime(compactTime, "compact copy", -1, 4);
+}
+
+idSuperArc FTMTree_MT::getArcAbove(const SimplexId v, const SimplexId below) {
+  idSuperArc arc = isCorrespondingArc(below) ? getCorrespondingSuperArcId(below)
+                                             : upArcFromVert(below);
+  // the component of below at the level of v contains v
+  while(comp_.vertLower(getUpNode(getSuperArc(arc))->getVertexId(), v)) {
+    arc = getUpNode(getSuperArc(arc))->getUpSuperArcId(0);
+  }
+  return arc;
+}
+
+void FTMTree_MT::moveRegularVertices(
+  const vector<pair<SimplexId, idSuperArc>> &moves) {
+  // vertices leaving / reaching each arc
+  map<idSuperArc, pair<vector<SimplexId>, vector<SimplexId>>> arcMoves;
+  for(const auto &m : moves) {
+    if(m.second == nullSuperArc) {
+      continue;
+    }
+    if(params_->segm) {
+      arcMoves[getCorrespondingSuperArcId(m.first)].first.emplace_back(
+        m.first);
+      arcMoves[m.second].second.emplace_back(m.first);
+    }
+    updateCorrespondingArc(m.first, m.second);
+  }
+
+  vector<decltype(arcMoves)::iterator> arcs;
+  arcs.reserve(arcMoves.size());
+  for(auto it = arcMoves.begin(); it != arcMoves.end(); ++it) {
+    arcs.emplace_back(it);
+  }
+
+  const idSuperArc nbArcs = arcs.size();
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for schedule(dynamic) num_threads(threadNumber_)
+#endif
+  for(idSuperArc i = 0; i < nbArcs; ++i) {
+    getSuperArc(arcs[i]->first)
+      ->updateSegmentation(
+        arcs[i]->second.first, arcs[i]->second.second, scalars_);
+  }
+}
+
 idSuperArc FTMTree_MT::openSuperArc(idNode downNodeId) {
 #ifndef TTK_ENABLE_KAMIKAZE
   if(downNodeId >= getNumberOfNodes()) {
@@ -865,77 +1007,34 @@ SimplexId FTMTree_MT::trunkCTSegmentation(const vector<SimplexId> &trunkVerts,
   const auto sizeBackBone = abs(stop - begin);
   const auto chunkSize = getChunkSize(sizeBackBone, nbTasksThreads);
   const auto chunkNb = getChunkCount(sizeBackBone, nbTasksThreads);
-  // si pas efficace vecteur de la taille de node ici a la place de acc
-  idNode lastVertInRange = 0;
   mt_data_.trunkSegments->resize(getNumberOfSuperArcs());
-  for(SimplexId chunkId = 0; chunkId < chunkNb; ++chunkId) {
+  if(useWorkStealing()) {
+    WorkStealingScheduler scheduler(threadNumber_);
+    scheduler.spawnRange(
+      0, begin, stop, chunkSize,
+      [this, &trunkVerts](const SimplexId lowerBound,
+                          const SimplexId upperBound) {
+        trunkCTSegmentationRange(trunkVerts, lowerBound, upperBound);
+      });
+    scheduler.run();
+    recordWorkerStats(scheduler, "trunk");
+  } else {
+    for(SimplexId chunkId = 0; chunkId < chunkNb; ++chunkId) {
 #ifdef TTK_ENABLE_OPENMP
-#pragma omp task firstprivate(chunkId, lastVertInRange) shared(trunkVerts) \
+#pragma omp task firstprivate(chunkId) shared(trunkVerts) \
   OPTIONAL_PRIORITY(isPrior())
 #endif
-    {
-      vector<SimplexId> regularList;
-      if(params_->segm) {
-        regularList.reserve(25);
-      }
-      const SimplexId lowerBound = begin + chunkId * chunkSize;
-      const SimplexId upperBound
-        = min(stop, (begin + (chunkId + 1) * chunkSize));
-      if(lowerBound != upperBound) {
-        const SimplexId pos = isST() ? upperBound - 1 : lowerBound;
-        lastVertInRange
-          = getVertInRange(trunkVerts, scalars_->sortedVertices[pos], 0);
-      }
-      for(SimplexId v = lowerBound; v < upperBound; ++v) {
-        const SimplexId s
-          = isST() ? scalars_->sortedVertices[lowerBound + upperBound - 1 - v]
-                   : scalars_->sortedVertices[v];
-        if(isCorrespondingNull(s)) {
-          const idNode oldVertInRange = lastVertInRange;
-          lastVertInRange = getVertInRange(trunkVerts, s, lastVertInRange);
-          const idSuperArc thisArc = upArcFromVert(trunkVerts[lastVertInRange]);
-          updateCorrespondingArc(s, thisArc);
-
-          if(params_->segm) {
-            if(oldVertInRange == lastVertInRange) {
-              regularList.emplace_back(s);
-            } else {
-              // accumulated to have only one atomic update when needed
-              const idSuperArc oldArc
-                = upArcFromVert(trunkVerts[oldVertInRange]);
-              if(regularList.size()) {
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp critical
-#endif
-                {
-                  (*mt_data_.trunkSegments)[oldArc].emplace_back(regularList);
-                  regularList.clear();
-                }
-              }
-              // hand.vtu, sequential: 28554
-              regularList.emplace_back(s);
-            }
-          }
-        }
-      }
-      // force increment last arc
-      const idNode baseNode
-        = getCorrespondingNodeId(trunkVerts[lastVertInRange]);
-      const idSuperArc upArc = getNode(baseNode)->getUpSuperArcId(0);
-      if(regularList.size()) {
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp critical
-#endif
-        {
-          (*mt_data_.trunkSegments)[upArc].emplace_back(regularList);
-          regularList.clear();
-        }
+      {
+        const SimplexId lowerBound = begin + chunkId * chunkSize;
+        const SimplexId upperBound
+          = min(stop, (begin + (chunkId + 1) * chunkSize));
+        trunkCTSegmentationRange(trunkVerts, lowerBound, upperBound);
       }
     }
-  }
 #ifdef TTK_ENABLE_OPENMP
 #pragma omp taskwait
 #endif
+  }
   // count added
   SimplexId tot = 0;
 #ifdef TTK_ENABLE_FTM_TREE_PROCESS_SPEED
@@ -950,6 +1049,65 @@ SimplexId FTMTree_MT::trunkCTSegmentation(const vector<SimplexId> &trunkVerts,
   return tot;
 }
 
+void FTMTree_MT::trunkCTSegmentationRange(const vector<SimplexId> &trunkVerts,
+                                          const SimplexId lowerBound,
+                                          const SimplexId upperBound) {
+  // si pas efficace vecteur de la taille de node ici a la place de acc
+  idNode lastVertInRange = 0;
+  vector<SimplexId> regularList;
+  if(params_->segm) {
+    regularList.reserve(25);
+  }
+  if(lowerBound != upperBound) {
+    const SimplexId pos = isST() ? upperBound - 1 : lowerBound;
+    lastVertInRange
+      = getVertInRange(trunkVerts, scalars_->sortedVertices[pos], 0);
+  }
+  for(SimplexId v = lowerBound; v < upperBound; ++v) {
+    const SimplexId s
+      = isST() ? scalars_->sortedVertices[lowerBound + upperBound - 1 - v]
+               : scalars_->sortedVertices[v];
+    if(isCorrespondingNull(s)) {
+      const idNode oldVertInRange = lastVertInRange;
+      lastVertInRange = getVertInRange(trunkVerts, s, lastVertInRange);
+      const idSuperArc thisArc = upArcFromVert(trunkVerts[lastVertInRange]);
+      updateCorrespondingArc(s, thisArc);
+
+      if(params_->segm) {
+        if(oldVertInRange == lastVertInRange) {
+          regularList.emplace_back(s);
+        } else {
+          // accumulated to have only one atomic update when needed
+          const idSuperArc oldArc = upArcFromVert(trunkVerts[oldVertInRange]);
+          if(regularList.size()) {
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp critical
+#endif
+            {
+              (*mt_data_.trunkSegments)[oldArc].emplace_back(regularList);
+              regularList.clear();
+            }
+          }
+          // hand.vtu, sequential: 28554
+          regularList.emplace_back(s);
+        }
+      }
+    }
+  }
+  // force increment last arc
+  const idNode baseNode = getCorrespondingNodeId(trunkVerts[lastVertInRange]);
+  const idSuperArc upArc = getNode(baseNode)->getUpSuperArcId(0);
+  if(regularList.size()) {
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp critical
+#endif
+    {
+      (*mt_data_.trunkSegments)[upArc].emplace_back(regularList);
+      regularList.clear();
+    }
+  }
+}
+
 SimplexId FTMTree_MT::trunkSegmentation(const vector<SimplexId> &trunkVerts,
                                         const SimplexId begin,
                                         const SimplexId stop) {
@@ -960,66 +1118,126 @@ SimplexId FTMTree_MT::trunkSegmentation(const vector<SimplexId> &trunkVerts,
   const auto sizeBackBone = abs(stop - begin);
   const auto chunkSize = getChunkSize(sizeBackBone, nbTasksThreads);
   const auto chunkNb = getChunkCount(sizeBackBone, nbTasksThreads);
-  // si pas efficace vecteur de la taille de node ici a la place de acc
   SimplexId tot = 0;
-  for(SimplexId chunkId = 0; chunkId < chunkNb; ++chunkId) {
+  if(useWorkStealing()) {
+    WorkStealingScheduler scheduler(threadNumber_);
+    scheduler.spawnRange(
+      0, begin, stop, chunkSize,
+      [this, &trunkVerts, &tot](const SimplexId lowerBound,
+                                const SimplexId upperBound) {
+        const SimplexId acc
+          = trunkSegmentationRange(trunkVerts, lowerBound, upperBound);
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp atomic update
+#endif
+        tot += acc;
+      });
+    scheduler.run();
+    recordWorkerStats(scheduler, "trunk");
+  } else {
+    for(SimplexId chunkId = 0; chunkId < chunkNb; ++chunkId) {
 #ifdef TTK_ENABLE_OPENMP
 #pragma omp task firstprivate(chunkId) shared(trunkVerts, tot) \
   OPTIONAL_PRIORITY(isPrior())
 #endif
-    {
-      idNode lastVertInRange = 0;
-      SimplexId acc = 0;
-
-      const SimplexId lowerBound = begin + chunkId * chunkSize;
-      const SimplexId upperBound
-        = min(stop, (begin + (chunkId + 1) * chunkSize));
-      for(SimplexId v = lowerBound; v < upperBound; ++v) {
-        const SimplexId s
-          = isST() ? scalars_->sortedVertices[lowerBound + upperBound - 1 - v]
-                   : scalars_->sortedVertices[v];
-        if(isCorrespondingNull(s)) {
-          const idNode oldVertInRange = lastVertInRange;
-          lastVertInRange = getVertInRange(trunkVerts, s, lastVertInRange);
-          const idSuperArc thisArc = upArcFromVert(trunkVerts[lastVertInRange]);
-          updateCorrespondingArc(s, thisArc);
-
-          if(params_->segm) {
-            if(oldVertInRange == lastVertInRange) {
-              ++acc;
-            } else {
-              // accumulated to have only one atomic update when needed
-              const idSuperArc oldArc
-                = upArcFromVert(trunkVerts[oldVertInRange]);
-              getSuperArc(oldArc)->atomicIncVisited(acc);
-#ifdef TTK_ENABLE_FTM_TREE_PROCESS_SPEED
+      {
+        const SimplexId lowerBound = begin + chunkId * chunkSize;
+        const SimplexId upperBound
+          = min(stop, (begin + (chunkId + 1) * chunkSize));
+        const SimplexId acc
+          = trunkSegmentationRange(trunkVerts, lowerBound, upperBound);
 #ifdef TTK_ENABLE_OPENMP
 #pragma omp atomic update
 #endif
-              tot += acc;
+        tot += acc;
+      } // end task
+    }
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp taskwait
 #endif
-              acc = 1;
-            }
-          }
+  }
+  return tot;
+}
+
+SimplexId
+  FTMTree_MT::trunkSegmentationRange(const vector<SimplexId> &trunkVerts,
+                                     const SimplexId lowerBound,
+                                     const SimplexId upperBound) {
+  // si pas efficace vecteur de la taille de node ici a la place de acc
+  idNode lastVertInRange = 0;
+  SimplexId acc = 0;
+  SimplexId tot = 0;
+
+  for(SimplexId v = lowerBound; v < upperBound; ++v) {
+    const SimplexId s
+      = isST() ? scalars_->sortedVertices[lowerBound + upperBound - 1 - v]
+               : scalars_->sortedVertices[v];
+    if(isCorrespondingNull(s)) {
+      const idNode oldVertInRange = lastVertInRange;
+      lastVertInRange = getVertInRange(trunkVerts, s, lastVertInRange);
+      const idSuperArc thisArc = upArcFromVert(trunkVerts[lastVertInRange]);
+      updateCorrespondingArc(s, thisArc);
+
+      if(params_->segm) {
+        if(oldVertInRange == lastVertInRange) {
+          ++acc;
+        } else {
+          // accumulated to have only one atomic update when needed
+          const idSuperArc oldArc = upArcFromVert(trunkVerts[oldVertInRange]);
+          getSuperArc(oldArc)->atomicIncVisited(acc);
+          tot += acc;
+          acc = 1;
         }
       }
-      // force increment last arc
-      const idNode baseNode
-        = getCorrespondingNodeId(trunkVerts[lastVertInRange]);
-      const idSuperArc upArc = getNode(baseNode)->getUpSuperArcId(0);
-      getSuperArc(upArc)->atomicIncVisited(acc);
+    }
+  }
+  // force increment last arc
+  const idNode baseNode = getCorrespondingNodeId(trunkVerts[lastVertInRange]);
+  const idSuperArc upArc = getNode(baseNode)->getUpSuperArcId(0);
+  getSuperArc(upArc)->atomicIncVisited(acc);
+  tot += acc;
+
 #ifdef TTK_ENABLE_FTM_TREE_PROCESS_SPEED
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp atomic update
-#endif
-      tot += acc;
+  return tot;
+#else
+  return 0;
 #endif
-    } // end task
+}
+
+void FTMTree_MT::recordWorkerStats(const WorkStealingScheduler &scheduler,
+                                   const string &step) {
+  const auto stats = scheduler.getStats();
+  mt_data_.workerStats.resize(stats.size());
+
+  double busy = 0, maxBusy = 0;
+  SimplexId nbTasks = 0, nbSteals = 0;
+  for(size_t w = 0; w < stats.size(); ++w) {
+    auto &total = mt_data_.workerStats[w];
+    total.busyTime += stats[w].busyTime;
+    total.nbTasks += stats[w].nbTasks;
+    total.nbSteals += stats[w].nbSteals;
+
+    busy += stats[w].busyTime;
+    maxBusy = std::max(maxBusy, stats[w].busyTime);
+    nbTasks += stats[w].nbTasks;
+    nbSteals += stats[w].nbSteals;
+    if(debugLevel_ >= 5) {
+      stringstream st;
+      st << "--" << step << " worker " << w << ": " << stats[w].nbTasks
+         << " tasks, " << stats[w].nbSteals << " steals, busy "
+         << stats[w].busyTime << "s";
+      this->printMsg(st.str());
+    }
+  }
+
+  if(debugLevel_ >= 4) {
+    // 1 when all the workers were busy for the same time
+    const double imbalance = busy > 0 ? maxBusy * stats.size() / busy : 1;
+    stringstream st;
+    st << "-" << step << " " << (isST() ? "ST" : "JT") << ": " << nbTasks
+       << " tasks, " << nbSteals << " steals, imbalance " << imbalance;
+    this->printMsg(st.str());
   }
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp taskwait
-#endif
-  return tot;
 }
 
 ostream &ttk::ftm::operator<<(ostream &o, SuperArc const &a) {
@@ -44,8 +44,10 @@
 
 #include "FTMAtomicUF.h"
 #include "FTMAtomicVector.h"
+#include "FTMCompactTree.h"
 #include "FTMDataTypes.h"
 #include "FTMNode.h"
+#include "FTMScheduler.h"
 #include "FTMStructures.h"
 #include "FTMSuperArc.h"
 
@@ -87,10 +89,16 @@ namespace ttk {
       // current nb of tasks
       idNode activeTasks;
 
+      // load balance of the work-stealing scheduler (leaf growth and trunk)
+      std::vector<WorkerStats> workerStats;
+
       // Segmentation, stay empty for Contour tree as
       // they are created by Merge Tree
       Segments segments_;
 
+      // flat copy of the built tree (compact storage only)
+      CompactTree compact;
+
 #ifdef TTK_ENABLE_FTM_TREE_STATS_TIME
       std::vector<ActiveTask> *activeTasksStats = nullptr;
 #endif
@@ -198,6 +206,7 @@ namespace ttk {
         mt_data_.openedNodes->resize(scalars_->size);
 
         mt_data_.segments_.clear();
+        mt_data_.compact.clear();
       }
 
       void makeInit(void) {
@@ -236,10 +245,14 @@ namespace ttk {
       template <class triangulationType>
       void leafGrowth(const triangulationType *mesh);
 
+      // the continuation on the saddle is spawned on the given worker of
+      // the work-stealing scheduler, if any
       template <class triangulationType>
       void arcGrowth(const triangulationType *mesh,
                      const SimplexId startVert,
-                     const SimplexId orig);
+                     const SimplexId orig,
+                     WorkStealingScheduler *const scheduler = nullptr,
+                     const int worker = 0);
 
       template <class triangulationType>
       std::tuple<bool, bool> propage(const triangulationType *mesh,
@@ -269,6 +282,21 @@ namespace ttk {
                             const SimplexId begin,
                             const SimplexId stop);
 
+      // one chunk [lowerBound, upperBound) of the sorted vertices
+      SimplexId
+        trunkSegmentationRange(const std::vector<SimplexId> &pendingNodesVerts,
+                               const SimplexId lowerBound,
+                               const SimplexId upperBound);
+
+      void trunkCTSegmentationRange(
+        const std::vector<SimplexId> &pendingNodesVerts,
+        const SimplexId lowerBound,
+        const SimplexId upperBound);
+
+      // accumulate and print the load balance of a scheduler
+      void recordWorkerStats(const WorkStealingScheduler &scheduler,
+                             const std::string &step);
+
       // segmentation
 
       /// \brief use vert2tree to compute the segmentation of the fresh builded
@@ -280,6 +308,31 @@ namespace ttk {
 
       void normalizeIds();
 
+      /// \brief Copy the built tree in its CompactTree, then free the
+      /// segmentation of the arcs and the segments
+      void compact(void);
+
+      // incremental update (see FTMTree::update)
+
+      /// \brief Check that moving a vertex leaves the merge trees unchanged,
+      /// given its neighbors lower than it in both orders and the neighbors
+      /// it crossed: either it stays a leaf without crossing any neighbor,
+      /// or its lower link is connected and every crossed neighbor is
+      /// adjacent to this lower link.
+      template <class triangulationType>
+      static bool isStableMove(const triangulationType *mesh,
+                               const std::vector<SimplexId> &lower,
+                               const std::vector<SimplexId> &crossed);
+
+      /// \brief Arc of the regular vertex v, climbing from its neighbor
+      /// below (lower than v in this tree)
+      idSuperArc getArcAbove(const SimplexId v, const SimplexId below);
+
+      /// \brief Move regular vertices to their new arc (vert2tree and
+      /// segmentation), nullSuperArc entries are ignored
+      void moveRegularVertices(
+        const std::vector<std::pair<SimplexId, idSuperArc>> &moves);
+
       // -------------
       // ACCESSOR
       // ------------
@@ -333,6 +386,48 @@ namespace ttk {
         params_->normalize = normalize;
       }
 
+      inline void setTaskScheduler(const TaskScheduler scheduler) {
+        params_->scheduler = scheduler;
+      }
+
+      /// Whether the work-stealing scheduler is used: a single worker has
+      /// nothing to steal and its depth-first order delays the trunk, the
+      /// OpenMP tasks are then used instead
+      inline bool useWorkStealing(void) const {
+        return params_->scheduler == TaskScheduler::WorkStealing
+               && threadNumber_ > 1;
+      }
+
+      /// Copy the built trees in a CompactTree (CSR arrays) and move their
+      /// segmentation there: the nodes and the arcs stay valid, and the
+      /// segmentation accessors of the arcs (SuperArc::begin(), size(),
+      /// etc.) read the CompactTree.
+      ///
+      /// The copy is made after the build, whose peak memory and time are
+      /// thus not lowered. It only trades the per-arc segmentation objects for
+      /// a few contiguous arrays. Off by default.
+      inline void setCompactStorage(const bool compact) {
+        params_->compact = compact;
+      }
+
+      inline bool isCompact(void) const {
+        return mt_data_.compact.getNumberOfNodes() > 0;
+      }
+
+      inline const CompactTree &getCompactTree(void) const {
+        return mt_data_.compact;
+      }
+
+      inline CompactTree &getCompactTree(void) {
+        return mt_data_.compact;
+      }
+
+      /// Busy time, tasks and steals of each worker of the work-stealing
+      /// scheduler during the last build (leaf growth and trunk)
+      inline const std::vector<WorkerStats> &getWorkerStats(void) const {
+        return mt_data_.workerStats;
+      }
+
 #ifdef TTK_ENABLE_OMP_PRIORITY
       inline void setPrior(void) {
         mt_data_.prior = true;
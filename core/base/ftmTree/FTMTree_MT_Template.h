@@ -60,6 +60,7 @@ namespace ttk {
                 3 + alreadyDone);
 
       Timer buildTime;
+      mt_data_.workerStats.clear();
       leafGrowth(mesh);
       int nbProcessed = 0;
 #ifdef TTK_ENABLE_FTM_TREE_PROCESS_SPEED
@@ -180,6 +181,26 @@ namespace ttk {
       };
       sort(mt_data_.leaves->begin(), mt_data_.leaves->end(), comp);
 
+      if(useWorkStealing()) {
+        // leaves dealt round robin, each worker starting from its lowest
+        WorkStealingScheduler scheduler(threadNumber_);
+        scheduler.setBody([this, mesh, &scheduler](const SimplexId v,
+                                                   const SimplexId orig,
+                                                   const int worker) {
+          arcGrowth(mesh, v, orig, &scheduler, worker);
+        });
+        const int nbWorkers = scheduler.getNumberOfWorkers();
+        for(idNode n = nbLeaves; n-- > 0;) {
+          const idNode l = (*mt_data_.leaves)[n];
+          SimplexId v = getNode(l)->getVertexId();
+          (*mt_data_.ufs)[v] = new AtomicUF(v);
+          scheduler.spawn(n % nbWorkers, v, n);
+        }
+        scheduler.run();
+        recordWorkerStats(scheduler, "leafGrowth");
+        return;
+      }
+
       for(idNode n = 0; n < nbLeaves; ++n) {
         const idNode l = (*mt_data_.leaves)[n];
         SimplexId v = getNode(l)->getVertexId();
@@ -202,7 +223,9 @@ namespace ttk {
     template <class triangulationType>
     void FTMTree_MT::arcGrowth(const triangulationType *mesh,
                                const SimplexId startVert,
-                               const SimplexId orig) {
+                               const SimplexId orig,
+                               WorkStealingScheduler *const scheduler,
+                               const int worker) {
       // current task id / propag
 
       // local order (ignore non regular verts)
@@ -303,6 +326,12 @@ namespace ttk {
 #endif
             (*mt_data_.openedNodes)[currentVert] = 0;
 
+            if(scheduler) {
+              // continue in a new task, to be stolen or run next
+              scheduler->spawn(worker, currentVert, orig);
+              return;
+            }
+
             // recursively continue
 #ifdef TTK_ENABLE_OPENMP
 #pragma omp taskyield
@@ -513,11 +542,64 @@ namespace ttk {
 
     // ------------------------------------------------------------------------
 
+    template <class triangulationType>
+    bool FTMTree_MT::isStableMove(const triangulationType *mesh,
+                                  const std::vector<SimplexId> &lower,
+                                  const std::vector<SimplexId> &crossed) {
+      auto areNeighbors = [mesh](const SimplexId a, const SimplexId b) {
+        const auto nbNeigh = mesh->getVertexNeighborNumber(a);
+        for(valence n = 0; n < nbNeigh; ++n) {
+          SimplexId neigh;
+          mesh->getVertexNeighbor(a, n, neigh);
+          if(neigh == b) {
+            return true;
+          }
+        }
+        return false;
+      };
+
+      // leaf in both orders
+      if(lower.empty()) {
+        return crossed.empty();
+      }
+
+      // a crossed neighbor stays connected to the component of v
+      for(const SimplexId w : crossed) {
+        if(std::none_of(lower.begin(), lower.end(), [&](const SimplexId x) {
+             return areNeighbors(w, x);
+           })) {
+          return false;
+        }
+      }
+
+      // v joins a single component in both orders
+      std::vector<char> reached(lower.size(), 0);
+      std::vector<size_t> toVisit{0};
+      reached[0] = 1;
+      size_t nbReached = 1;
+      while(!toVisit.empty()) {
+        const size_t i = toVisit.back();
+        toVisit.pop_back();
+        for(size_t j = 0; j < lower.size(); ++j) {
+          if(!reached[j] && areNeighbors(lower[i], lower[j])) {
+            reached[j] = 1;
+            ++nbReached;
+            toVisit.emplace_back(j);
+          }
+        }
+      }
+
+      return nbReached == lower.size();
+    }
+
+    // ------------------------------------------------------------------------
+
     template <typename scalarType>
     void ftm::FTMTree_MT::sortInput(void) {
 
       const auto nbVertices = scalars_->size;
       scalars_->sortedVertices.resize(nbVertices);
+      scalars_->sortedOffsets.clear();
 
 #ifdef TTK_ENABLE_OPENMP
 #pragma omp parallel for
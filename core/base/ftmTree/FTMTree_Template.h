@@ -18,6 +18,8 @@
 
 #include "FTMTree.h"
 
+// for std::sort, std::unique
+#include <algorithm>
 // for std::isnan
 #include <cmath>
 // for std::numeric_limits
@@ -198,6 +200,266 @@ void ttk::ftm::FTMTree::build(const triangulationType *mesh) {
         printTree2();
     }
   }
+
+  // Compact storage
+  if(params_->compact) {
+    switch(params_->treeType) {
+      case TreeType::Join:
+        getJoinTree()->compact();
+        break;
+      case TreeType::Split:
+        getSplitTree()->compact();
+        break;
+      case TreeType::Join_Split:
+        getJoinTree()->compact();
+        getSplitTree()->compact();
+        break;
+      case TreeType::Contour:
+        compact();
+        break;
+      default:
+        break;
+    }
+  }
+}
+
+template <typename scalarType, class triangulationType>
+bool ttk::ftm::FTMTree::update(const triangulationType *mesh,
+                               const std::vector<SimplexId> &changedVertices) {
+  const SimplexId nbVertices = mesh->getNumberOfVertices();
+
+  // keep the order of the rebuilt tree for the next update
+  auto rebuild = [this, mesh]() {
+    build<scalarType>(mesh);
+    scalars_->sortedOffsets.assign(
+      scalars_->offsets, scalars_->offsets + scalars_->size);
+    return false;
+  };
+
+  // no previous tree on this mesh, or no segmentation to update (moved to
+  // the CompactTree)
+  if(scalars_->size != nbVertices
+     || scalars_->sortedVertices.size() != static_cast<size_t>(nbVertices)
+     || params_->compact) {
+    return rebuild();
+  }
+
+  Timer updateTime;
+
+  // same NaN policy as build()
+  if(::std::numeric_limits<scalarType>::has_quiet_NaN) {
+    for(const SimplexId v : changedVertices) {
+      if(::std::isnan((double)(((scalarType *)scalars_->values)[v]))) {
+        ((scalarType *)scalars_->values)[v] = 0;
+      }
+    }
+  }
+
+  // each changed vertex once, in the order of its single vertex move
+  std::vector<SimplexId> changed(changedVertices);
+  std::sort(changed.begin(), changed.end());
+  changed.erase(std::unique(changed.begin(), changed.end()), changed.end());
+  const SimplexId nbChanged = changed.size();
+  // rank of the move of u, nullVertex if u did not change
+  auto moveRank = [&changed](const SimplexId u) {
+    const auto it = std::lower_bound(changed.begin(), changed.end(), u);
+    return it != changed.end() && *it == u
+             ? static_cast<SimplexId>(it - changed.begin())
+             : nullVertex;
+  };
+
+  // previous order (already known if the previous tree was updated or
+  // rebuilt by an update)
+  std::vector<SimplexId> &oldOffsets = scalars_->sortedOffsets;
+  if(oldOffsets.size() != static_cast<size_t>(nbVertices)) {
+    oldOffsets.resize(nbVertices);
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif
+    for(SimplexId i = 0; i < nbVertices; i++) {
+      oldOffsets[scalars_->sortedVertices[i]] = i;
+    }
+  }
+
+  // Positions in a common order: 2 * offset for a vertex at its new place,
+  // just below the next unchanged vertex of the previous order (ties broken
+  // by this previous order) for a changed vertex not moved yet.
+  using Position = std::pair<SimplexId, SimplexId>;
+  std::vector<Position> oldPositions(nbChanged);
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif
+  for(SimplexId i = 0; i < nbChanged; i++) {
+    SimplexId next = oldOffsets[changed[i]] + 1;
+    while(next < nbVertices
+          && moveRank(scalars_->sortedVertices[next]) != nullVertex) {
+      ++next;
+    }
+    const SimplexId place
+      = next < nbVertices
+          ? 2 * scalars_->offsets[scalars_->sortedVertices[next]] - 1
+          : 2 * nbVertices - 1;
+    oldPositions[i] = std::make_pair(place, oldOffsets[changed[i]]);
+  }
+  // position of u once the vertices of rank lower than r have moved
+  auto positionAt = [&](const SimplexId u, const SimplexId r) {
+    const SimplexId rank = moveRank(u);
+    if(rank == nullVertex || rank < r) {
+      return std::make_pair(2 * scalars_->offsets[u], SimplexId{0});
+    }
+    return oldPositions[rank];
+  };
+
+  // The trees are unchanged if each single vertex move, in rank order,
+  // leaves them unchanged. This certificate only reads the changed
+  // vertices and their neighbors: it is checked before any pass over the
+  // whole order, which a rebuild would waste.
+
+  // the global extrema carry the roots of the merge trees
+  bool stable
+    = scalars_->offsets[scalars_->sortedVertices[0]] == 0
+      && scalars_->offsets[scalars_->sortedVertices[nbVertices - 1]]
+           == nbVertices - 1;
+
+  const TreeType tt = params_->treeType;
+  const bool withJT = tt != TreeType::Split;
+  const bool withST = tt != TreeType::Join;
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for reduction(&& : stable) num_threads(threadNumber_)
+#endif
+  for(SimplexId i = 0; i < nbChanged; i++) {
+    if(!stable) {
+      continue;
+    }
+    const SimplexId v = changed[i];
+    const Position before = oldPositions[i];
+    const Position after
+      = std::make_pair(2 * scalars_->offsets[v], SimplexId{0});
+    std::vector<SimplexId> lower, upper, crossed;
+    const auto nbNeigh = mesh->getVertexNeighborNumber(v);
+    for(valence n = 0; n < nbNeigh; ++n) {
+      SimplexId neigh;
+      mesh->getVertexNeighbor(v, n, neigh);
+      const Position pos = positionAt(neigh, i);
+      const bool wasLower = pos < before;
+      const bool isLower = pos < after;
+      if(wasLower && isLower) {
+        lower.emplace_back(neigh);
+      } else if(!wasLower && !isLower) {
+        upper.emplace_back(neigh);
+      } else {
+        crossed.emplace_back(neigh);
+      }
+    }
+    stable = (!withJT || FTMTree_MT::isStableMove(mesh, lower, crossed))
+             && (!withST || FTMTree_MT::isStableMove(mesh, upper, crossed));
+  }
+
+  if(!stable) {
+    this->printMsg("Order changes may alter the tree, rebuilding");
+    return rebuild();
+  }
+
+#ifndef TTK_ENABLE_KAMIKAZE
+  // the certificate assumes the unchanged vertices keep their order
+  SimplexId lastOffset = -1;
+  for(SimplexId i = 0; i < nbVertices; i++) {
+    const SimplexId v = scalars_->sortedVertices[i];
+    if(moveRank(v) == nullVertex) {
+      if(scalars_->offsets[v] < lastOffset) {
+        this->printWrn("Unlisted vertices changed order, rebuilding");
+        return rebuild();
+      }
+      lastOffset = scalars_->offsets[v];
+    }
+  }
+#endif
+
+  sortInput<scalarType>();
+  oldOffsets.assign(scalars_->offsets, scalars_->offsets + nbVertices);
+
+  // highest unchanged neighbor below v in the given tree (nullVertex if
+  // every neighbor below v changed)
+  auto neighborBelow = [mesh, &moveRank](FTMTree_MT *const tree,
+                                         const SimplexId v) {
+    SimplexId below = nullVertex;
+    const auto nbNeigh = mesh->getVertexNeighborNumber(v);
+    for(valence n = 0; n < nbNeigh; ++n) {
+      SimplexId neigh;
+      mesh->getVertexNeighbor(v, n, neigh);
+      if(moveRank(neigh) == nullVertex && tree->compLower(neigh, v)
+         && (below == nullVertex || tree->compLower(below, neigh))) {
+        below = neigh;
+      }
+    }
+    return below;
+  };
+
+  // new arcs of the regular changed vertices
+  std::vector<FTMTree_MT *> trees;
+  if(tt == TreeType::Contour) {
+    trees.emplace_back(this);
+  } else {
+    if(withJT) {
+      trees.emplace_back(getJoinTree());
+    }
+    if(withST) {
+      trees.emplace_back(getSplitTree());
+    }
+  }
+  std::vector<std::vector<std::pair<SimplexId, idSuperArc>>> moves(
+    trees.size());
+  for(size_t t = 0; t < trees.size() && stable; ++t) {
+    FTMTree_MT *const tree = trees[t];
+    // without segmentation, the regular vertices of the contour tree are
+    // not mapped to arcs
+    if(tree == this && !params_->segm) {
+      continue;
+    }
+    moves[t].resize(nbChanged);
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for reduction(&& : stable) num_threads(threadNumber_)
+#endif
+    for(SimplexId i = 0; i < nbChanged; i++) {
+      const SimplexId v = changed[i];
+      idSuperArc arc = nullSuperArc;
+      if(!tree->isCorrespondingNode(v)) {
+        // the arcs are located from unchanged neighbors only: rebuild if
+        // there are none
+        if(tree == this) {
+          const SimplexId below = neighborBelow(getJoinTree(), v);
+          const SimplexId above = neighborBelow(getSplitTree(), v);
+          if(below != nullVertex && above != nullVertex) {
+            arc = getArcBetween(v, below, above);
+          }
+        } else {
+          const SimplexId below = neighborBelow(tree, v);
+          if(below != nullVertex) {
+            arc = tree->getArcAbove(v, below);
+          }
+        }
+        stable = stable && arc != nullSuperArc;
+      }
+      moves[t][i] = std::make_pair(v, arc);
+    }
+  }
+
+  if(!stable) {
+    this->printMsg("Order changes may alter the tree, rebuilding");
+    return rebuild();
+  }
+
+  for(size_t t = 0; t < trees.size(); ++t) {
+    trees[t]->moveRegularVertices(moves[t]);
+    if(params_->normalize) {
+      trees[t]->normalizeIds();
+    }
+  }
+
+  printTime(updateTime, "Update (" + std::to_string(nbChanged)
+                          + " changed vertices)", -1, 1);
+  return true;
 }
 
 #endif /* end of include guard: FTMTREE_TPL_H */
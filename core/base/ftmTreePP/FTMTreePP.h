@@ -31,16 +31,23 @@ namespace ttk {
       FTMTreePP();
       virtual ~FTMTreePP();
 
+      /**
+       * Compute the persistence pairs of the join (@p jt) or split tree.
+       * Pairs whose persistence is lower than @p minimumPersistence are
+       * not stored, except for the pair of the global extrema.
+       */
       template <typename scalarType>
       void computePersistencePairs(
         std::vector<std::tuple<SimplexId, SimplexId, scalarType>> &pairs,
-        const bool jt);
+        const bool jt,
+        const double minimumPersistence = 0.0);
 
     protected:
       template <typename scalarType>
       void computePairs(
         ftm::FTMTree_MT *tree,
-        std::vector<std::tuple<SimplexId, SimplexId, scalarType>> &pairs);
+        std::vector<std::tuple<SimplexId, SimplexId, scalarType>> &pairs,
+        const double minimumPersistence);
 
       template <typename scalarType>
       void sortPairs(
@@ -82,7 +89,8 @@ namespace ttk {
         const idNode current,
         std::vector<std::tuple<SimplexId, SimplexId, scalarType>> &pairs,
         ftm::FTMTree_MT *tree,
-        const SimplexId mp) {
+        const SimplexId mp,
+        const double minimumPersistence = 0.0) {
         AtomicUF *uf = nodesUF_[current].find();
         const SimplexId curVert = tree->getNode(current)->getVertexId();
         const scalarType curVal = getValue<scalarType>(curVert);
@@ -92,10 +100,11 @@ namespace ttk {
           AtomicUF::makeUnion(uf, &nodesUF_[nodeid]);
           if(tmpVert != mp) {
             const scalarType tmpVal = getValue<scalarType>(tmpVert);
-            if(scalars_->isLower(tmpVert, curVert)) {
-              pairs.emplace_back(tmpVert, curVert, curVal - tmpVal);
-            } else {
-              pairs.emplace_back(tmpVert, curVert, tmpVal - curVal);
+            const scalarType persistence = scalars_->isLower(tmpVert, curVert)
+                                             ? curVal - tmpVal
+                                             : tmpVal - curVal;
+            if(static_cast<double>(persistence) >= minimumPersistence) {
+              pairs.emplace_back(tmpVert, curVert, persistence);
             }
           }
         }
@@ -107,11 +116,14 @@ namespace ttk {
 template <typename scalarType>
 void ttk::ftm::FTMTreePP::computePersistencePairs(
   std::vector<std::tuple<SimplexId, SimplexId, scalarType>> &pairs,
-  const bool jt) {
+  const bool jt,
+  const double minimumPersistence) {
   ftm::FTMTree_MT *tree = jt ? getJoinTree() : getSplitTree();
 
   pairs.clear();
-  pairs.reserve(tree->getNumberOfLeaves());
+  if(minimumPersistence <= 0.0) {
+    pairs.reserve(tree->getNumberOfLeaves());
+  }
 
   const auto nbNodes = tree->getNumberOfNodes();
   nodesUF_.resize(nbNodes);
@@ -120,14 +132,15 @@ void ttk::ftm::FTMTreePP::computePersistencePairs(
     nodesUF_[nid] = AtomicUF{tree->getNode(nid)->getVertexId()};
   }
 
-  computePairs<scalarType>(tree, pairs);
+  computePairs<scalarType>(tree, pairs, minimumPersistence);
   sortPairs<scalarType>(tree, pairs);
 }
 
 template <typename scalarType>
 void ttk::ftm::FTMTreePP::computePairs(
   ftm::FTMTree_MT *tree,
-  std::vector<std::tuple<SimplexId, SimplexId, scalarType>> &pairs) {
+  std::vector<std::tuple<SimplexId, SimplexId, scalarType>> &pairs,
+  const double minimumPersistence) {
   auto getParentNode = [&](const idNode current) {
     const idSuperArc parentArc = tree->getNode(current)->getUpSuperArcId(0);
     return tree->getSuperArc(parentArc)->getUpNodeId();
@@ -146,6 +159,7 @@ void ttk::ftm::FTMTreePP::computePairs(
     toSee.pop();
 
     if(!tree->getNode(current)->getNumberOfUpSuperArcs()) {
+      // the pair of the global extrema is always kept
       createPairs<scalarType>(current, pairs, tree, ftm::nullVertex);
       clearPendingNodes(current);
       continue;
@@ -160,7 +174,8 @@ void ttk::ftm::FTMTreePP::computePairs(
        == tree->getNode(parentNode)->getNumberOfDownSuperArcs()) {
       const SimplexId mostPersist
         = getMostPersistVert<scalarType>(parentNode, tree);
-      createPairs<scalarType>(parentNode, pairs, tree, mostPersist);
+      createPairs<scalarType>(
+        parentNode, pairs, tree, mostPersist, minimumPersistence);
       nodesUF_[parentNode].find()->setExtrema(mostPersist);
       toSee.push(parentNode);
     }
@@ -5,7 +5,7 @@
 ///
 ///\brief Union find compliant with parallel find and maintaining
 /// the current local propagation
-/// inspired by ttk::UnionFind
+/// built on ttk::AtomicUnionFind
 ///
 /// \sa ftrGraph
 
@@ -16,35 +16,19 @@
 #include <memory>
 #include <vector>
 
+#include <AtomicUnionFind.h>
+
 namespace ttk {
   namespace ftr {
 
     class Propagation;
 
-    class AtomicUF {
+    class AtomicUF : public AtomicUnionFind<AtomicUF> {
     private:
-      unsigned rank_;
-      AtomicUF *parent_;
       Propagation *prop_;
 
     public:
-      inline explicit AtomicUF(Propagation *const p) : rank_(0), prop_{p} {
-        parent_ = this;
-      }
-
-      // heavy recursif
-      inline AtomicUF *find() {
-        if(parent_ == this)
-          return this;
-        else {
-          decltype(parent_) tmp = parent_->find();
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp atomic write
-#endif
-          parent_ = tmp;
-
-          return parent_;
-        }
+      inline explicit AtomicUF(Propagation *const p) : prop_{p} {
       }
 
       // Shared data get/set
@@ -59,69 +43,6 @@ namespace ttk {
 #endif
         prop_ = p;
       }
-
-      // UF get / set
-
-      inline int getRank() const {
-        return rank_;
-      }
-
-      inline void setRank(const int &rank) {
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp atomic write
-#endif
-        rank_ = rank;
-      }
-
-      inline void setParent(AtomicUF *parent) {
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp atomic write
-#endif
-        parent_ = parent;
-      }
-
-      static inline AtomicUF *makeUnion(AtomicUF *uf0, AtomicUF *uf1) {
-        uf0 = uf0->find();
-        uf1 = uf1->find();
-
-        if(uf0 == uf1) {
-          return uf0;
-        } else if(uf0->getRank() > uf1->getRank()) {
-          uf1->setParent(uf0);
-          return uf0;
-        } else if(uf0->getRank() < uf1->getRank()) {
-          uf0->setParent(uf1);
-          return uf1;
-        } else {
-          uf1->setParent(uf0);
-          uf0->setRank(uf0->getRank() + 1);
-          return uf0;
-        }
-      }
-
-      static inline AtomicUF *makeUnion(std::vector<AtomicUF *> &sets) {
-        AtomicUF *n = NULL;
-
-        if(!sets.size())
-          return NULL;
-
-        if(sets.size() == 1)
-          return sets[0];
-
-        for(int i = 0; i < (int)sets.size() - 1; i++) {
-          n = makeUnion(sets[i], sets[i + 1]);
-        }
-
-        return n;
-      }
-
-      inline bool operator<(const AtomicUF &other) const {
-        return rank_ < other.rank_;
-      }
-
-      inline bool operator>(const AtomicUF &other) const {
-        return rank_ > other.rank_;
-      }
     };
 
   } // namespace ftr
@@ -200,12 +200,20 @@ int ttk::HarmonicField::execute(const TriangulationType &triangulation,
   return 0;
 }
 
-// explicit template specializations for double and float types
-#define HARMONICFIELD_SPECIALIZE(TYPE)                                       \
+// explicit template specializations for double and float types and for
+// every concrete triangulation type (see ttkTemplateMacro)
+#define HARMONICFIELD_SPECIALIZE(TYPE, TRIANGULATION)                        \
   template int ttk::HarmonicField::execute<TYPE>(                            \
-    const Triangulation &, const SimplexId, const SimplexId *const,          \
+    const TRIANGULATION &, const SimplexId, const SimplexId *const,          \
     const TYPE *const, TYPE *const, const bool, const SolvingMethodUserType, \
     const double) const
 
-HARMONICFIELD_SPECIALIZE(float);
-HARMONICFIELD_SPECIALIZE(double);
+#define HARMONICFIELD_SPECIALIZE_ALL(TYPE)                       \
+  HARMONICFIELD_SPECIALIZE(TYPE, Triangulation);                 \
+  HARMONICFIELD_SPECIALIZE(TYPE, ExplicitTriangulation);         \
+  HARMONICFIELD_SPECIALIZE(TYPE, ImplicitTriangulation);         \
+  HARMONICFIELD_SPECIALIZE(TYPE, PeriodicImplicitTriangulation); \
+  HARMONICFIELD_SPECIALIZE(TYPE, CompactTriangulation)
+
+HARMONICFIELD_SPECIALIZE_ALL(float);
+HARMONICFIELD_SPECIALIZE_ALL(double);
@@ -246,7 +246,7 @@ namespace ttk {
         return -1;
 #endif // !TTK_ENABLE_KAMIKAZE
 
-      switch(vertexPositions_[vertexId]) {
+      switch(getVertexPosition(vertexId)) {
         case VertexPosition::CENTER_3D:
           return 14;
         case VertexPosition::FRONT_FACE_3D:
@@ -352,6 +352,43 @@ namespace ttk {
                      const SimplexId &yDim,
                      const SimplexId &zDim);
 
+    /// Do not store the position of each simplex on the grid (its
+    /// boundary case and its coordinates) but compute it on the fly from
+    /// its identifier.
+    ///
+    /// The position tables use 25 bytes per simplex (e.g. several hundreds
+    /// of GB for a 4096^3 grid) while this mode has a constant memory
+    /// footprint, at the price of a few integer divisions per query.
+    /// \return Returns 0 upon success, negative values otherwise.
+    int setPositionFree(const bool positionFree);
+
+    inline bool isPositionFree() const {
+      return positionFree_;
+    }
+
+    size_t footprint(size_t size = 0, const bool quiet = false) const;
+
+    /// Set the edge length (in vertices) of the bricks of the vertex
+    /// traversal of 3D grids (see getVertexBlocks()). Values lower than 2
+    /// (default) keep the x-fastest order, which was not slower than bricks
+    /// on the grids measured so far.
+    inline int setVertexBlockSize(const SimplexId blockSize) {
+      vertexBlockSize_ = blockSize;
+      return 0;
+    }
+
+    /// Get the blocks of a cache-friendly traversal of the vertices: bricks
+    /// on 3D grids, chunks of consecutive vertices otherwise.
+    /// \sa AbstractTriangulation::getVertexBlocks()
+    inline VertexBlocks getVertexBlocks() const {
+      if(dimensionality_ != 3 || vertexBlockSize_ < 2) {
+        return AbstractTriangulation::getVertexBlocks();
+      }
+      return VertexBlocks{{dimensions_[0], dimensions_[1], dimensions_[2]},
+                          {vertexBlockSize_, vertexBlockSize_,
+                           vertexBlockSize_}};
+    }
+
     int preconditionVerticesInternal();
     int preconditionVertexNeighborsInternal() override;
     int preconditionEdgesInternal() override;
@@ -594,6 +631,42 @@ namespace ttk {
     // for every tetrahedron, its coordinates on the grid
     std::vector<std::array<SimplexId, 3>> tetrahedronCoords_{};
 
+    // if the positions above are computed on the fly (no tables)
+    bool positionFree_{false};
+
+    // edge length of the bricks of the vertex traversal
+    SimplexId vertexBlockSize_{0};
+
+    // position of a simplex, read from the tables or computed on the fly
+    inline VertexPosition getVertexPosition(const SimplexId vertexId) const;
+    inline std::array<SimplexId, 3>
+      getVertexCoords(const SimplexId vertexId) const;
+    inline EdgePosition getEdgePosition(const SimplexId edgeId) const;
+    inline std::array<SimplexId, 3>
+      getEdgeCoords(const SimplexId edgeId) const;
+    inline TrianglePosition
+      getTrianglePosition(const SimplexId triangleId) const;
+    inline std::array<SimplexId, 3>
+      getTriangleCoords(const SimplexId triangleId) const;
+    inline std::array<SimplexId, 3>
+      getTetrahedronCoords(const SimplexId tetId) const;
+
+    // compute the position of a simplex from its identifier (the
+    // coordinates are stored in p)
+    inline VertexPosition computeVertexPosition(const SimplexId vertexId,
+                                                SimplexId p[3]) const;
+    inline EdgePosition computeEdgePosition(const SimplexId edgeId,
+                                            SimplexId p[3]) const;
+    inline TrianglePosition
+      computeTrianglePosition(const SimplexId triangleId,
+                              SimplexId p[3]) const;
+
+    // boundary case of a coordinate: 0 inside, 1 on the lower bound, 2 on
+    // the upper bound
+    static inline int boundaryCase(const SimplexId x, const SimplexId n) {
+      return (x == 0) ? 1 : ((x == n) ? 2 : 0);
+    }
+
     int dimensionality_; //
     float origin_[3]; //
     float spacing_[3]; //
@@ -973,7 +1046,7 @@ inline void
 inline void ttk::ImplicitTriangulation::edgeToPosition2d(const SimplexId edge,
                                                          const int k,
                                                          SimplexId p[2]) const {
-  const int e = (k) ? edge - esetshift_[k - 1] : edge;
+  const SimplexId e = (k) ? edge - esetshift_[k - 1] : edge;
   p[0] = e % eshift_[2 * k];
   p[1] = e / eshift_[2 * k];
 }
@@ -1520,7 +1593,7 @@ inline void ttk::ImplicitTriangulation::vertexToPosition(const SimplexId vertex,
 inline void ttk::ImplicitTriangulation::edgeToPosition(const SimplexId edge,
                                                        const int k,
                                                        SimplexId p[3]) const {
-  const int e = (k) ? edge - esetshift_[k - 1] : edge;
+  const SimplexId e = (k) ? edge - esetshift_[k - 1] : edge;
   p[0] = e % eshift_[2 * k];
   p[1] = (e % eshift_[2 * k + 1]) / eshift_[2 * k];
   p[2] = e / eshift_[2 * k + 1];
@@ -1542,6 +1615,225 @@ inline void
   p[2] = tetrahedron / tetshift_[1];
 }
 
+inline ttk::ImplicitTriangulation::VertexPosition
+  ttk::ImplicitTriangulation::computeVertexPosition(const SimplexId vertexId,
+                                                    SimplexId p[3]) const {
+  // boundary cases indexed by c(x) + 3 c(y) + 9 c(z)
+  static const VertexPosition cases3d[27] = {
+    VertexPosition::CENTER_3D,
+    VertexPosition::LEFT_FACE_3D,
+    VertexPosition::RIGHT_FACE_3D,
+    VertexPosition::TOP_FACE_3D,
+    VertexPosition::TOP_LEFT_EDGE_3D,
+    VertexPosition::TOP_RIGHT_EDGE_3D,
+    VertexPosition::BOTTOM_FACE_3D,
+    VertexPosition::BOTTOM_LEFT_EDGE_3D,
+    VertexPosition::BOTTOM_RIGHT_EDGE_3D,
+    VertexPosition::FRONT_FACE_3D,
+    VertexPosition::LEFT_FRONT_EDGE_3D,
+    VertexPosition::RIGHT_FRONT_EDGE_3D,
+    VertexPosition::TOP_FRONT_EDGE_3D,
+    VertexPosition::TOP_LEFT_FRONT_CORNER_3D,
+    VertexPosition::TOP_RIGHT_FRONT_CORNER_3D,
+    VertexPosition::BOTTOM_FRONT_EDGE_3D,
+    VertexPosition::BOTTOM_LEFT_FRONT_CORNER_3D,
+    VertexPosition::BOTTOM_RIGHT_FRONT_CORNER_3D,
+    VertexPosition::BACK_FACE_3D,
+    VertexPosition::LEFT_BACK_EDGE_3D,
+    VertexPosition::RIGHT_BACK_EDGE_3D,
+    VertexPosition::TOP_BACK_EDGE_3D,
+    VertexPosition::TOP_LEFT_BACK_CORNER_3D,
+    VertexPosition::TOP_RIGHT_BACK_CORNER_3D,
+    VertexPosition::BOTTOM_BACK_EDGE_3D,
+    VertexPosition::BOTTOM_LEFT_BACK_CORNER_3D,
+    VertexPosition::BOTTOM_RIGHT_BACK_CORNER_3D,
+  };
+  // boundary cases indexed by c(x) + 3 c(y)
+  static const VertexPosition cases2d[9] = {
+    VertexPosition::CENTER_2D,
+    VertexPosition::LEFT_EDGE_2D,
+    VertexPosition::RIGHT_EDGE_2D,
+    VertexPosition::TOP_EDGE_2D,
+    VertexPosition::TOP_LEFT_CORNER_2D,
+    VertexPosition::TOP_RIGHT_CORNER_2D,
+    VertexPosition::BOTTOM_EDGE_2D,
+    VertexPosition::BOTTOM_LEFT_CORNER_2D,
+    VertexPosition::BOTTOM_RIGHT_CORNER_2D,
+  };
+
+  p[0] = p[1] = p[2] = 0;
+  if(dimensionality_ == 3) {
+    vertexToPosition(vertexId, p);
+    return cases3d[boundaryCase(p[0], nbvoxels_[0])
+                   + 3 * boundaryCase(p[1], nbvoxels_[1])
+                   + 9 * boundaryCase(p[2], nbvoxels_[2])];
+  } else if(dimensionality_ == 2) {
+    vertexToPosition2d(vertexId, p);
+    return cases2d[boundaryCase(p[0], nbvoxels_[Di_])
+                   + 3 * boundaryCase(p[1], nbvoxels_[Dj_])];
+  }
+  if(vertexId == vertexNumber_ - 1)
+    return VertexPosition::RIGHT_CORNER_1D;
+  else if(vertexId == 0)
+    return VertexPosition::LEFT_CORNER_1D;
+  return VertexPosition::CENTER_1D;
+}
+
+inline ttk::ImplicitTriangulation::EdgePosition
+  ttk::ImplicitTriangulation::computeEdgePosition(const SimplexId edgeId,
+                                                  SimplexId p[3]) const {
+  p[0] = p[1] = p[2] = 0;
+  if(dimensionality_ == 3) {
+    // index of the edge set, without branching on the 7 thresholds
+    int k = 0;
+    for(int i = 0; i < 6; ++i)
+      k += (edgeId >= esetshift_[i]);
+    edgeToPosition(edgeId, k, p);
+
+    const int c0 = boundaryCase(p[0], nbvoxels_[0]);
+    const int c1 = boundaryCase(p[1], nbvoxels_[1]);
+    const int c2 = boundaryCase(p[2], nbvoxels_[2]);
+    int base{}, offset{};
+    switch(k) {
+      case 0:
+        base = static_cast<int>(EdgePosition::L_xnn_3D);
+        offset = 3 * c1 + c2;
+        break;
+      case 1:
+        base = static_cast<int>(EdgePosition::H_nyn_3D);
+        offset = 3 * c0 + c2;
+        break;
+      case 2:
+        base = static_cast<int>(EdgePosition::P_nnz_3D);
+        offset = 3 * c0 + c1;
+        break;
+      case 3:
+        base = static_cast<int>(EdgePosition::D1_xyn_3D);
+        offset = c2;
+        break;
+      case 4:
+        base = static_cast<int>(EdgePosition::D2_nyz_3D);
+        offset = c0;
+        break;
+      case 5:
+        base = static_cast<int>(EdgePosition::D3_xnz_3D);
+        offset = c1;
+        break;
+      default:
+        base = static_cast<int>(EdgePosition::D4_3D);
+        break;
+    }
+    return static_cast<EdgePosition>(base + offset);
+
+  } else if(dimensionality_ == 2) {
+    const int k = (edgeId >= esetshift_[0]) + (edgeId >= esetshift_[1]);
+    edgeToPosition2d(edgeId, k, p);
+    if(k == 0)
+      return static_cast<EdgePosition>(
+        static_cast<int>(EdgePosition::L_xn_2D)
+        + boundaryCase(p[1], nbvoxels_[Dj_]));
+    else if(k == 1)
+      return static_cast<EdgePosition>(
+        static_cast<int>(EdgePosition::H_ny_2D)
+        + boundaryCase(p[0], nbvoxels_[Di_]));
+    return EdgePosition::D1_2D;
+  }
+  if(edgeId == edgeNumber_ - 1)
+    return EdgePosition::LAST_EDGE_1D;
+  else if(edgeId == 0)
+    return EdgePosition::FIRST_EDGE_1D;
+  return EdgePosition::CENTER_1D;
+}
+
+inline ttk::ImplicitTriangulation::TrianglePosition
+  ttk::ImplicitTriangulation::computeTrianglePosition(
+    const SimplexId triangleId, SimplexId p[3]) const {
+  // triangle sets, in the order of tsetshift_
+  static const TrianglePosition cases3d[6] = {
+    TrianglePosition::F_3D,  TrianglePosition::H_3D,  TrianglePosition::C_3D,
+    TrianglePosition::D1_3D, TrianglePosition::D2_3D, TrianglePosition::D3_3D,
+  };
+
+  p[0] = p[1] = p[2] = 0;
+  if(dimensionality_ == 3) {
+    int k = 0;
+    for(int i = 0; i < 5; ++i)
+      k += (triangleId >= tsetshift_[i]);
+    triangleToPosition(triangleId, k, p);
+    return cases3d[k];
+  }
+  triangleToPosition2d(triangleId, p);
+  return (triangleId % 2 == 0) ? TrianglePosition::TOP_2D
+                               : TrianglePosition::BOTTOM_2D;
+}
+
+inline ttk::ImplicitTriangulation::VertexPosition
+  ttk::ImplicitTriangulation::getVertexPosition(
+    const SimplexId vertexId) const {
+  if(!positionFree_)
+    return vertexPositions_[vertexId];
+  SimplexId p[3];
+  return computeVertexPosition(vertexId, p);
+}
+
+inline std::array<ttk::SimplexId, 3>
+  ttk::ImplicitTriangulation::getVertexCoords(const SimplexId vertexId) const {
+  if(!positionFree_)
+    return vertexCoords_[vertexId];
+  std::array<SimplexId, 3> p{};
+  if(dimensionality_ == 3)
+    vertexToPosition(vertexId, p.data());
+  else if(dimensionality_ == 2)
+    vertexToPosition2d(vertexId, p.data());
+  return p;
+}
+
+inline ttk::ImplicitTriangulation::EdgePosition
+  ttk::ImplicitTriangulation::getEdgePosition(const SimplexId edgeId) const {
+  if(!positionFree_)
+    return edgePositions_[edgeId];
+  SimplexId p[3];
+  return computeEdgePosition(edgeId, p);
+}
+
+inline std::array<ttk::SimplexId, 3>
+  ttk::ImplicitTriangulation::getEdgeCoords(const SimplexId edgeId) const {
+  if(!positionFree_)
+    return edgeCoords_[edgeId];
+  std::array<SimplexId, 3> p{};
+  computeEdgePosition(edgeId, p.data());
+  return p;
+}
+
+inline ttk::ImplicitTriangulation::TrianglePosition
+  ttk::ImplicitTriangulation::getTrianglePosition(
+    const SimplexId triangleId) const {
+  if(!positionFree_)
+    return trianglePositions_[triangleId];
+  SimplexId p[3];
+  return computeTrianglePosition(triangleId, p);
+}
+
+inline std::array<ttk::SimplexId, 3>
+  ttk::ImplicitTriangulation::getTriangleCoords(
+    const SimplexId triangleId) const {
+  if(!positionFree_)
+    return triangleCoords_[triangleId];
+  std::array<SimplexId, 3> p{};
+  computeTrianglePosition(triangleId, p.data());
+  return p;
+}
+
+inline std::array<ttk::SimplexId, 3>
+  ttk::ImplicitTriangulation::getTetrahedronCoords(
+    const SimplexId tetId) const {
+  if(!positionFree_)
+    return tetrahedronCoords_[tetId];
+  std::array<SimplexId, 3> p{};
+  tetrahedronToPosition(tetId, p.data());
+  return p;
+}
+
 inline ttk::SimplexId
   ttk::ImplicitTriangulation::getVertexEdgeA(const SimplexId p[3],
                                              const int id) const {
@@ -0,0 +1,144 @@
+#include <SlabStreamer.h>
+
+using namespace ttk;
+
+SlabStreamer::SlabStreamer() {
+  setDebugMsgPrefix("SlabStreamer");
+  triangulation_.setPositionFree(true);
+}
+
+int SlabStreamer::setInputRawFile(const std::string &path,
+                                  const std::array<SimplexId, 3> &dimensions,
+                                  const size_t valueSize,
+                                  const size_t headerSize) {
+
+#ifndef TTK_ENABLE_KAMIKAZE
+  if(dimensions[0] < 1 || dimensions[1] < 1 || dimensions[2] < 1
+     || valueSize == 0) {
+    this->printErr("Invalid grid dimensions or value size");
+    return -1;
+  }
+#endif // TTK_ENABLE_KAMIKAZE
+
+  file_.close();
+  file_.clear();
+  file_.open(path, std::ios::in | std::ios::binary);
+  if(!file_.is_open()) {
+    this->printErr("Could not open `" + path + "'");
+    return -2;
+  }
+
+  file_.seekg(0, std::ios::end);
+  const auto fileSize = static_cast<size_t>(file_.tellg());
+  const size_t expectedSize = headerSize
+                              + valueSize * dimensions[0] * dimensions[1]
+                                  * dimensions[2];
+  if(fileSize < expectedSize) {
+    this->printErr("`" + path + "' is too small (" + std::to_string(fileSize)
+                   + " bytes, expected " + std::to_string(expectedSize)
+                   + ")");
+    file_.close();
+    return -3;
+  }
+
+  path_ = path;
+  dimensions_ = dimensions;
+  valueSize_ = valueSize;
+  headerSize_ = headerSize;
+
+  // slabs are cut along the slowest non-flat dimension
+  slabAxis_ = 0;
+  for(int i = 0; i < 3; ++i) {
+    if(dimensions_[i] > 1) {
+      slabAxis_ = i;
+    }
+  }
+  layerNumber_ = dimensions_[slabAxis_];
+  layerSize_ = 1;
+  for(int i = 0; i < slabAxis_; ++i) {
+    layerSize_ *= dimensions_[i];
+  }
+  slabThickness_ = -1;
+
+  return 0;
+}
+
+int SlabStreamer::computeSlabThickness() {
+
+  const size_t layerBytes = layerSize_ * (valueSize_ + bytesPerVertex_);
+  const SimplexId maxLayers = memoryBudget_ / std::max(layerBytes, size_t{1});
+
+  slabThickness_ = maxLayers - 2 * ghostLayers_;
+  if(slabThickness_ < 1) {
+    slabThickness_ = 1;
+    this->printWrn("Memory budget too small for a single layer and its "
+                   + std::to_string(ghostLayers_) + " ghost layer(s)");
+    this->printWrn("Using "
+                   + std::to_string((1 + 2 * ghostLayers_) * layerBytes)
+                   + " bytes per slab");
+  }
+
+  return 0;
+}
+
+SimplexId SlabStreamer::getNumberOfSlabs() {
+
+  if(layerNumber_ == 0) {
+    return 0;
+  }
+  if(slabThickness_ < 0) {
+    this->computeSlabThickness();
+  }
+  return (layerNumber_ + slabThickness_ - 1) / slabThickness_;
+}
+
+int SlabStreamer::loadSlab(const SimplexId slabId) {
+
+#ifndef TTK_ENABLE_KAMIKAZE
+  if(slabId < 0 || slabId >= this->getNumberOfSlabs()) {
+    this->printErr("Invalid slab identifier " + std::to_string(slabId));
+    return -1;
+  }
+#endif // TTK_ENABLE_KAMIKAZE
+
+  if(slabThickness_ < 0) {
+    this->computeSlabThickness();
+  }
+
+  firstOwnedLayer_ = slabId * slabThickness_;
+  lastOwnedLayer_ = std::min(firstOwnedLayer_ + slabThickness_, layerNumber_);
+  firstLayer_ = std::max(firstOwnedLayer_ - ghostLayers_, SimplexId{0});
+  lastLayer_ = std::min(lastOwnedLayer_ + ghostLayers_, layerNumber_);
+
+  const size_t slabSize = (lastLayer_ - firstLayer_) * layerSize_;
+  data_.resize(slabSize * valueSize_);
+
+  file_.clear();
+  file_.seekg(headerSize_ + firstLayer_ * layerSize_ * valueSize_);
+  file_.read(data_.data(), data_.size());
+  if(!file_) {
+    this->printErr("Could not read slab " + std::to_string(slabId) + " from `"
+                   + path_ + "'");
+    return -2;
+  }
+
+  std::array<SimplexId, 3> slabDimensions = dimensions_;
+  slabDimensions[slabAxis_] = lastLayer_ - firstLayer_;
+  std::array<float, 3> origin{};
+  origin[slabAxis_] = firstLayer_;
+
+  // the pre-conditioned relations depend on the slab dimensions
+  triangulation_.clear();
+  triangulation_.setDebugLevel(0);
+  triangulation_.setThreadNumber(threadNumber_);
+  triangulation_.setInputGrid(origin[0], origin[1], origin[2], 1, 1, 1,
+                              slabDimensions[0], slabDimensions[1],
+                              slabDimensions[2]);
+
+  this->printMsg("Loaded slab " + std::to_string(slabId) + " (layers "
+                   + std::to_string(firstLayer_) + " to "
+                   + std::to_string(lastLayer_ - 1) + ")",
+                 debug::Priority::DETAIL);
+
+  return 0;
+}
@@ -0,0 +1,145 @@
+/// \ingroup base
+/// \class ttk::SlabStreamer
+/// \date October 2026.
+///
+/// \brief Out-of-core traversal of regular grids stored in raw files.
+///
+/// %SlabStreamer cuts a regular grid into slabs of layers along its slowest
+/// dimension (z for 3D grids) and loads them one at a time from a raw file,
+/// along with a configurable number of ghost layers on each side. Each slab
+/// comes with an ImplicitTriangulation of its layers (in position-free
+/// mode), so that the base algorithms whose stencil is covered by the ghost
+/// layers can process the owned vertices of each slab as if the full grid
+/// was in memory.
+///
+/// The slab thickness is derived from a memory budget, given the size of
+/// the scalar values and the memory needed per vertex by the calling
+/// algorithm (see setBytesPerVertex()).
+///
+/// The slabs span contiguous ranges of vertex identifiers, with the same
+/// relative order as in the full grid: local vertex \p v of a slab is
+/// global vertex \p v + getSlabVertexOffset().
+///
+/// \sa ttk::ImplicitTriangulation
+/// \sa ttk::ScalarFieldCriticalPoints::executeOutOfCore()
+
+#pragma once
+
+#include <array>
+#include <fstream>
+#include <string>
+#include <vector>
+
+// base code includes
+#include <ImplicitTriangulation.h>
+
+namespace ttk {
+
+  class SlabStreamer : virtual public Debug {
+
+  public:
+    SlabStreamer();
+
+    /// Set the raw file storing the scalar values of the grid (x-fastest,
+    /// without any compression).
+    /// \param path Path to the raw file.
+    /// \param dimensions Number of vertices along each dimension.
+    /// \param valueSize Size in bytes of each scalar value.
+    /// \param headerSize Number of bytes to skip at the beginning of the
+    /// file.
+    /// \return Returns 0 upon success, negative values otherwise.
+    int setInputRawFile(const std::string &path,
+                        const std::array<SimplexId, 3> &dimensions,
+                        const size_t valueSize,
+                        const size_t headerSize = 0);
+
+    /// Set the maximum number of bytes used by a slab (scalar values and
+    /// per-vertex memory of the calling algorithm, ghost layers included).
+    inline void setMemoryBudget(const size_t memoryBudget) {
+      memoryBudget_ = memoryBudget;
+      slabThickness_ = -1;
+    }
+
+    /// Set the number of ghost layers loaded on each side of a slab (it
+    /// should cover the stencil of the calling algorithm, e.g. 1 for the
+    /// vertex link).
+    inline void setGhostLayers(const SimplexId ghostLayers) {
+      ghostLayers_ = ghostLayers;
+      slabThickness_ = -1;
+    }
+
+    /// Set the number of bytes needed per vertex of a slab by the calling
+    /// algorithm, on top of its scalar value.
+    inline void setBytesPerVertex(const size_t bytesPerVertex) {
+      bytesPerVertex_ = bytesPerVertex;
+      slabThickness_ = -1;
+    }
+
+    inline SimplexId getNumberOfVertices() const {
+      return dimensions_[0] * dimensions_[1] * dimensions_[2];
+    }
+
+    /// Get the number of slabs needed to cover the grid within the memory
+    /// budget.
+    SimplexId getNumberOfSlabs();
+
+    /// Load the scalar values of a slab and triangulate it.
+    ///
+    /// The triangulation is cleared: the calling algorithm has to
+    /// pre-condition it for each slab.
+    /// \param slabId Input slab identifier.
+    /// \return Returns 0 upon success, negative values otherwise.
+    int loadSlab(const SimplexId slabId);
+
+    /// Get the triangulation of the current slab (ghost layers included).
+    inline ImplicitTriangulation *getSlabTriangulation() {
+      return &triangulation_;
+    }
+
+    /// Get the scalar values of the current slab (ghost layers included).
+    inline const void *getSlabData() const {
+      return data_.data();
+    }
+
+    /// Get the global identifier of the first vertex of the current slab.
+    inline SimplexId getSlabVertexOffset() const {
+      return firstLayer_ * layerSize_;
+    }
+
+    /// Get the range [begin, end) of the local identifiers of the vertices
+    /// owned by the current slab (i.e. not in its ghost layers).
+    inline void getOwnedVertices(SimplexId &begin, SimplexId &end) const {
+      begin = (firstOwnedLayer_ - firstLayer_) * layerSize_;
+      end = (lastOwnedLayer_ - firstLayer_) * layerSize_;
+    }
+
+  protected:
+    int computeSlabThickness();
+
+    std::string path_{};
+    std::array<SimplexId, 3> dimensions_{};
+    size_t valueSize_{};
+    size_t headerSize_{};
+    size_t memoryBudget_{size_t{1} << 30};
+    size_t bytesPerVertex_{};
+    SimplexId ghostLayers_{1};
+
+    // index of the slab dimension (the slowest non-flat dimension)
+    int slabAxis_{};
+    // number of vertices per layer
+    SimplexId layerSize_{};
+    // number of layers
+    SimplexId layerNumber_{};
+    // number of owned layers per slab
+    SimplexId slabThickness_{-1};
+
+    // layers [firstLayer_, lastLayer_) of the current slab
+    SimplexId firstLayer_{}, lastLayer_{};
+    // owned layers [firstOwnedLayer_, lastOwnedLayer_) of the current slab
+    SimplexId firstOwnedLayer_{}, lastOwnedLayer_{};
+
+    std::ifstream file_{};
+    std::vector<char> data_{};
+    ImplicitTriangulation triangulation_{};
+  };
+} // namespace ttk
@@ -183,14 +183,21 @@ int ttk::Laplacian::cotanWeights(SparseMatrixType &output,
   return 0;
 }
 
-#define LAPLACIAN_SPECIALIZE(TYPE)                       \
+#define LAPLACIAN_SPECIALIZE(TYPE, TRIANGULATION)        \
   template int ttk::Laplacian::discreteLaplacian<TYPE>(  \
-    Eigen::SparseMatrix<TYPE> &, const Triangulation &); \
+    Eigen::SparseMatrix<TYPE> &, const TRIANGULATION &); \
   template int ttk::Laplacian::cotanWeights<TYPE>(       \
-    Eigen::SparseMatrix<TYPE> &, const Triangulation &)
-
-// explicit intantiations for floating-point types
-LAPLACIAN_SPECIALIZE(float);
-LAPLACIAN_SPECIALIZE(double);
+    Eigen::SparseMatrix<TYPE> &, const TRIANGULATION &)
+
+#define LAPLACIAN_SPECIALIZE_ALL(TYPE)                       \
+  LAPLACIAN_SPECIALIZE(TYPE, Triangulation);                 \
+  LAPLACIAN_SPECIALIZE(TYPE, ExplicitTriangulation);         \
+  LAPLACIAN_SPECIALIZE(TYPE, ImplicitTriangulation);         \
+  LAPLACIAN_SPECIALIZE(TYPE, PeriodicImplicitTriangulation); \
+  LAPLACIAN_SPECIALIZE(TYPE, CompactTriangulation)
+
+// explicit intantiations for floating-point types and concrete triangulations
+LAPLACIAN_SPECIALIZE_ALL(float);
+LAPLACIAN_SPECIALIZE_ALL(double);
 
 #endif // TTK_ENABLE_EIGEN
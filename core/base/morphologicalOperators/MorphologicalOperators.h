@@ -121,6 +121,8 @@ int ttk::MorphologicalOperators::performElementaryMorphoOp(
   TT *triangulation) const {
 
   SimplexId nVertices = triangulation->getNumberOfVertices();
+  // cache-friendly traversal (bricks on regular grids)
+  const auto blocks = triangulation->getVertexBlocks();
 
   std::vector<DT> temp;
   if(iterations > 1) {
@@ -154,24 +156,26 @@ int ttk::MorphologicalOperators::performElementaryMorphoOp(
 #ifdef TTK_ENABLE_OPENMP
 #pragma omp parallel for num_threads(this->threadNumber_)
 #endif
-        for(SimplexId i = 0; i < nVertices; i++) {
-          // first copy data
-          target[i] = source[i];
-
-          // if current vertex value is not a dilated value
-          if(source[i] != pivotLabel) {
-            // check neighbors if they need to be dilated
-            const SimplexId nNeighbors
-              = triangulation->getVertexNeighborNumber(i);
-            SimplexId nIndex;
-            for(SimplexId n = 0; n < nNeighbors; n++) {
-              triangulation->getVertexNeighbor(i, n, nIndex);
-              if(source[nIndex] == pivotLabel) {
-                target[i] = source[nIndex];
-                break;
+        for(SimplexId block = 0; block < blocks.size(); block++) {
+          blocks.forEach(block, [&](const SimplexId i) {
+            // first copy data
+            target[i] = source[i];
+
+            // if current vertex value is not a dilated value
+            if(source[i] != pivotLabel) {
+              // check neighbors if they need to be dilated
+              const SimplexId nNeighbors
+                = triangulation->getVertexNeighborNumber(i);
+              SimplexId nIndex;
+              for(SimplexId n = 0; n < nNeighbors; n++) {
+                triangulation->getVertexNeighbor(i, n, nIndex);
+                if(source[nIndex] == pivotLabel) {
+                  target[i] = source[nIndex];
+                  break;
+                }
               }
             }
-          }
+          });
         }
       } else { // binary erosion
         const DT minLabel = std::numeric_limits<DT>::min();
@@ -179,27 +183,29 @@ int ttk::MorphologicalOperators::performElementaryMorphoOp(
 #ifdef TTK_ENABLE_OPENMP
 #pragma omp parallel for num_threads(this->threadNumber_)
 #endif
-        for(SimplexId i = 0; i < nVertices; i++) {
-          // first copy data
-          target[i] = source[i];
-
-          // if current vertex value needs to be eroded
-          if(source[i] == pivotLabel) {
-            // check neighbors if neighbors have a non-eroded label
-            const SimplexId nNeighbors
-              = triangulation->getVertexNeighborNumber(i);
-            SimplexId nIndex;
-            DT maxNeighborLabel = minLabel;
-            for(SimplexId n = 0; n < nNeighbors; n++) {
-              triangulation->getVertexNeighbor(i, n, nIndex);
-              if(source[nIndex] != pivotLabel
-                 && maxNeighborLabel < source[nIndex]) {
-                maxNeighborLabel = source[nIndex];
+        for(SimplexId block = 0; block < blocks.size(); block++) {
+          blocks.forEach(block, [&](const SimplexId i) {
+            // first copy data
+            target[i] = source[i];
+
+            // if current vertex value needs to be eroded
+            if(source[i] == pivotLabel) {
+              // check neighbors if neighbors have a non-eroded label
+              const SimplexId nNeighbors
+                = triangulation->getVertexNeighborNumber(i);
+              SimplexId nIndex;
+              DT maxNeighborLabel = minLabel;
+              for(SimplexId n = 0; n < nNeighbors; n++) {
+                triangulation->getVertexNeighbor(i, n, nIndex);
+                if(source[nIndex] != pivotLabel
+                   && maxNeighborLabel < source[nIndex]) {
+                  maxNeighborLabel = source[nIndex];
+                }
               }
+              if(maxNeighborLabel != minLabel)
+                target[i] = maxNeighborLabel;
             }
-            if(maxNeighborLabel != minLabel)
-              target[i] = maxNeighborLabel;
-          }
+          });
         }
       }
     } else {
@@ -208,29 +214,33 @@ int ttk::MorphologicalOperators::performElementaryMorphoOp(
 #ifdef TTK_ENABLE_OPENMP
 #pragma omp parallel for num_threads(this->threadNumber_)
 #endif // TTK_ENABLE_OPENMP
-        for(SimplexId i = 0; i < nVertices; i++) {
-          // first copy data
-          target[i] = source[i];
-          const auto nNeighs = triangulation->getVertexNeighborNumber(i);
-          for(SimplexId n = 0; n < nNeighs; n++) {
-            SimplexId neigh{};
-            triangulation->getVertexNeighbor(i, n, neigh);
-            target[i] = std::max(target[i], source[neigh]);
-          }
+        for(SimplexId block = 0; block < blocks.size(); block++) {
+          blocks.forEach(block, [&](const SimplexId i) {
+            // first copy data
+            target[i] = source[i];
+            const auto nNeighs = triangulation->getVertexNeighborNumber(i);
+            for(SimplexId n = 0; n < nNeighs; n++) {
+              SimplexId neigh{};
+              triangulation->getVertexNeighbor(i, n, neigh);
+              target[i] = std::max(target[i], source[neigh]);
+            }
+          });
         }
       } else { // grayscale erosion
 #ifdef TTK_ENABLE_OPENMP
 #pragma omp parallel for num_threads(this->threadNumber_)
 #endif // TTK_ENABLE_OPENMP
-        for(SimplexId i = 0; i < nVertices; i++) {
-          // first copy data
-          target[i] = source[i];
-          const auto nNeighs = triangulation->getVertexNeighborNumber(i);
-          for(SimplexId n = 0; n < nNeighs; n++) {
-            SimplexId neigh{};
-            triangulation->getVertexNeighbor(i, n, neigh);
-            target[i] = std::min(target[i], source[neigh]);
-          }
+        for(SimplexId block = 0; block < blocks.size(); block++) {
+          blocks.forEach(block, [&](const SimplexId i) {
+            // first copy data
+            target[i] = source[i];
+            const auto nNeighs = triangulation->getVertexNeighborNumber(i);
+            for(SimplexId n = 0; n < nNeighs; n++) {
+              SimplexId neigh{};
+              triangulation->getVertexNeighbor(i, n, neigh);
+              target[i] = std::min(target[i], source[neigh]);
+            }
+          });
         }
       }
     }
@@ -262,6 +262,35 @@ namespace ttk {
         ->setSaddleConnectorsPersistenceThreshold(threshold);
     }
 
+    int setSaddleConnectorsHierarchy(const bool state) {
+#ifndef TTK_ENABLE_KAMIKAZE
+      if(!abstractMorseSmaleComplex_) {
+        return -1;
+      }
+#endif
+      return abstractMorseSmaleComplex_->setSaddleConnectorsHierarchy(state);
+    }
+
+    int setPointerJumpingSegmentation(const bool state) {
+#ifndef TTK_ENABLE_KAMIKAZE
+      if(!abstractMorseSmaleComplex_) {
+        return -1;
+      }
+#endif
+      return abstractMorseSmaleComplex_->setPointerJumpingSegmentation(state);
+    }
+
+    int setInputTimeStamp(const size_t scalarFieldTimeStamp,
+                          const size_t offsetsTimeStamp) {
+#ifndef TTK_ENABLE_KAMIKAZE
+      if(!abstractMorseSmaleComplex_) {
+        return -1;
+      }
+#endif
+      return abstractMorseSmaleComplex_->setInputTimeStamp(
+        scalarFieldTimeStamp, offsetsTimeStamp);
+    }
+
     inline void preconditionTriangulation(AbstractTriangulation *const data) {
       dimensionality_ = data->getCellVertexNumber(0) - 1;
       if(dimensionality_ == 2) {
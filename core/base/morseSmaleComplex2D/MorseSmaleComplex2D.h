@@ -42,7 +42,7 @@ namespace ttk {
     int getAscendingSeparatrices1(
       const std::vector<dcg::Cell> &criticalPoints,
       std::vector<Separatrix> &separatrices,
-      std::vector<std::vector<dcg::Cell>> &separatricesGeometry,
+      SeparatricesGeometry &separatricesGeometry,
       const triangulationType &triangulation) const;
   };
 } // namespace ttk
@@ -73,12 +73,19 @@ int ttk::MorseSmaleComplex2D::execute(const triangulationType &triangulation) {
 
   discreteGradient_.setThreadNumber(threadNumber_);
   discreteGradient_.setDebugLevel(debugLevel_);
+  this->checkGradientCache(triangulation);
   {
     Timer tmp;
-    discreteGradient_.buildGradient<triangulationType>(triangulation);
+    if(gradientState_ == GradientState::EMPTY) {
+      discreteGradient_.buildGradient<triangulationType>(triangulation);
+      gradientState_ = GradientState::BUILT;
 
-    this->printMsg("Discrete gradient computed", 1.0, tmp.getElapsedTime(),
-                   this->threadNumber_);
+      this->printMsg("Discrete gradient computed", 1.0, tmp.getElapsedTime(),
+                     this->threadNumber_);
+    } else {
+      this->printMsg("Discrete gradient reused", 1.0, tmp.getElapsedTime(),
+                     this->threadNumber_);
+    }
   }
 
   std::vector<dcg::Cell> criticalPoints;
@@ -88,7 +95,7 @@ int ttk::MorseSmaleComplex2D::execute(const triangulationType &triangulation) {
   if(ComputeDescendingSeparatrices1) {
     Timer tmp;
     std::vector<Separatrix> separatrices;
-    std::vector<std::vector<dcg::Cell>> separatricesGeometry;
+    SeparatricesGeometry separatricesGeometry;
     getDescendingSeparatrices1(
       criticalPoints, separatrices, separatricesGeometry, triangulation);
     setSeparatrices1(separatrices, separatricesGeometry, triangulation);
@@ -100,7 +107,7 @@ int ttk::MorseSmaleComplex2D::execute(const triangulationType &triangulation) {
   if(ComputeAscendingSeparatrices1) {
     Timer tmp;
     std::vector<Separatrix> separatrices;
-    std::vector<std::vector<dcg::Cell>> separatricesGeometry;
+    SeparatricesGeometry separatricesGeometry;
     getAscendingSeparatrices1(
       criticalPoints, separatrices, separatricesGeometry, triangulation);
     setSeparatrices1(separatrices, separatricesGeometry, triangulation);
@@ -163,7 +170,7 @@ template <typename triangulationType>
 int ttk::MorseSmaleComplex2D::getAscendingSeparatrices1(
   const std::vector<Cell> &criticalPoints,
   std::vector<Separatrix> &separatrices,
-  std::vector<std::vector<Cell>> &separatricesGeometry,
+  SeparatricesGeometry &separatricesGeometry,
   const triangulationType &triangulation) const {
 
   std::vector<SimplexId> saddleIndexes;
@@ -180,7 +187,11 @@ int ttk::MorseSmaleComplex2D::getAscendingSeparatrices1(
   // numberOfAscendingPaths=2, numberOfDescendingPaths=2
   const SimplexId numberOfSeparatrices = 4 * numberOfSaddles;
   separatrices.resize(numberOfSeparatrices);
-  separatricesGeometry.resize(numberOfSeparatrices);
+
+  // vpaths traced in per-thread arenas
+  std::vector<std::vector<Cell>> arenas(this->threadNumber_);
+  std::vector<SeparatricesGeometry::ArenaRange> ranges(numberOfSeparatrices);
+  const SimplexId firstGeometry = separatricesGeometry.size();
 
   // apriori: by default construction, the separatrices are not valid
 #ifdef TTK_ENABLE_OPENMP
@@ -190,6 +201,13 @@ int ttk::MorseSmaleComplex2D::getAscendingSeparatrices1(
     const SimplexId saddleIndex = saddleIndexes[i];
     const Cell &saddle = criticalPoints[saddleIndex];
 
+#ifdef TTK_ENABLE_OPENMP
+    const int tid = omp_get_thread_num();
+#else
+    const int tid = 0;
+#endif // TTK_ENABLE_OPENMP
+    auto &vpaths = arenas[tid];
+
     // add ascending vpaths
     {
       const SimplexId starNumber = triangulation.getEdgeStarNumber(saddle.id_);
@@ -199,22 +217,26 @@ int ttk::MorseSmaleComplex2D::getAscendingSeparatrices1(
         SimplexId triangleId;
         triangulation.getEdgeStar(saddle.id_, j, triangleId);
 
-        std::vector<Cell> vpath;
-        vpath.push_back(saddle);
+        const size_t begin = vpaths.size();
+        vpaths.push_back(saddle);
         discreteGradient_.getAscendingPath(
-          Cell(2, triangleId), vpath, triangulation);
+          Cell(2, triangleId), vpaths, triangulation);
 
-        const Cell &lastCell = vpath.back();
+        const Cell lastCell = vpaths.back();
         if(lastCell.dim_ == 2 and discreteGradient_.isCellCritical(lastCell)) {
           const SimplexId separatrixIndex = 4 * i + shift;
 
-          separatricesGeometry[separatrixIndex] = std::move(vpath);
-          separatrices[separatrixIndex]
-            = Separatrix(true, saddle, lastCell, false, separatrixIndex);
+          ranges[separatrixIndex] = {tid, begin, vpaths.size()};
+          separatrices[separatrixIndex] = Separatrix(
+            true, saddle, lastCell, firstGeometry + separatrixIndex);
+        } else {
+          vpaths.resize(begin);
         }
       }
     }
   }
 
+  separatricesGeometry.gather(arenas, ranges, this->threadNumber_);
+
   return 0;
 }
@@ -1,4 +1,5 @@
 #include <MorseSmaleComplex3D.h>
+#include <algorithm>
 #include <iterator>
 
 ttk::MorseSmaleComplex3D::MorseSmaleComplex3D() : AbstractMorseSmaleComplex() {
@@ -6,32 +7,66 @@ ttk::MorseSmaleComplex3D::MorseSmaleComplex3D() : AbstractMorseSmaleComplex() {
 }
 
 void ttk::MorseSmaleComplex3D::flattenSeparatricesVectors(
-  std::vector<std::vector<ttk::Separatrix>> &separatrices,
-  std::vector<std::vector<std::vector<ttk::dcg::Cell>>> &separatricesGeometry)
-  const {
+  std::vector<std::vector<ttk::Separatrix>> &separatrices) const {
 
   std::vector<size_t> partialSizes{0};
   for(const auto &sep : separatrices) {
     partialSizes.emplace_back(partialSizes.back() + sep.size());
   }
   separatrices[0].resize(partialSizes.back());
-  separatricesGeometry[0].resize(partialSizes.back());
 
   for(size_t i = 1; i < separatrices.size(); ++i) {
     const auto offset = partialSizes[i];
 
+    // the geometry indices already address the shared geometry storage
+    std::copy(separatrices[i].begin(), separatrices[i].end(),
+              separatrices[0].begin() + offset);
+  }
+}
+
+void ttk::MorseSmaleComplex3D::packMarkedIds(
+  std::vector<SimplexId> &marks,
+  std::vector<SimplexId> &markedIds,
+  const size_t offset) const {
+
+  const size_t n = marks.size();
+  const size_t nChunks = std::max(this->threadNumber_, 1);
+  const size_t chunkSize = n / nChunks + 1;
+  // number of marked entries before each chunk
+  std::vector<size_t> chunkBegId(nChunks + 1);
+
+  // 1. count the marked entries per chunk
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_) schedule(static, 1)
+#endif // TTK_ENABLE_OPENMP
+  for(size_t c = 0; c < nChunks; ++c) {
+    const size_t end = std::min(n, (c + 1) * chunkSize);
+    for(size_t i = c * chunkSize; i < end; ++i) {
+      if(marks[i] != 0) {
+        chunkBegId[c + 1]++;
+      }
+    }
+  }
+
+  // 2. prefix sum over the chunks
+  for(size_t c = 0; c < nChunks; ++c) {
+    chunkBegId[c + 1] += chunkBegId[c];
+  }
+  markedIds.resize(chunkBegId.back());
+
+  // 3. rank the marked entries
 #ifdef TTK_ENABLE_OPENMP
-#pragma omp parallel for num_threads(threadNumber_)
+#pragma omp parallel for num_threads(threadNumber_) schedule(static, 1)
 #endif // TTK_ENABLE_OPENMP
-    for(size_t j = 0; j < separatrices[i].size(); ++j) {
-      // shift separatrices geometry_
-      for(size_t k = 0; k < separatrices[i][j].geometry_.size(); ++k) {
-        separatrices[i][j].geometry_[k] += offset;
+  for(size_t c = 0; c < nChunks; ++c) {
+    const size_t end = std::min(n, (c + 1) * chunkSize);
+    size_t k = chunkBegId[c];
+    for(size_t i = c * chunkSize; i < end; ++i) {
+      if(marks[i] != 0) {
+        markedIds[k] = i;
+        marks[i] = offset + k;
+        k++;
       }
-      // flatten separatrices1 and separatricesGeometry1
-      separatrices[0][offset + j] = std::move(separatrices[i][j]);
-      separatricesGeometry[0][offset + j]
-        = std::move(separatricesGeometry[i][j]);
     }
   }
 }
@@ -44,7 +44,7 @@ namespace ttk {
     int getAscendingSeparatrices1(
       const std::vector<dcg::Cell> &criticalPoints,
       std::vector<Separatrix> &separatrices,
-      std::vector<std::vector<dcg::Cell>> &separatricesGeometry,
+      SeparatricesGeometry &separatricesGeometry,
       const triangulationType &triangulation) const;
 
     /**
@@ -55,7 +55,7 @@ namespace ttk {
     int getSaddleConnectors(
       const std::vector<dcg::Cell> &criticalPoints,
       std::vector<Separatrix> &separatrices,
-      std::vector<std::vector<dcg::Cell>> &separatricesGeometry,
+      SeparatricesGeometry &separatricesGeometry,
       const triangulationType &triangulation) const;
 
     /**
@@ -66,8 +66,8 @@ namespace ttk {
     int getDescendingSeparatrices2(
       const std::vector<dcg::Cell> &criticalPoints,
       std::vector<Separatrix> &separatrices,
-      std::vector<std::vector<dcg::Cell>> &separatricesGeometry,
-      std::vector<std::set<SimplexId>> &separatricesSaddles,
+      SeparatricesGeometry &separatricesGeometry,
+      std::vector<std::vector<SimplexId>> &separatricesSaddles,
       const triangulationType &triangulation) const;
 
     /**
@@ -83,8 +83,8 @@ namespace ttk {
     template <typename triangulationType>
     int setDescendingSeparatrices2(
       const std::vector<Separatrix> &separatrices,
-      const std::vector<std::vector<dcg::Cell>> &separatricesGeometry,
-      const std::vector<std::set<SimplexId>> &separatricesSaddles,
+      const SeparatricesGeometry &separatricesGeometry,
+      const std::vector<std::vector<SimplexId>> &separatricesSaddles,
       const triangulationType &triangulation) const;
 
     /**
@@ -114,8 +114,8 @@ namespace ttk {
     int getAscendingSeparatrices2(
       const std::vector<dcg::Cell> &criticalPoints,
       std::vector<Separatrix> &separatrices,
-      std::vector<std::vector<dcg::Cell>> &separatricesGeometry,
-      std::vector<std::set<SimplexId>> &separatricesSaddles,
+      SeparatricesGeometry &separatricesGeometry,
+      std::vector<std::vector<SimplexId>> &separatricesSaddles,
       const triangulationType &triangulation) const;
 
     /**
@@ -131,25 +131,32 @@ namespace ttk {
     template <typename triangulationType>
     int setAscendingSeparatrices2(
       const std::vector<Separatrix> &separatrices,
-      const std::vector<std::vector<dcg::Cell>> &separatricesGeometry,
-      const std::vector<std::set<SimplexId>> &separatricesSaddles,
+      const SeparatricesGeometry &separatricesGeometry,
+      const std::vector<std::vector<SimplexId>> &separatricesSaddles,
       const triangulationType &triangulation) const;
 
     /**
      * @brief Flatten the vectors of vectors into their first component
      */
     void flattenSeparatricesVectors(
-      std::vector<std::vector<ttk::Separatrix>> &separatrices,
-      std::vector<std::vector<std::vector<ttk::dcg::Cell>>>
-        &separatricesGeometry) const;
+      std::vector<std::vector<ttk::Separatrix>> &separatrices) const;
+
+    /**
+     * @brief Replace the non-zero entries of @p marks by @p offset plus
+     * their rank and list their indices in @p markedIds (in increasing
+     * order)
+     */
+    void packMarkedIds(std::vector<SimplexId> &marks,
+                       std::vector<SimplexId> &markedIds,
+                       const size_t offset) const;
   };
 } // namespace ttk
 
 template <typename triangulationType>
 int ttk::MorseSmaleComplex3D::setAscendingSeparatrices2(
   const std::vector<Separatrix> &separatrices,
-  const std::vector<std::vector<dcg::Cell>> &separatricesGeometry,
-  const std::vector<std::set<SimplexId>> &separatricesSaddles,
+  const SeparatricesGeometry &separatricesGeometry,
+  const std::vector<std::vector<SimplexId>> &separatricesSaddles,
   const triangulationType &triangulation) const {
 #ifndef TTK_ENABLE_KAMIKAZE
   if(outputSeparatrices2_numberOfPoints_ == nullptr) {
@@ -200,21 +207,15 @@ int ttk::MorseSmaleComplex3D::setAscendingSeparatrices2(
   std::vector<SimplexId> validGeomIds{};
   // corresponding separatrix index in separatrices array
   std::vector<SimplexId> geomIdSep{};
-  // cells beginning id for each separatrix geometry
-  std::vector<size_t> geomCellsBegId{ncells};
 
-  // count total number of cells, flatten geometryId loops
+  // flatten geometryId loops
   for(size_t i = 0; i < separatrices.size(); ++i) {
     const auto &sep = separatrices[i];
-    if(!sep.isValid_ || sep.geometry_.empty()) {
+    if(!sep.isValid_ || sep.geometry_ == -1) {
       continue;
     }
-    for(const auto geomId : sep.geometry_) {
-      ncells += separatricesGeometry[geomId].size();
-      geomCellsBegId.emplace_back(ncells);
-      validGeomIds.emplace_back(geomId);
-      geomIdSep.emplace_back(i);
-    }
+    validGeomIds.emplace_back(sep.geometry_);
+    geomIdSep.emplace_back(i);
   }
 
   // store the separatrices info (one per separatrix)
@@ -225,17 +226,17 @@ int ttk::MorseSmaleComplex3D::setAscendingSeparatrices2(
     separatrixFunctionMaxima->resize(separatrixId + validGeomIds.size());
   if(separatrixFunctionMinima != nullptr)
     separatrixFunctionMinima->resize(separatrixId + validGeomIds.size());
-  // store the polygonal cells tetras SimplexId
-  std::vector<SimplexId> polygonNTetras(ncells - noldcells);
-  std::vector<SimplexId> polygonEdgeIds(ncells - noldcells);
-  std::vector<SimplexId> polygonSepInfosIds(ncells - noldcells);
+  // first polygon and first polygon vertex of each separatrix
+  std::vector<size_t> sepPolygonsBegId(validGeomIds.size() + 1);
+  std::vector<size_t> sepPolygonVertsBegId(validGeomIds.size() + 1);
 
 #ifdef TTK_ENABLE_OPENMP
 #pragma omp parallel for num_threads(threadNumber_) schedule(dynamic)
 #endif // TTK_ENABLE_OPENMP
   for(size_t i = 0; i < validGeomIds.size(); ++i) {
     const auto &sep = separatrices[geomIdSep[i]];
-    const auto &sepGeom = separatricesGeometry[validGeomIds[i]];
+    const auto sepGeom = separatricesGeometry.begin(validGeomIds[i]);
+    const auto sepGeomSize = separatricesGeometry.size(validGeomIds[i]);
     const auto &sepSaddles = separatricesSaddles[validGeomIds[i]];
     const auto sepId = separatrixId + i;
     const dcg::Cell &src = sep.source_; // saddle1
@@ -243,16 +244,21 @@ int ttk::MorseSmaleComplex3D::setAscendingSeparatrices2(
     // compute separatrix function diff
     const auto sepFuncMin
       = discreteGradient_.getCellLowerVertex(src, triangulation);
-    const auto maxId = *std::max_element(
-      sepSaddles.begin(), sepSaddles.end(),
-      [&triangulation, offsets, this](const SimplexId a, const SimplexId b) {
-        return offsets[discreteGradient_.getCellGreaterVertex(
-                 Cell{2, a}, triangulation)]
-               < offsets[discreteGradient_.getCellGreaterVertex(
-                 Cell{2, b}, triangulation)];
-      });
+    const auto cmpMax
+      = [&triangulation, offsets, this](const SimplexId a, const SimplexId b) {
+          return offsets[discreteGradient_.getCellGreaterVertex(
+                   Cell{2, a}, triangulation)]
+                 < offsets[discreteGradient_.getCellGreaterVertex(
+                   Cell{2, b}, triangulation)];
+        };
+    // a wall that meets no 2-saddle is bounded by its 1-saddle
+    const auto maxCell
+      = sepSaddles.empty()
+          ? src
+          : Cell{2, *std::max_element(
+                      sepSaddles.begin(), sepSaddles.end(), cmpMax)};
     const auto sepFuncMax
-      = discreteGradient_.getCellGreaterVertex(Cell{2, maxId}, triangulation);
+      = discreteGradient_.getCellGreaterVertex(maxCell, triangulation);
 
     // get boundary condition
     const char onBoundary
@@ -270,76 +276,32 @@ int ttk::MorseSmaleComplex3D::setAscendingSeparatrices2(
       (*separatrixFunctionMinima)[sepId] = sepFuncMin;
     sepOnBoundary[i] = onBoundary;
 
-    for(size_t j = 0; j < sepGeom.size(); ++j) {
-      const auto &cell = sepGeom[j];
-      // index of current cell in cell data arrays
-      const auto k = geomCellsBegId[i] + j - noldcells;
-
-      polygonNTetras[k] = triangulation.getEdgeStarNumber(cell.id_);
-
-      if(polygonNTetras[k] > 2) {
-        polygonEdgeIds[k] = cell.id_;
-        polygonSepInfosIds[k] = i;
+    // count the dual polygons (edges with more than 2 tetras in their
+    // star) and their vertices
+    size_t nPolygons{}, nPolygonVerts{};
+    for(size_t j = 0; j < sepGeomSize; ++j) {
+      const auto nTetras = triangulation.getEdgeStarNumber(sepGeom[j].id_);
+      if(nTetras > 2) {
+        nPolygons++;
+        nPolygonVerts += nTetras;
       }
     }
+    sepPolygonsBegId[i + 1] = nPolygons;
+    sepPolygonVertsBegId[i + 1] = nPolygonVerts;
   }
 
-  // indices of valid polygon tetras
-  std::vector<SimplexId> validTetraIds{};
-  validTetraIds.reserve(polygonNTetras.size());
-
-  for(size_t i = 0; i < polygonNTetras.size(); ++i) {
-    if(polygonNTetras[i] > 2) {
-      validTetraIds.emplace_back(i);
-    }
-  }
-
-  // count number of valid new cells and new points
-  size_t nnewpoints{};
-  std::vector<SimplexId> pointsPerCell(validTetraIds.size() + 1);
-  for(size_t i = 0; i < validTetraIds.size(); ++i) {
-    nnewpoints += polygonNTetras[validTetraIds[i]];
-    pointsPerCell[i + 1] = nnewpoints;
-  }
-
-  // resize connectivity array
-  outputSeparatrices2_cells_connectivity_->resize(firstCellId + nnewpoints);
-  auto cellsConn = &outputSeparatrices2_cells_connectivity_->at(firstCellId);
-  // copy of cell connectivity array (for removing duplicates vertices)
-  std::vector<SimplexId> cellVertsIds(nnewpoints);
-
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp parallel for num_threads(threadNumber_)
-#endif // TTK_ENABLE_OPENMP
-  for(size_t i = 0; i < validTetraIds.size(); ++i) {
-    const auto k = validTetraIds[i];
-
-    // get tetras in edge star
-    getDualPolygon(polygonEdgeIds[k], &cellVertsIds[pointsPerCell[i]],
-                   polygonNTetras[k], triangulation);
-    // sort tetras (in-place)
-    sortDualPolygonVertices(
-      &cellVertsIds[pointsPerCell[i]], polygonNTetras[k], triangulation);
-
-    for(SimplexId j = 0; j < polygonNTetras[k]; ++j) {
-      cellsConn[pointsPerCell[i] + j] = cellVertsIds[pointsPerCell[i] + j];
-    }
+  for(size_t i = 0; i < validGeomIds.size(); ++i) {
+    sepPolygonsBegId[i + 1] += sepPolygonsBegId[i];
+    sepPolygonVertsBegId[i + 1] += sepPolygonVertsBegId[i];
   }
 
-  PSORT(this->threadNumber_)(cellVertsIds.begin(), cellVertsIds.end());
-  const auto last = std::unique(cellVertsIds.begin(), cellVertsIds.end());
-  cellVertsIds.erase(last, cellVertsIds.end());
-
-  // vertex Id to index in points array
-  std::vector<SimplexId> vertId2PointsId(triangulation.getNumberOfCells());
-
-  const auto noldpoints{npoints};
-  npoints += cellVertsIds.size();
-  ncells = noldcells + validTetraIds.size();
+  ncells = noldcells + sepPolygonsBegId.back();
 
   // resize arrays
-  outputSeparatrices2_points_->resize(3 * npoints);
-  auto points = &outputSeparatrices2_points_->at(3 * noldpoints);
+  outputSeparatrices2_cells_connectivity_->resize(
+    firstCellId + sepPolygonVertsBegId.back());
+  auto cellsConn
+    = outputSeparatrices2_cells_connectivity_->data() + firstCellId;
   outputSeparatrices2_cells_offsets_->resize(ncells + 1);
   outputSeparatrices2_cells_offsets_->at(0) = 0;
   auto cellsOff = &outputSeparatrices2_cells_offsets_->at(noldcells);
@@ -352,41 +314,78 @@ int ttk::MorseSmaleComplex3D::setAscendingSeparatrices2(
   if(outputSeparatrices2_cells_isOnBoundary_ != nullptr)
     outputSeparatrices2_cells_isOnBoundary_->resize(ncells);
 
+  // tetra Id to index in points array (non-zero for polygon vertices)
+  std::vector<SimplexId> vertId2PointsId(triangulation.getNumberOfCells());
+
+  // write the polygons at their final place in a single pass
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_) schedule(dynamic)
+#endif // TTK_ENABLE_OPENMP
+  for(size_t i = 0; i < validGeomIds.size(); ++i) {
+    const auto sepGeom = separatricesGeometry.begin(validGeomIds[i]);
+    const auto sepGeomSize = separatricesGeometry.size(validGeomIds[i]);
+    // index of current polygon among all new cells
+    auto k = sepPolygonsBegId[i];
+    // index of the first vertex of the current polygon
+    auto m = sepPolygonVertsBegId[i];
+
+    for(size_t j = 0; j < sepGeomSize; ++j) {
+      const auto edgeId = sepGeom[j].id_;
+      const SimplexId nTetras = triangulation.getEdgeStarNumber(edgeId);
+      if(nTetras <= 2) {
+        continue;
+      }
+
+      // get tetras in edge star
+      getDualPolygon(edgeId, &cellsConn[m], nTetras, triangulation);
+      // sort tetras (in-place)
+      sortDualPolygonVertices(&cellsConn[m], nTetras, triangulation);
+
+      for(SimplexId n = 0; n < nTetras; ++n) {
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp atomic write
+#endif // TTK_ENABLE_OPENMP
+        vertId2PointsId[cellsConn[m + n]] = 1;
+      }
+
+      m += nTetras;
+      cellsOff[k + 1] = firstCellId + m;
+
+      const auto l = k + noldcells;
+      if(outputSeparatrices2_cells_sourceIds_ != nullptr)
+        (*outputSeparatrices2_cells_sourceIds_)[l] = sepSourceIds[i];
+      if(outputSeparatrices2_cells_separatrixIds_ != nullptr)
+        (*outputSeparatrices2_cells_separatrixIds_)[l] = sepIds[i];
+      if(outputSeparatrices2_cells_separatrixTypes_ != nullptr)
+        (*outputSeparatrices2_cells_separatrixTypes_)[l] = 1;
+      if(outputSeparatrices2_cells_isOnBoundary_ != nullptr)
+        (*outputSeparatrices2_cells_isOnBoundary_)[l] = sepOnBoundary[i];
+      k++;
+    }
+  }
+
+  // the polygon vertices, sorted by tetra id
+  std::vector<SimplexId> cellVertsIds{};
+  const auto noldpoints{npoints};
+  packMarkedIds(vertId2PointsId, cellVertsIds, noldpoints);
+  npoints += cellVertsIds.size();
+
+  outputSeparatrices2_points_->resize(3 * npoints);
+  auto points = &outputSeparatrices2_points_->at(3 * noldpoints);
+
 #ifdef TTK_ENABLE_OPENMP
 #pragma omp parallel for num_threads(threadNumber_)
 #endif // TTK_ENABLE_OPENMP
   for(size_t i = 0; i < cellVertsIds.size(); ++i) {
     // vertex 3D coords
     triangulation.getTetraIncenter(cellVertsIds[i], &points[3 * i]);
-    // vertex index in cellVertsIds array (do not forget offset)
-    vertId2PointsId[cellVertsIds[i]] = i + noldpoints;
   }
 
 #ifdef TTK_ENABLE_OPENMP
 #pragma omp parallel for num_threads(threadNumber_)
 #endif // TTK_ENABLE_OPENMP
-  for(size_t i = 0; i < validTetraIds.size(); ++i) {
-    const auto m = validTetraIds[i];
-    const auto k = pointsPerCell[i];
-    for(SimplexId j = 0; j < polygonNTetras[m]; ++j) {
-      cellsConn[k + j] = vertId2PointsId[cellsConn[k + j]];
-    }
-    const auto l = i + noldcells;
-    const auto n = polygonSepInfosIds[m];
-
-    if(outputSeparatrices2_cells_sourceIds_ != nullptr)
-      (*outputSeparatrices2_cells_sourceIds_)[l] = sepSourceIds[n];
-    if(outputSeparatrices2_cells_separatrixIds_ != nullptr)
-      (*outputSeparatrices2_cells_separatrixIds_)[l] = sepIds[n];
-    if(outputSeparatrices2_cells_separatrixTypes_ != nullptr)
-      (*outputSeparatrices2_cells_separatrixTypes_)[l] = 1;
-    if(outputSeparatrices2_cells_isOnBoundary_ != nullptr)
-      (*outputSeparatrices2_cells_isOnBoundary_)[l] = sepOnBoundary[n];
-  }
-
-  for(size_t i = 0; i < validTetraIds.size(); ++i) {
-    // fill offsets sequentially (due to iteration dependencies)
-    cellsOff[i + 1] = cellsOff[i] + polygonNTetras[validTetraIds[i]];
+  for(size_t i = 0; i < sepPolygonVertsBegId.back(); ++i) {
+    cellsConn[i] = vertId2PointsId[cellsConn[i]];
   }
 
   (*outputSeparatrices2_numberOfPoints_) = npoints;
@@ -398,8 +397,8 @@ int ttk::MorseSmaleComplex3D::setAscendingSeparatrices2(
 template <typename triangulationType>
 int ttk::MorseSmaleComplex3D::setDescendingSeparatrices2(
   const std::vector<Separatrix> &separatrices,
-  const std::vector<std::vector<dcg::Cell>> &separatricesGeometry,
-  const std::vector<std::set<SimplexId>> &separatricesSaddles,
+  const SeparatricesGeometry &separatricesGeometry,
+  const std::vector<std::vector<SimplexId>> &separatricesSaddles,
   const triangulationType &triangulation) const {
 #ifndef TTK_ENABLE_KAMIKAZE
   if(outputSeparatrices2_numberOfPoints_ == nullptr) {
@@ -457,15 +456,13 @@ int ttk::MorseSmaleComplex3D::setDescendingSeparatrices2(
   // count total number of cells, flatten geometryId loops
   for(size_t i = 0; i < separatrices.size(); ++i) {
     const auto &sep = separatrices[i];
-    if(!sep.isValid_ || sep.geometry_.empty()) {
+    if(!sep.isValid_ || sep.geometry_ == -1) {
       continue;
     }
-    for(const auto geomId : sep.geometry_) {
-      ncells += separatricesGeometry[geomId].size();
-      geomCellsBegId.emplace_back(ncells);
-      validGeomIds.emplace_back(geomId);
-      geomIdSep.emplace_back(i);
-    }
+    ncells += separatricesGeometry.size(sep.geometry_);
+    geomCellsBegId.emplace_back(ncells);
+    validGeomIds.emplace_back(sep.geometry_);
+    geomIdSep.emplace_back(i);
   }
 
   // resize arrays
@@ -474,7 +471,8 @@ int ttk::MorseSmaleComplex3D::setDescendingSeparatrices2(
   outputSeparatrices2_cells_connectivity_->resize(
     firstCellId + 3 * (ncells - noldcells)); // triangles cells
   auto cellsOff = &outputSeparatrices2_cells_offsets_->at(noldcells);
-  auto cellsConn = &outputSeparatrices2_cells_connectivity_->at(firstCellId);
+  auto cellsConn
+    = outputSeparatrices2_cells_connectivity_->data() + firstCellId;
   if(outputSeparatrices2_cells_sourceIds_ != nullptr)
     outputSeparatrices2_cells_sourceIds_->resize(ncells);
   if(outputSeparatrices2_cells_separatrixIds_ != nullptr)
@@ -488,15 +486,16 @@ int ttk::MorseSmaleComplex3D::setDescendingSeparatrices2(
   if(outputSeparatrices2_cells_isOnBoundary_ != nullptr)
     outputSeparatrices2_cells_isOnBoundary_->resize(ncells);
 
-  // store the cells/triangles vertices vertexId
-  std::vector<SimplexId> cellVertsIds(3 * (ncells - noldcells));
+  // vertex Id to index in points array (non-zero for triangle vertices)
+  std::vector<SimplexId> vertId2PointsId(triangulation.getNumberOfVertices());
 
 #ifdef TTK_ENABLE_OPENMP
-#pragma omp parallel for num_threads(threadNumber_)
+#pragma omp parallel for num_threads(threadNumber_) schedule(dynamic)
 #endif // TTK_ENABLE_OPENMP
   for(size_t i = 0; i < validGeomIds.size(); ++i) {
     const auto &sep = separatrices[geomIdSep[i]];
-    const auto &sepGeom = separatricesGeometry[validGeomIds[i]];
+    const auto sepGeom = separatricesGeometry.begin(validGeomIds[i]);
+    const auto sepGeomSize = separatricesGeometry.size(validGeomIds[i]);
     const auto &sepSaddles = separatricesSaddles[validGeomIds[i]];
     const auto sepId = separatrixId + i;
     const dcg::Cell &src = sep.source_; // saddle2
@@ -505,16 +504,21 @@ int ttk::MorseSmaleComplex3D::setDescendingSeparatrices2(
     // compute separatrix function diff
     const auto sepFuncMax
       = discreteGradient_.getCellGreaterVertex(src, triangulation);
-    const auto minId = *std::min_element(
-      sepSaddles.begin(), sepSaddles.end(),
-      [&triangulation, offsets, this](const SimplexId a, const SimplexId b) {
-        return offsets[discreteGradient_.getCellLowerVertex(
-                 Cell{1, a}, triangulation)]
-               < offsets[discreteGradient_.getCellLowerVertex(
-                 Cell{1, b}, triangulation)];
-      });
+    const auto cmpMin
+      = [&triangulation, offsets, this](const SimplexId a, const SimplexId b) {
+          return offsets[discreteGradient_.getCellLowerVertex(
+                   Cell{1, a}, triangulation)]
+                 < offsets[discreteGradient_.getCellLowerVertex(
+                   Cell{1, b}, triangulation)];
+        };
+    // a wall that meets no 1-saddle is bounded by its 2-saddle
+    const auto minCell
+      = sepSaddles.empty()
+          ? src
+          : Cell{1, *std::min_element(
+                      sepSaddles.begin(), sepSaddles.end(), cmpMin)};
     const auto sepFuncMin
-      = discreteGradient_.getCellLowerVertex(Cell{1, minId}, triangulation);
+      = discreteGradient_.getCellLowerVertex(minCell, triangulation);
     if(separatrixFunctionMaxima != nullptr)
       (*separatrixFunctionMaxima)[sepId] = sepFuncMax;
     if(separatrixFunctionMinima != nullptr)
@@ -528,26 +532,25 @@ int ttk::MorseSmaleComplex3D::setDescendingSeparatrices2(
                       })
         + triangulation.isTriangleOnBoundary(src.id_);
 
-    for(size_t j = 0; j < sepGeom.size(); ++j) {
+    for(size_t j = 0; j < sepGeomSize; ++j) {
       const auto &cell = sepGeom[j];
 
-      // first store the SimplexId of the cell/triangle vertices
-      SimplexId v0{}, v1{}, v2{};
-      triangulation.getTriangleVertex(cell.id_, 0, v0);
-      triangulation.getTriangleVertex(cell.id_, 1, v1);
-      triangulation.getTriangleVertex(cell.id_, 2, v2);
-
       // index of current cell in cell data arrays
       const auto l = geomCellsBegId[i] + j;
       // index of current cell among all new cells
       const auto m = l - noldcells;
 
-      cellsConn[3 * m + 0] = v0;
-      cellsConn[3 * m + 1] = v1;
-      cellsConn[3 * m + 2] = v2;
-      cellVertsIds[3 * m + 0] = v0;
-      cellVertsIds[3 * m + 1] = v1;
-      cellVertsIds[3 * m + 2] = v2;
+      // first store the SimplexId of the cell/triangle vertices
+      for(int n = 0; n < 3; ++n) {
+        SimplexId v{};
+        triangulation.getTriangleVertex(cell.id_, n, v);
+        cellsConn[3 * m + n] = v;
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp atomic write
+#endif // TTK_ENABLE_OPENMP
+        vertId2PointsId[v] = 1;
+      }
+      cellsOff[m + 1] = firstCellId + 3 * (m + 1);
 
       if(outputSeparatrices2_cells_sourceIds_ != nullptr)
         (*outputSeparatrices2_cells_sourceIds_)[l] = src.id_;
@@ -560,17 +563,13 @@ int ttk::MorseSmaleComplex3D::setDescendingSeparatrices2(
     }
   }
 
-  // reduce the cell vertices ids
+  // the triangles vertices, sorted by vertex id
   // (cells are triangles sharing two vertices)
-  PSORT(this->threadNumber_)(cellVertsIds.begin(), cellVertsIds.end());
-  const auto last = std::unique(cellVertsIds.begin(), cellVertsIds.end());
-  cellVertsIds.erase(last, cellVertsIds.end());
-
-  // vertex Id to index in points array
-  std::vector<size_t> vertId2PointsId(triangulation.getNumberOfVertices());
-
+  std::vector<SimplexId> cellVertsIds{};
   const auto noldpoints{npoints};
+  packMarkedIds(vertId2PointsId, cellVertsIds, noldpoints);
   npoints += cellVertsIds.size();
+
   outputSeparatrices2_points_->resize(3 * npoints);
   auto points = &outputSeparatrices2_points_->at(3 * noldpoints);
 
@@ -581,24 +580,15 @@ int ttk::MorseSmaleComplex3D::setDescendingSeparatrices2(
     // vertex 3D coords
     triangulation.getVertexPoint(
       cellVertsIds[i], points[3 * i + 0], points[3 * i + 1], points[3 * i + 2]);
-    // vertex index in cellVertsIds array (do not forget offset)
-    vertId2PointsId[cellVertsIds[i]] = i + noldpoints;
   }
 
-  const auto lastOffset = noldcells == 0 ? 0 : cellsOff[-1];
-
 #ifdef TTK_ENABLE_OPENMP
 #pragma omp parallel for num_threads(threadNumber_)
 #endif // TTK_ENABLE_OPENMP
-  for(size_t i = 0; i < ncells - noldcells; ++i) {
-    cellsOff[i] = 3 * i + lastOffset;
-    cellsConn[3 * i + 0] = vertId2PointsId[cellsConn[3 * i + 0]];
-    cellsConn[3 * i + 1] = vertId2PointsId[cellsConn[3 * i + 1]];
-    cellsConn[3 * i + 2] = vertId2PointsId[cellsConn[3 * i + 2]];
+  for(size_t i = 0; i < 3 * (ncells - noldcells); ++i) {
+    cellsConn[i] = vertId2PointsId[cellsConn[i]];
   }
 
-  cellsOff[ncells - noldcells] = cellsOff[ncells - noldcells - 1] + 3;
-
   (*outputSeparatrices2_numberOfPoints_) = npoints;
   (*outputSeparatrices2_numberOfCells_) = ncells;
 
@@ -631,32 +621,73 @@ int ttk::MorseSmaleComplex3D::execute(const triangulationType &triangulation) {
 
   discreteGradient_.setThreadNumber(threadNumber_);
   discreteGradient_.setDebugLevel(debugLevel_);
+  this->checkGradientCache(triangulation);
   {
     Timer tmp;
-    discreteGradient_.buildGradient<triangulationType>(triangulation);
+    // the saddle connectors can be filtered again from the copy of the
+    // PL-conformant gradient
+    if(gradientState_ == GradientState::FILTERED
+       && !(ReturnSaddleConnectors && hasPlGradient_)) {
+      discreteGradient_.initMemory(triangulation);
+      gradientState_ = GradientState::EMPTY;
+    }
+    if(gradientState_ == GradientState::EMPTY) {
+      discreteGradient_.buildGradient<triangulationType>(triangulation);
+      gradientState_ = GradientState::BUILT;
 
-    this->printMsg("Discrete gradient computed", 1.0, tmp.getElapsedTime(),
-                   this->threadNumber_);
+      this->printMsg("Discrete gradient computed", 1.0, tmp.getElapsedTime(),
+                     this->threadNumber_);
+    } else {
+      this->printMsg("Discrete gradient reused", 1.0, tmp.getElapsedTime(),
+                     this->threadNumber_);
+    }
   }
 
-  if(ReturnSaddleConnectors) {
-    discreteGradient_.reverseGradient<dataType>(triangulation);
+  if(ReturnSaddleConnectors
+     && !(gradientState_ == GradientState::FILTERED
+          && gradientPersistenceThreshold_
+               == SaddleConnectorsPersistenceThreshold)) {
+    // a filtered gradient holds the cancellations of the hierarchy
+    const bool inHierarchy = SaddleConnectorsHierarchy
+                             && gradientState_ == GradientState::FILTERED
+                             && saddleConnectorsHierarchy_.built_;
+    if(!inHierarchy) {
+      if(hasPlGradient_) {
+        discreteGradient_.restoreGradient(plGradient_);
+      } else {
+        discreteGradient_.reverseGradient<dataType>(triangulation);
+        // only worth a copy if the gradient can be reused
+        if(gradientTriangulation_ != nullptr) {
+          discreteGradient_.backupGradient(plGradient_);
+          hasPlGradient_ = true;
+        }
+      }
+      saddleConnectorsHierarchy_ = {};
+    }
+    if(SaddleConnectorsHierarchy) {
+      discreteGradient_.filterSaddleConnectors<dataType>(
+        saddleConnectorsHierarchy_, true, triangulation);
+    } else {
+      discreteGradient_.filterSaddleConnectors<dataType>(true, triangulation);
+    }
+    gradientState_ = GradientState::FILTERED;
+    gradientPersistenceThreshold_ = SaddleConnectorsPersistenceThreshold;
   }
 
   std::vector<dcg::Cell> criticalPoints;
   discreteGradient_.getCriticalPoints(criticalPoints, triangulation);
 
+  // the geometries of all the 1-separatrices share the same storage
   std::vector<std::vector<Separatrix>> separatrices1{};
-  std::vector<std::vector<std::vector<dcg::Cell>>> separatricesGeometry1;
+  SeparatricesGeometry separatricesGeometry1{};
 
   // 1-separatrices
   if(ComputeDescendingSeparatrices1) {
     Timer tmp;
     separatrices1.emplace_back();
-    separatricesGeometry1.emplace_back();
 
     getDescendingSeparatrices1(criticalPoints, separatrices1.back(),
-                               separatricesGeometry1.back(), triangulation);
+                               separatricesGeometry1, triangulation);
 
     this->printMsg("Descending 1-separatrices computed", 1.0,
                    tmp.getElapsedTime(), this->threadNumber_);
@@ -665,10 +696,9 @@ int ttk::MorseSmaleComplex3D::execute(const triangulationType &triangulation) {
   if(ComputeAscendingSeparatrices1) {
     Timer tmp;
     separatrices1.emplace_back();
-    separatricesGeometry1.emplace_back();
 
     getAscendingSeparatrices1(criticalPoints, separatrices1.back(),
-                              separatricesGeometry1.back(), triangulation);
+                              separatricesGeometry1, triangulation);
 
     this->printMsg("Ascending 1-separatrices computed", 1.0,
                    tmp.getElapsedTime(), this->threadNumber_);
@@ -678,10 +708,9 @@ int ttk::MorseSmaleComplex3D::execute(const triangulationType &triangulation) {
   if(ComputeSaddleConnectors) {
     Timer tmp;
     separatrices1.emplace_back();
-    separatricesGeometry1.emplace_back();
 
     getSaddleConnectors(criticalPoints, separatrices1.back(),
-                        separatricesGeometry1.back(), triangulation);
+                        separatricesGeometry1, triangulation);
 
     this->printMsg("Saddle connectors computed", 1.0, tmp.getElapsedTime(),
                    this->threadNumber_);
@@ -691,8 +720,8 @@ int ttk::MorseSmaleComplex3D::execute(const triangulationType &triangulation) {
      || ComputeSaddleConnectors) {
     Timer tmp{};
 
-    flattenSeparatricesVectors(separatrices1, separatricesGeometry1);
-    setSeparatrices1(separatrices1[0], separatricesGeometry1[0], triangulation);
+    flattenSeparatricesVectors(separatrices1);
+    setSeparatrices1(separatrices1[0], separatricesGeometry1, triangulation);
 
     this->printMsg(
       "1-separatrices set", 1.0, tmp.getElapsedTime(), this->threadNumber_);
@@ -702,8 +731,8 @@ int ttk::MorseSmaleComplex3D::execute(const triangulationType &triangulation) {
   if(ComputeDescendingSeparatrices2) {
     Timer tmp;
     std::vector<Separatrix> separatrices;
-    std::vector<std::vector<dcg::Cell>> separatricesGeometry;
-    std::vector<std::set<SimplexId>> separatricesSaddles;
+    SeparatricesGeometry separatricesGeometry{};
+    std::vector<std::vector<SimplexId>> separatricesSaddles;
     getDescendingSeparatrices2(criticalPoints, separatrices,
                                separatricesGeometry, separatricesSaddles,
                                triangulation);
@@ -717,8 +746,8 @@ int ttk::MorseSmaleComplex3D::execute(const triangulationType &triangulation) {
   if(ComputeAscendingSeparatrices2) {
     Timer tmp;
     std::vector<Separatrix> separatrices;
-    std::vector<std::vector<dcg::Cell>> separatricesGeometry;
-    std::vector<std::set<SimplexId>> separatricesSaddles;
+    SeparatricesGeometry separatricesGeometry{};
+    std::vector<std::vector<SimplexId>> separatricesSaddles;
     getAscendingSeparatrices2(criticalPoints, separatrices,
                               separatricesGeometry, separatricesSaddles,
                               triangulation);
@@ -783,7 +812,7 @@ template <typename triangulationType>
 int ttk::MorseSmaleComplex3D::getAscendingSeparatrices1(
   const std::vector<Cell> &criticalPoints,
   std::vector<Separatrix> &separatrices,
-  std::vector<std::vector<Cell>> &separatricesGeometry,
+  SeparatricesGeometry &separatricesGeometry,
   const triangulationType &triangulation) const {
 
   std::vector<SimplexId> saddleIndexes;
@@ -800,7 +829,11 @@ int ttk::MorseSmaleComplex3D::getAscendingSeparatrices1(
   // numberOfAscendingPaths=2, numberOfDescendingPaths=2
   const SimplexId numberOfSeparatrices = 4 * numberOfSaddles;
   separatrices.resize(numberOfSeparatrices);
-  separatricesGeometry.resize(numberOfSeparatrices);
+
+  // vpaths traced in per-thread arenas
+  std::vector<std::vector<Cell>> arenas(this->threadNumber_);
+  std::vector<SeparatricesGeometry::ArenaRange> ranges(numberOfSeparatrices);
+  const SimplexId firstGeometry = separatricesGeometry.size();
 
   // apriori: by default construction, the separatrices are not valid
 #ifdef TTK_ENABLE_OPENMP
@@ -810,6 +843,13 @@ int ttk::MorseSmaleComplex3D::getAscendingSeparatrices1(
     const SimplexId saddleIndex = saddleIndexes[i];
     const Cell &saddle = criticalPoints[saddleIndex];
 
+#ifdef TTK_ENABLE_OPENMP
+    const int tid = omp_get_thread_num();
+#else
+    const int tid = 0;
+#endif // TTK_ENABLE_OPENMP
+    auto &vpaths = arenas[tid];
+
     // add ascending vpaths
     {
       const Cell &saddle2 = saddle;
@@ -822,23 +862,27 @@ int ttk::MorseSmaleComplex3D::getAscendingSeparatrices1(
         SimplexId tetraId;
         triangulation.getTriangleStar(saddle2.id_, j, tetraId);
 
-        std::vector<Cell> vpath;
-        vpath.push_back(saddle2);
+        const size_t begin = vpaths.size();
+        vpaths.push_back(saddle2);
         discreteGradient_.getAscendingPath(
-          Cell(3, tetraId), vpath, triangulation);
+          Cell(3, tetraId), vpaths, triangulation);
 
-        const Cell &lastCell = vpath.back();
+        const Cell lastCell = vpaths.back();
         if(lastCell.dim_ == 3 and discreteGradient_.isCellCritical(lastCell)) {
           const SimplexId separatrixIndex = 4 * i + shift;
 
-          separatricesGeometry[separatrixIndex] = std::move(vpath);
-          separatrices[separatrixIndex]
-            = Separatrix(true, saddle, lastCell, false, separatrixIndex);
+          ranges[separatrixIndex] = {tid, begin, vpaths.size()};
+          separatrices[separatrixIndex] = Separatrix(
+            true, saddle, lastCell, firstGeometry + separatrixIndex);
+        } else {
+          vpaths.resize(begin);
         }
       }
     }
   }
 
+  separatricesGeometry.gather(arenas, ranges, this->threadNumber_);
+
   return 0;
 }
 
@@ -846,7 +890,7 @@ template <typename triangulationType>
 int ttk::MorseSmaleComplex3D::getSaddleConnectors(
   const std::vector<Cell> &criticalPoints,
   std::vector<Separatrix> &separatrices,
-  std::vector<std::vector<Cell>> &separatricesGeometry,
+  SeparatricesGeometry &separatricesGeometry,
   const triangulationType &triangulation) const {
 
   const auto nTriangles = triangulation.getNumberOfTriangles();
@@ -866,11 +910,13 @@ int ttk::MorseSmaleComplex3D::getSaddleConnectors(
                std::back_inserter(saddles2),
                [](const Cell &c) -> bool { return c.dim_ == 2; });
 
-  using Vpath = std::vector<Cell>;
   using SepSads = std::pair<Cell, Cell>;
+  using ArenaRange = SeparatricesGeometry::ArenaRange;
 
   std::vector<std::vector<SepSads>> sepsByThread(saddles2.size());
-  std::vector<std::vector<Vpath>> sepsGeomByThread(saddles2.size());
+  std::vector<std::vector<ArenaRange>> sepsGeomByThread(saddles2.size());
+  // vpaths traced in per-thread arenas
+  std::vector<std::vector<Cell>> arenas(this->threadNumber_);
 
 #ifdef TTK_ENABLE_OPENMP
 #pragma omp parallel for num_threads(threadNumber_) schedule(dynamic)
@@ -889,18 +935,22 @@ int ttk::MorseSmaleComplex3D::getSaddleConnectors(
     discreteGradient_.getDescendingWall(
       s2, mask, triangulation, nullptr, &saddles1);
 
+    auto &vpaths = arenas[tid];
     for(const auto saddle1Id : saddles1) {
       const Cell s1{1, saddle1Id};
 
-      Vpath vpath;
+      const size_t begin = vpaths.size();
       const bool isMultiConnected
         = discreteGradient_.getAscendingPathThroughWall(
-          s1, s2, isVisited[tid], &vpath, triangulation);
-      const auto &last = vpath.back();
+          s1, s2, isVisited[tid], &vpaths, triangulation);
+      const auto last = vpaths.size() > begin ? vpaths.back() : Cell{};
 
       if(!isMultiConnected && last.dim_ == s2.dim_ && last.id_ == s2.id_) {
-        sepsGeomByThread[i].emplace_back(std::move(vpath));
+        sepsGeomByThread[i].emplace_back(
+          ArenaRange{static_cast<int>(tid), begin, vpaths.size()});
         sepsByThread[i].emplace_back(s1, s2);
+      } else {
+        vpaths.resize(begin);
       }
     }
   }
@@ -914,7 +964,8 @@ int ttk::MorseSmaleComplex3D::getSaddleConnectors(
 
   // pre-allocate output vectors
   separatrices.resize(partialSepsId.back());
-  separatricesGeometry.resize(partialSepsId.back());
+  std::vector<ArenaRange> ranges(partialSepsId.back());
+  const size_t firstGeometry = separatricesGeometry.size();
 
 #ifdef TTK_ENABLE_OPENMP
 #pragma omp parallel for num_threads(threadNumber_)
@@ -923,12 +974,14 @@ int ttk::MorseSmaleComplex3D::getSaddleConnectors(
     for(size_t j = 0; j < sepsByThread[i].size(); ++j) {
       const auto &sads = sepsByThread[i][j];
       const size_t k = partialSepsId[i] + j;
-      separatrices[k] = Separatrix{
-        true, sads.first, sads.second, false, static_cast<SimplexId>(k)};
-      separatricesGeometry[k] = std::move(sepsGeomByThread[i][j]);
+      separatrices[k] = Separatrix{true, sads.first, sads.second,
+                                   static_cast<SimplexId>(firstGeometry + k)};
+      ranges[k] = sepsGeomByThread[i][j];
     }
   }
 
+  separatricesGeometry.gather(arenas, ranges, this->threadNumber_);
+
   return 0;
 }
 
@@ -936,8 +989,8 @@ template <typename triangulationType>
 int ttk::MorseSmaleComplex3D::getAscendingSeparatrices2(
   const std::vector<Cell> &criticalPoints,
   std::vector<Separatrix> &separatrices,
-  std::vector<std::vector<Cell>> &separatricesGeometry,
-  std::vector<std::set<SimplexId>> &separatricesSaddles,
+  SeparatricesGeometry &separatricesGeometry,
+  std::vector<std::vector<SimplexId>> &separatricesSaddles,
   const triangulationType &triangulation) const {
   const Cell emptyCell;
 
@@ -955,9 +1008,14 @@ int ttk::MorseSmaleComplex3D::getAscendingSeparatrices2(
   // numberOfSaddles
   const SimplexId numberOfSeparatrices = numberOfSaddles;
   separatrices.resize(numberOfSeparatrices);
-  separatricesGeometry.resize(numberOfSeparatrices);
   separatricesSaddles.resize(numberOfSeparatrices);
 
+  using ArenaRange = SeparatricesGeometry::ArenaRange;
+  // walls traced in per-thread arenas
+  std::vector<std::vector<Cell>> arenas(this->threadNumber_);
+  std::vector<ArenaRange> ranges(numberOfSeparatrices);
+  const SimplexId firstGeometry = separatricesGeometry.size();
+
   const SimplexId numberOfEdges = triangulation.getNumberOfEdges();
   std::vector<std::vector<bool>> isVisited(this->threadNumber_);
   for(auto &vec : isVisited) {
@@ -979,15 +1037,18 @@ int ttk::MorseSmaleComplex3D::getAscendingSeparatrices2(
     const size_t tid = 0;
 #endif // TTK_ENABLE_OPENMP
 
-    std::vector<Cell> wall;
+    auto &walls = arenas[tid];
+    const size_t begin = walls.size();
     dcg::VisitedMask mask{isVisited[tid], visitedEdges[tid]};
     discreteGradient_.getAscendingWall(
-      saddle1, mask, triangulation, &wall, &separatricesSaddles[i]);
+      saddle1, mask, triangulation, &walls, &separatricesSaddles[i]);
 
-    separatricesGeometry[i] = std::move(wall);
-    separatrices[i] = Separatrix(true, saddle1, emptyCell, false, i);
+    ranges[i] = {static_cast<int>(tid), begin, walls.size()};
+    separatrices[i] = Separatrix(true, saddle1, emptyCell, firstGeometry + i);
   }
 
+  separatricesGeometry.gather(arenas, ranges, this->threadNumber_);
+
   return 0;
 }
 
@@ -995,8 +1056,8 @@ template <typename triangulationType>
 int ttk::MorseSmaleComplex3D::getDescendingSeparatrices2(
   const std::vector<Cell> &criticalPoints,
   std::vector<Separatrix> &separatrices,
-  std::vector<std::vector<Cell>> &separatricesGeometry,
-  std::vector<std::set<SimplexId>> &separatricesSaddles,
+  SeparatricesGeometry &separatricesGeometry,
+  std::vector<std::vector<SimplexId>> &separatricesSaddles,
   const triangulationType &triangulation) const {
   const Cell emptyCell;
 
@@ -1014,9 +1075,14 @@ int ttk::MorseSmaleComplex3D::getDescendingSeparatrices2(
   // numberOfSaddles
   const SimplexId numberOfSeparatrices = numberOfSaddles;
   separatrices.resize(numberOfSeparatrices);
-  separatricesGeometry.resize(numberOfSeparatrices);
   separatricesSaddles.resize(numberOfSeparatrices);
 
+  using ArenaRange = SeparatricesGeometry::ArenaRange;
+  // walls traced in per-thread arenas
+  std::vector<std::vector<Cell>> arenas(this->threadNumber_);
+  std::vector<ArenaRange> ranges(numberOfSeparatrices);
+  const SimplexId firstGeometry = separatricesGeometry.size();
+
   const SimplexId numberOfTriangles = triangulation.getNumberOfTriangles();
   std::vector<std::vector<bool>> isVisited(this->threadNumber_);
   for(auto &vec : isVisited) {
@@ -1038,15 +1104,18 @@ int ttk::MorseSmaleComplex3D::getDescendingSeparatrices2(
     const size_t tid = 0;
 #endif // TTK_ENABLE_OPENMP
 
-    std::vector<Cell> wall;
+    auto &walls = arenas[tid];
+    const size_t begin = walls.size();
     dcg::VisitedMask mask{isVisited[tid], visitedTriangles[tid]};
     discreteGradient_.getDescendingWall(
-      saddle2, mask, triangulation, &wall, &separatricesSaddles[i]);
+      saddle2, mask, triangulation, &walls, &separatricesSaddles[i]);
 
-    separatricesGeometry[i] = std::move(wall);
-    separatrices[i] = Separatrix(true, saddle2, emptyCell, false, i);
+    ranges[i] = {static_cast<int>(tid), begin, walls.size()};
+    separatrices[i] = Separatrix(true, saddle2, emptyCell, firstGeometry + i);
   }
 
+  separatricesGeometry.gather(arenas, ranges, this->threadNumber_);
+
   return 0;
 }
 
@@ -11,7 +11,9 @@
 /// whose persistence is higher than a threshold).
 ///
 /// These curves provide useful visual clues in order to fine-tune persistence
-/// simplification thresholds.
+/// simplification thresholds. When only the significant part of the curves is
+/// needed, a minimum persistence can be set: the pairs below this threshold
+/// are discarded as soon as they are detected.
 ///
 /// \sa ttkPersistenceCurve.cpp %for a usage example.
 
@@ -37,6 +39,14 @@ namespace ttk {
       ComputeSaddleConnectors = state;
     }
 
+    /**
+     * The curves are only computed above @p minimumPersistence (disabled
+     * with a null threshold).
+     */
+    inline void setMinimumPersistence(const double minimumPersistence) {
+      MinimumPersistence = minimumPersistence;
+    }
+
     template <typename scalarType>
     int computePersistencePlot(
       const std::vector<std::tuple<SimplexId, SimplexId, scalarType>> &pairs,
@@ -89,6 +99,7 @@ namespace ttk {
     void *CTPlot_{};
     void *MSCPlot_{};
     bool ComputeSaddleConnectors{false};
+    double MinimumPersistence{0.0};
     ftm::FTMTreePP contourTree_{};
     dcg::DiscreteGradient dcg_{};
   };
@@ -139,8 +150,10 @@ int ttk::PersistenceCurve::execute(const scalarType *inputScalars,
   // get persistence pairs
   std::vector<std::tuple<SimplexId, SimplexId, scalarType>> JTPairs;
   std::vector<std::tuple<SimplexId, SimplexId, scalarType>> STPairs;
-  contourTree_.computePersistencePairs<scalarType>(JTPairs, true);
-  contourTree_.computePersistencePairs<scalarType>(STPairs, false);
+  contourTree_.computePersistencePairs<scalarType>(
+    JTPairs, true, MinimumPersistence);
+  contourTree_.computePersistencePairs<scalarType>(
+    STPairs, false, MinimumPersistence);
 
   // merge pairs
   std::vector<std::tuple<SimplexId, SimplexId, scalarType>> CTPairs(
@@ -163,7 +176,7 @@ int ttk::PersistenceCurve::execute(const scalarType *inputScalars,
     dcg_.setInputScalarField(inputScalars);
     dcg_.setInputOffsets(inputOffsets);
     dcg_.computeSaddleSaddlePersistencePairs<scalarType>(
-      pl_saddleSaddlePairs, *triangulation);
+      pl_saddleSaddlePairs, *triangulation, MinimumPersistence);
 
     // sort the saddle-saddle pairs by persistence value and compute curve
     {
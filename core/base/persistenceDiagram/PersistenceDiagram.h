@@ -25,7 +25,7 @@
 /// Herbert Edelsbrunner and John Harer \n
 /// American Mathematical Society, 2010
 ///
-///  Two backends can be chosen for the computation:
+///  Three backends can be chosen for the computation:
 ///
 ///  1) FTM
 /// \b Related \b publication \n
@@ -39,12 +39,21 @@
 /// Jules Vidal, Pierre Guillou, Julien Tierny\n
 /// IEEE Transactions on Visualization and Computer Graphics, 2021
 ///
+///  3) Discrete Morse Sandwich (persistence pairs of all dimensions,
+///  including the saddle-saddle pairs in 3D)
+/// \b Related \b publication \n
+/// "Discrete Morse Sandwich: Fast Computation of Persistence Diagrams for
+/// Scalar Data -- An Algorithm and A Benchmark" \n
+/// Pierre Guillou, Jules Vidal, Julien Tierny \n
+/// IEEE Transactions on Visualization and Computer Graphics, 2023
+///
 /// \sa ttkPersistenceDiagram.cpp %for a usage example.
 
 #pragma once
 
 // base code includes
 #include <DiscreteGradient.h>
+#include <DiscreteMorseSandwich.h>
 #include <FTMTreePP.h>
 #include <ProgressiveTopology.h>
 #include <Triangulation.h>
@@ -87,7 +96,11 @@ namespace ttk {
   class PersistenceDiagram : virtual public Debug {
 
   public:
-    enum class BACKEND { FTM = 0, PROGRESSIVE_TOPOLOGY = 1 };
+    enum class BACKEND {
+      FTM = 0,
+      PROGRESSIVE_TOPOLOGY = 1,
+      DISCRETE_MORSE_SANDWICH = 2
+    };
 
     PersistenceDiagram();
 
@@ -95,6 +108,19 @@ namespace ttk {
       ComputeSaddleConnectors = state;
     }
 
+    inline void setBackEnd(const BACKEND be) {
+      BackEnd = be;
+    }
+
+    /**
+     * Discard the pairs of persistence lower than @p minimumPersistence
+     * as soon as they are detected (the pair of the global extrema is
+     * always kept). Disabled with a null threshold.
+     */
+    inline void setMinimumPersistence(const double minimumPersistence) {
+      MinimumPersistence = minimumPersistence;
+    }
+
     ttk::CriticalType getNodeType(ftm::FTMTree_MT *tree,
                                   ftm::TreeType treeType,
                                   const SimplexId vertexId) const;
@@ -136,6 +162,12 @@ namespace ttk {
                                    const SimplexId *inputOffsets,
                                    const triangulationType *triangulation);
 
+    template <typename scalarType, class triangulationType>
+    int executeDiscreteMorseSandwich(std::vector<PersistencePair> &CTDiagram,
+                                     const scalarType *inputScalars,
+                                     const SimplexId *inputOffsets,
+                                     const triangulationType *triangulation);
+
     template <class triangulationType>
     void checkProgressivityRequirement(const triangulationType *triangulation);
 
@@ -151,11 +183,18 @@ namespace ttk {
           dcg_.setThreadNumber(threadNumber_);
           dcg_.preconditionTriangulation(triangulation);
         }
+        if(this->BackEnd == BACKEND::DISCRETE_MORSE_SANDWICH
+           && triangulation->getDimensionality() > 1) {
+          dms_.setDebugLevel(debugLevel_);
+          dms_.setThreadNumber(threadNumber_);
+          dms_.preconditionTriangulation(triangulation);
+        }
       }
     }
 
   protected:
     bool ComputeSaddleConnectors{false};
+    double MinimumPersistence{0.0};
     ftm::FTMTreePP contourTree_{};
     dcg::DiscreteGradient dcg_{};
 
@@ -163,6 +202,8 @@ namespace ttk {
     BACKEND BackEnd{BACKEND::FTM};
     // progressivity
     ttk::ProgressiveTopology progT_{};
+    // discrete Morse sandwich
+    ttk::DiscreteMorseSandwich dms_{};
 
     int StartingResolutionLevel{0};
     int StoppingResolutionLevel{-1};
@@ -230,6 +271,11 @@ int ttk::PersistenceDiagram::execute(std::vector<PersistencePair> &CTDiagram,
       executeFTM(CTDiagram, inputScalars, inputOffsets, triangulation);
       break;
 
+    case BACKEND::DISCRETE_MORSE_SANDWICH:
+      executeDiscreteMorseSandwich(
+        CTDiagram, inputScalars, inputOffsets, triangulation);
+      break;
+
     default:
       printErr("No method was selected");
   }
@@ -264,6 +310,10 @@ int ttk::PersistenceDiagram::executeProgressiveTopology(
 
   // create the final diagram
   for(const auto &p : resultDiagram) {
+    if(p.pairType != -1
+       && inputScalars[p.death] - inputScalars[p.birth] < MinimumPersistence) {
+      continue;
+    }
     if(p.pairType == 0) {
       CTDiagram.emplace_back(
         p.birth, CriticalType::Local_minimum, p.death, CriticalType::Saddle1,
@@ -283,6 +333,73 @@ int ttk::PersistenceDiagram::executeProgressiveTopology(
   return 0;
 }
 
+template <typename scalarType, class triangulationType>
+int ttk::PersistenceDiagram::executeDiscreteMorseSandwich(
+  std::vector<PersistencePair> &CTDiagram,
+  const scalarType *inputScalars,
+  const SimplexId *inputOffsets,
+  const triangulationType *triangulation) {
+
+  if(triangulation->getDimensionality() < 2) {
+    printWrn("1D triangulation detected.");
+    printWrn("Defaulting to the FTM backend.");
+    return executeFTM(CTDiagram, inputScalars, inputOffsets, triangulation);
+  }
+
+  dms_.setDebugLevel(debugLevel_);
+  dms_.setThreadNumber(threadNumber_);
+
+  std::vector<DiscreteMorseSandwich::PersistencePair> dmsPairs{};
+  if(dms_.computePersistencePairs(dmsPairs, inputOffsets, *triangulation,
+                                  inputScalars, MinimumPersistence)
+     != 0) {
+    return -1;
+  }
+
+  const int dim = triangulation->getDimensionality();
+  const SimplexId nVerts = triangulation->getNumberOfVertices();
+  const SimplexId globalMax
+    = std::max_element(inputOffsets, inputOffsets + nVerts) - inputOffsets;
+
+  // create the final diagram (pairs inside a lower star are dropped)
+  for(const auto &p : dmsPairs) {
+    const auto birth
+      = dms_.getCellGreaterVertex(dcg::Cell{p.type, p.birth}, *triangulation);
+
+    if(p.death == -1) {
+      if(p.type == 0) {
+        // the global minimum is paired with the global maximum
+        CTDiagram.emplace_back(
+          birth, CriticalType::Local_minimum, globalMax,
+          CriticalType::Local_maximum,
+          inputScalars[globalMax] - inputScalars[birth], 0);
+      }
+      continue;
+    }
+
+    const auto death = dms_.getCellGreaterVertex(
+      dcg::Cell{p.type + 1, p.death}, *triangulation);
+    if(birth == death) {
+      continue;
+    }
+    const double persistence = inputScalars[death] - inputScalars[birth];
+
+    if(p.type == 0) {
+      CTDiagram.emplace_back(birth, CriticalType::Local_minimum, death,
+                             CriticalType::Saddle1, persistence, 0);
+    } else if(p.type == dim - 1) {
+      CTDiagram.emplace_back(
+        birth, dim == 3 ? CriticalType::Saddle2 : CriticalType::Saddle1, death,
+        CriticalType::Local_maximum, persistence, 2);
+    } else {
+      CTDiagram.emplace_back(birth, CriticalType::Saddle1, death,
+                             CriticalType::Saddle2, persistence, 1);
+    }
+  }
+
+  return 0;
+}
+
 template <typename scalarType, class triangulationType>
 int ttk::PersistenceDiagram::executeFTM(
   std::vector<PersistencePair> &CTDiagram,
@@ -299,8 +416,10 @@ int ttk::PersistenceDiagram::executeFTM(
   // get persistence pairs
   std::vector<std::tuple<ttk::SimplexId, ttk::SimplexId, scalarType>> JTPairs;
   std::vector<std::tuple<ttk::SimplexId, ttk::SimplexId, scalarType>> STPairs;
-  contourTree_.computePersistencePairs<scalarType>(JTPairs, true);
-  contourTree_.computePersistencePairs<scalarType>(STPairs, false);
+  contourTree_.computePersistencePairs<scalarType>(
+    JTPairs, true, MinimumPersistence);
+  contourTree_.computePersistencePairs<scalarType>(
+    STPairs, false, MinimumPersistence);
 
   // merge pairs
   const auto JTSize = JTPairs.size();
@@ -342,7 +461,7 @@ int ttk::PersistenceDiagram::executeFTM(
     dcg_.setInputScalarField(inputScalars);
     dcg_.setInputOffsets(inputOffsets);
     dcg_.computeSaddleSaddlePersistencePairs<scalarType>(
-      pl_saddleSaddlePairs, *triangulation);
+      pl_saddleSaddlePairs, *triangulation, MinimumPersistence);
 
     // add saddle-saddle pairs to the diagram
     for(const auto &i : pl_saddleSaddlePairs) {
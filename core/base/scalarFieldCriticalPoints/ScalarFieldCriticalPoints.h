@@ -30,7 +30,9 @@
 #include <map>
 
 // base code includes
+#include <OrderDisambiguation.h>
 #include <ProgressiveTopology.h>
+#include <SlabStreamer.h>
 #include <Triangulation.h>
 #include <UnionFind.h>
 
@@ -67,6 +69,20 @@ namespace ttk {
     int executeProgressive(const SimplexId *const offsets,
                            const triangulationType *triangulation);
 
+    /**
+     * Execute the package on a regular grid that does not fit in memory.
+     *
+     * The grid is read slab by slab from the raw file of @p streamer
+     * (with one ghost layer, to cover the vertex links), within its memory
+     * budget. The output critical points are identical to the in-core
+     * ones, with global vertex identifiers.
+     * \param streamer Slab streamer of the input raw file (of @p dataType
+     * values).
+     * \return Returns 0 upon success, negative values otherwise.
+     */
+    template <typename dataType>
+    int executeOutOfCore(SlabStreamer &streamer);
+
     template <class triangulationType>
     void checkProgressivityRequirement(const triangulationType *triangulation);
 
@@ -190,6 +206,76 @@ int ttk::ScalarFieldCriticalPoints::executeProgressive(
   return 0;
 }
 
+template <typename dataType>
+int ttk::ScalarFieldCriticalPoints::executeOutOfCore(SlabStreamer &streamer) {
+
+#ifndef TTK_ENABLE_KAMIKAZE
+  if(!criticalPoints_)
+    return -5;
+#endif
+
+  printMsg("Extracting critical points (out-of-core)...");
+
+  Timer t;
+
+  // one ghost layer covers the vertex links; per vertex, the vertex
+  // order, its sorting buffer and the vertex type are stored
+  streamer.setGhostLayers(1);
+  streamer.setBytesPerVertex(2 * sizeof(SimplexId) + sizeof(char));
+
+  criticalPoints_->clear();
+
+  std::vector<SimplexId> order{};
+  std::vector<char> vertexTypes{};
+  const SimplexId slabNumber = streamer.getNumberOfSlabs();
+
+  for(SimplexId i = 0; i < slabNumber; i++) {
+    if(streamer.loadSlab(i) != 0) {
+      return -1;
+    }
+    auto triangulation = streamer.getSlabTriangulation();
+    preconditionTriangulation(triangulation);
+
+    // ties are broken by vertex identifiers, which have the same relative
+    // order in the slab and in the full grid
+    const auto data = static_cast<const dataType *>(streamer.getSlabData());
+    order.resize(vertexNumber_);
+    ttk::preconditionOrderArray(
+      vertexNumber_, data, order.data(), threadNumber_);
+
+    SimplexId begin{}, end{};
+    streamer.getOwnedVertices(begin, end);
+    vertexTypes.resize(end - begin);
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif
+    for(SimplexId j = begin; j < end; j++) {
+      vertexTypes[j - begin] = getCriticalType(j, order.data(), triangulation);
+    }
+
+    const SimplexId offset = streamer.getSlabVertexOffset();
+    for(SimplexId j = begin; j < end; j++) {
+      if(vertexTypes[j - begin] != (char)(CriticalType::Regular)) {
+        criticalPoints_->emplace_back(j + offset, vertexTypes[j - begin]);
+      }
+    }
+
+    printMsg("Processed slab " + std::to_string(i + 1) + "/"
+               + std::to_string(slabNumber),
+             (float)(i + 1) / slabNumber, t.getElapsedTime(), threadNumber_,
+             debug::LineMode::REPLACE);
+  }
+
+  displayStats();
+
+  printMsg("Processed " + std::to_string(streamer.getNumberOfVertices())
+             + " vertices in " + std::to_string(slabNumber) + " slabs",
+           1, t.getElapsedTime(), threadNumber_);
+
+  return 0;
+}
+
 template <class triangulationType>
 int ttk::ScalarFieldCriticalPoints::executeLegacy(
   const SimplexId *const offsets, const triangulationType *triangulation) {
@@ -218,12 +304,15 @@ int ttk::ScalarFieldCriticalPoints::executeLegacy(
   std::vector<char> vertexTypes(vertexNumber_);
 
   if(triangulation) {
+    // cache-friendly traversal (bricks on regular grids)
+    const auto blocks = triangulation->getVertexBlocks();
 #ifdef TTK_ENABLE_OPENMP
 #pragma omp parallel for num_threads(threadNumber_)
 #endif
-    for(SimplexId i = 0; i < (SimplexId)vertexNumber_; i++) {
-
-      vertexTypes[i] = getCriticalType(i, offsets, triangulation);
+    for(SimplexId block = 0; block < blocks.size(); block++) {
+      blocks.forEach(block, [&](const SimplexId i) {
+        vertexTypes[i] = getCriticalType(i, offsets, triangulation);
+      });
     }
   } else if(vertexLinkEdgeLists_) {
     // legacy implementation
@@ -1,5 +1,7 @@
 #include <OneSkeleton.h>
-#include <boost/container/small_vector.hpp>
+
+#include <algorithm>
+#include <bitset>
 
 using namespace std;
 using namespace ttk;
@@ -55,7 +57,7 @@ int OneSkeleton::buildEdgeLinks(
   // don't forget the last offset
   offsets[edgeNumber] = edgeStars.offset(edgeNumber);
 
-  edgeLinks.setData(std::move(links), std::move(offsets));
+  edgeLinks.setData(std::move(links), std::move(offsets), threadNumber_);
 
   printMsg("Built " + to_string(edgeNumber) + " edge links", 1,
            t.getElapsedTime(), threadNumber_);
@@ -118,7 +120,7 @@ int OneSkeleton::buildEdgeLinks(
   // don't forget the last offset
   offsets[edgeNumber] = edgeStars.offset(edgeNumber);
 
-  edgeLinks.setData(std::move(links), std::move(offsets));
+  edgeLinks.setData(std::move(links), std::move(offsets), threadNumber_);
 
   printMsg("Built " + to_string(edgeNumber) + " edge links", 1,
            t.getElapsedTime(), threadNumber_);
@@ -132,7 +134,8 @@ int OneSkeleton::buildEdgeList(
   const CellArray &cellArray,
   vector<std::array<SimplexId, 2>> *edgeList,
   FlatJaggedArray *edgeStars,
-  std::vector<std::array<SimplexId, n>> *cellEdgeList) const {
+  std::vector<std::array<SimplexId, n>> *cellEdgeList,
+  const FlatJaggedArray *vertexStars) const {
 
   Timer t;
 
@@ -145,8 +148,15 @@ int OneSkeleton::buildEdgeList(
                    + "), unable to compute cellEdgeList");
     return -1;
   }
+#ifndef TTK_ENABLE_KAMIKAZE
+  if(dim > 3) {
+    this->printErr("Unsupported cell dimension " + std::to_string(dim));
+    return -2;
+  }
+#endif // TTK_ENABLE_KAMIKAZE
 
-  printMsg("Building edges", 0, 0, 1, ttk::debug::LineMode::REPLACE);
+  printMsg(
+    "Building edges", 0, 0, threadNumber_, ttk::debug::LineMode::REPLACE);
 
   const SimplexId cellNumber = cellArray.getNbCells();
 
@@ -160,6 +170,33 @@ int OneSkeleton::buildEdgeList(
     cellEdgeList->resize(cellNumber);
   }
 
+  // Edge identifiers are attributed in the order of their first
+  // occurrence when scanning the cells (and their local edges) by
+  // increasing identifier. To compute them in parallel while keeping
+  // this (deterministic) numbering, each edge is handled by its lower
+  // vertex, which scans its star in increasing cell order. A first pass
+  // flags the first occurrence of each edge, a prefix sum over the cells
+  // gives the edge identifiers and a second pass writes the outputs.
+
+  // sorted cell identifiers around each vertex (reuse the
+  // preconditioned ones when available)
+  FlatJaggedArray localVertexStars{};
+  if(vertexStars == nullptr
+     || vertexStars->subvectorsNumber() != (size_t)vertexNumber) {
+    ZeroSkeleton zeroSkeleton{};
+    zeroSkeleton.setDebugLevel(debugLevel_);
+    zeroSkeleton.setThreadNumber(threadNumber_);
+    zeroSkeleton.buildVertexStars(vertexNumber, cellArray, localVertexStars);
+    vertexStars = &localVertexStars;
+  }
+  const auto &stars = *vertexStars;
+
+  // per cell, bitmask of the local edges that are the first occurrence
+  // of an edge (simplicial cells have at most 6 edges)
+  std::vector<unsigned char> firstEdges(cellNumber, 0);
+  // per cell, number of new edges in the previous cells
+  std::vector<SimplexId> cellFirstEdge(cellNumber + 1);
+
   struct EdgeData {
     // the id of the edge higher vertex
     SimplexId highVert{};
@@ -169,73 +206,124 @@ int OneSkeleton::buildEdgeList(
     }
   };
 
-  using boost::container::small_vector;
-  // for each vertex, a vector of EdgeData
-  std::vector<small_vector<EdgeData, 8>> edgeTable(vertexNumber);
-
-  const int timeBuckets = std::min<ttk::SimplexId>(10, cellNumber);
-  SimplexId edgeCount{};
-
-  for(SimplexId cid = 0; cid < cellNumber; cid++) {
-
-    const SimplexId nbVertsInCell = cellArray.getCellVertexNumber(cid);
-    // id of edge in cell
-    SimplexId ecid{};
-
-    // tet case: {0-1}, {0-2}, {0-3}, {1-2}, {1-3}, {2-3}
-    for(SimplexId j = 0; j <= nbVertsInCell - 2; j++) {
-      for(SimplexId k = j + 1; k <= nbVertsInCell - 1; k++) {
-        // edge processing
-        SimplexId v0 = cellArray.getCellVertex(cid, j);
-        SimplexId v1 = cellArray.getCellVertex(cid, k);
-        if(v0 > v1) {
-          std::swap(v0, v1);
-        }
-        auto &vec = edgeTable[v0];
-        const auto pos
-          = std::find_if(vec.begin(), vec.end(),
-                         [&](const EdgeData &a) { return a.highVert == v1; });
-        if(pos == vec.end()) {
-          // not found in edgeTable: new edge
-          vec.emplace_back(EdgeData{v1, edgeCount});
-          if(cellEdgeList != nullptr) {
-            (*cellEdgeList)[cid][ecid] = edgeCount;
+  // visit every local edge (v0, v1) of vertex v0 star such as v0 < v1 in
+  // increasing cell id order: the first pass flags the first occurrence
+  // of each edge, the second one fills edgeList and cellEdgeList
+  const auto processVertexStar = [&](const SimplexId v0,
+                                     std::vector<EdgeData> &edgeTable,
+                                     const bool firstPass) {
+    edgeTable.clear();
+    for(SimplexId i = 0; i < stars.size(v0); ++i) {
+      const auto cid = stars.get(v0, i);
+      const SimplexId nbVertsInCell = cellArray.getCellVertexNumber(cid);
+      // id of edge in cell
+      SimplexId ecid{};
+      // tet case: {0-1}, {0-2}, {0-3}, {1-2}, {1-3}, {2-3}
+      for(SimplexId j = 0; j <= nbVertsInCell - 2; j++) {
+        for(SimplexId k = j + 1; k <= nbVertsInCell - 1; k++, ecid++) {
+          SimplexId low = cellArray.getCellVertex(cid, j);
+          SimplexId v1 = cellArray.getCellVertex(cid, k);
+          if(low > v1) {
+            std::swap(low, v1);
+          }
+          if(low != v0) {
+            // edges are handled by their lower vertex
+            continue;
+          }
+          const auto pos
+            = std::find_if(edgeTable.begin(), edgeTable.end(),
+                           [&](const EdgeData &e) { return e.highVert == v1; });
+          if(firstPass) {
+            if(pos == edgeTable.end()) {
+              // not found in edgeTable: new edge
+              edgeTable.emplace_back(v1, -1);
+              // several vertices may set bits in the same cell
+              const auto bit = static_cast<unsigned char>(1 << ecid);
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp atomic update
+#endif // TTK_ENABLE_OPENMP
+              firstEdges[cid] |= bit;
+            }
+            continue;
+          }
+          SimplexId id{};
+          if(pos == edgeTable.end()) {
+            // new edge: its id is given by the number of new edges in the
+            // previous cells and in the previous local edges of this cell
+            id = cellFirstEdge[cid]
+                 + std::bitset<8>(firstEdges[cid] & ((1 << ecid) - 1)).count();
+            edgeTable.emplace_back(v1, id);
+            if(edgeList != nullptr) {
+              (*edgeList)[id] = {v0, v1};
+            }
+          } else {
+            // found an existing edge
+            id = pos->id;
           }
-          edgeCount++;
-        } else {
-          // found an existing edge
           if(cellEdgeList != nullptr) {
-            (*cellEdgeList)[cid][ecid] = pos->id;
+            (*cellEdgeList)[cid][ecid] = id;
           }
         }
-        ecid++;
       }
     }
-    if(debugLevel_ >= (int)(debug::Priority::INFO)) {
-      if(!(cid % ((cellNumber) / timeBuckets)))
-        printMsg("Building edges", (cid / (float)cellNumber),
-                 t.getElapsedTime(), 1, debug::LineMode::REPLACE);
+  };
+
+  // 1. flag the first occurrence of each edge
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel num_threads(threadNumber_)
+#endif // TTK_ENABLE_OPENMP
+  {
+    std::vector<EdgeData> edgeTable{};
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp for schedule(dynamic, 1024)
+#endif // TTK_ENABLE_OPENMP
+    for(SimplexId v0 = 0; v0 < vertexNumber; v0++) {
+      processVertexStar(v0, edgeTable, true);
     }
   }
 
-  // allocate & fill edgeList in parallel
+  printMsg("Building edges", 0.33, t.getElapsedTime(), threadNumber_,
+           debug::LineMode::REPLACE);
+
+  // 2. prefix sum of the number of new edges per cell
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif // TTK_ENABLE_OPENMP
+  for(SimplexId cid = 0; cid < cellNumber; cid++) {
+    cellFirstEdge[cid + 1] = std::bitset<8>(firstEdges[cid]).count();
+  }
+  for(SimplexId cid = 0; cid < cellNumber; cid++) {
+    cellFirstEdge[cid + 1] += cellFirstEdge[cid];
+  }
+  const SimplexId edgeCount = cellFirstEdge[cellNumber];
+
+  printMsg("Building edges", 0.5, t.getElapsedTime(), threadNumber_,
+           debug::LineMode::REPLACE);
+
+  // 3. fill edgeList & cellEdgeList in parallel
 
   if(edgeList != nullptr) {
     edgeList->resize(edgeCount);
   }
 
+  if(edgeList != nullptr || cellEdgeList != nullptr) {
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel num_threads(threadNumber_)
+#endif // TTK_ENABLE_OPENMP
+    {
+      std::vector<EdgeData> edgeTable{};
 #ifdef TTK_ENABLE_OPENMP
-#pragma omp parallel for num_threads(this->threadNumber_)
+#pragma omp for schedule(dynamic, 1024)
 #endif // TTK_ENABLE_OPENMP
-  for(SimplexId i = 0; i < vertexNumber; ++i) {
-    const auto &etable = edgeTable[i];
-    for(const auto &data : etable) {
-      if(edgeList != nullptr) {
-        (*edgeList)[data.id] = {i, data.highVert};
+      for(SimplexId v0 = 0; v0 < vertexNumber; v0++) {
+        processVertexStar(v0, edgeTable, false);
       }
     }
   }
 
+  printMsg("Building edges", 0.75, t.getElapsedTime(), threadNumber_,
+           debug::LineMode::REPLACE);
+
   // return cellEdgeList to get edgeStars
 
   if(cellEdgeList != nullptr && edgeStars != nullptr) {
@@ -244,8 +332,14 @@ int OneSkeleton::buildEdgeList(
     std::vector<SimplexId> starIds(edgeCount);
 
     // store number of cells per edge
-    for(const auto &ce : *cellEdgeList) {
-      for(const auto eid : ce) {
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif // TTK_ENABLE_OPENMP
+    for(SimplexId cid = 0; cid < cellNumber; cid++) {
+      for(const auto eid : (*cellEdgeList)[cid]) {
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp atomic update
+#endif // TTK_ENABLE_OPENMP
         offsets[eid + 1]++;
       }
     }
@@ -259,24 +353,40 @@ int OneSkeleton::buildEdgeList(
     std::vector<SimplexId> edgeSt(offsets.back());
 
     // fill flat neighbors vector using offsets and neighbors count vectors
-    for(size_t i = 0; i < cellEdgeList->size(); ++i) {
-      const auto &ce{(*cellEdgeList)[i]};
-      for(const auto eid : ce) {
-        edgeSt[offsets[eid] + starIds[eid]] = i;
-        starIds[eid]++;
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif // TTK_ENABLE_OPENMP
+    for(SimplexId cid = 0; cid < cellNumber; cid++) {
+      for(const auto eid : (*cellEdgeList)[cid]) {
+        SimplexId pos{};
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp atomic capture
+#endif // TTK_ENABLE_OPENMP
+        pos = starIds[eid]++;
+        edgeSt[offsets[eid] + pos] = cid;
       }
     }
 
+#ifdef TTK_ENABLE_OPENMP
+    if(threadNumber_ > 1) {
+      // keep the sequential (ascending) order of cells in edge stars
+#pragma omp parallel for num_threads(threadNumber_) schedule(dynamic, 1024)
+      for(SimplexId i = 0; i < edgeCount; ++i) {
+        std::sort(&edgeSt[offsets[i]], &edgeSt[offsets[i + 1]]);
+      }
+    }
+#endif // TTK_ENABLE_OPENMP
+
     // fill FlatJaggedArray struct
-    edgeStars->setData(std::move(edgeSt), std::move(offsets));
+    edgeStars->setData(std::move(edgeSt), std::move(offsets), threadNumber_);
   }
 
-  printMsg(
-    "Built " + to_string(edgeCount) + " edges", 1, t.getElapsedTime(), 1);
+  printMsg("Built " + to_string(edgeCount) + " edges", 1, t.getElapsedTime(),
+           threadNumber_);
 
   // ethaneDiolMedium.vtu, 70Mtets, hal9000 (12coresHT)
   // 1 thread: 10.4979 s
-  // 24 threads: 12.3994 s [not efficient in parallel]
+  // 24 threads: 12.3994 s [sequential edge table, before parallel passes]
 
   return 0;
 }
@@ -287,7 +397,8 @@ template int OneSkeleton::buildEdgeList<3>(
   const CellArray &cellArray,
   vector<std::array<SimplexId, 2>> *edgeList,
   FlatJaggedArray *edgeStars,
-  std::vector<std::array<SimplexId, 3>> *cellEdgeList) const;
+  std::vector<std::array<SimplexId, 3>> *cellEdgeList,
+  const FlatJaggedArray *vertexStars) const;
 
 // explicit template instantiation for 3D cells (tetrathedron)
 template int OneSkeleton::buildEdgeList<6>(
@@ -295,4 +406,5 @@ template int OneSkeleton::buildEdgeList<6>(
   const CellArray &cellArray,
   vector<std::array<SimplexId, 2>> *edgeList,
   FlatJaggedArray *edgeStars,
-  std::vector<std::array<SimplexId, 6>> *cellEdgeList) const;
+  std::vector<std::array<SimplexId, 6>> *cellEdgeList,
+  const FlatJaggedArray *vertexStars) const;
@@ -78,6 +78,8 @@ namespace ttk {
     /// each edge, a list of adjacent cells)
     /// \param cellEdgeList Optional output for cell edges: per cell,
     /// the list of its edges identifiers
+    /// \param vertexStars Optional input vertex stars (sorted cell
+    /// identifiers around each vertex), computed on the fly if not given
     /// \return Returns 0 upon success, negative values otherwise.
     template <std::size_t n = 3>
     int buildEdgeList(const SimplexId &vertexNumber,
@@ -85,6 +87,7 @@ namespace ttk {
                       std::vector<std::array<SimplexId, 2>> *edgeList = nullptr,
                       FlatJaggedArray *edgeStars = nullptr,
                       std::vector<std::array<SimplexId, n>> *cellEdgeList
-                      = nullptr) const;
+                      = nullptr,
+                      const FlatJaggedArray *vertexStars = nullptr) const;
   };
 } // namespace ttk
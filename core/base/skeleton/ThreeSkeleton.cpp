@@ -71,7 +71,8 @@ int ThreeSkeleton::buildCellNeighborsFromTriangles(
   }
 
   // fill FlatJaggedArray struct
-  cellNeighbors.setData(std::move(neighbors), std::move(offsets));
+  cellNeighbors.setData(
+    std::move(neighbors), std::move(offsets), threadNumber_);
 
   printMsg("Built " + std::to_string(cellNumber) + " cell neighbors", 1,
            t.getElapsedTime(), 1);
@@ -221,7 +222,7 @@ int ThreeSkeleton::buildCellNeighborsFromVertices(
   }
 
   // convert to a FlatJaggedArray
-  cellNeighbors.fillFrom(neighbors);
+  cellNeighbors.fillFrom(neighbors, threadNumber_);
 
   printMsg("Built " + to_string(cellNumber) + " cell neighbors", 1,
            t.getElapsedTime(), threadNumber_);
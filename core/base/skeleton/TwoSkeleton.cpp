@@ -1,9 +1,33 @@
 #include <TwoSkeleton.h>
 #include <boost/container/small_vector.hpp>
 
+#include <algorithm>
+#include <bitset>
+
 using namespace std;
 using namespace ttk;
 
+namespace {
+  // edges of a triangle, as the pairwise intersections of the (sorted)
+  // edges of its vertices, for both identifier storages of vertexEdges
+  template <typename IdType>
+  void intersectVertexEdges(const FlatJaggedArray &vertexEdges,
+                            const std::array<SimplexId, 3> &triangle,
+                            const IdType *(FlatJaggedArray::*getPtr)(
+                              SimplexId, SimplexId) const,
+                            std::array<SimplexId, 3> &edges) {
+    std::array<const IdType *, 3> beg{}, end{};
+    for(size_t j = 0; j < triangle.size(); ++j) {
+      beg[j] = (vertexEdges.*getPtr)(triangle[j], 0);
+      end[j] = beg[j] + vertexEdges.size(triangle[j]);
+    }
+    std::set_intersection(beg[0], end[0], beg[1], end[1], &edges[0]);
+    std::set_intersection(beg[0], end[0], beg[2], end[2], &edges[1]);
+    std::set_intersection(beg[1], end[1], beg[2], end[2], &edges[2]);
+    std::sort(edges.begin(), edges.end());
+  }
+} // namespace
+
 TwoSkeleton::TwoSkeleton() {
 
   setDebugMsgPrefix("TwoSkeleton");
@@ -71,7 +95,8 @@ int TwoSkeleton::buildCellNeighborsFromEdges(const SimplexId &vertexNumber,
   }
 
   // fill FlatJaggedArray struct
-  cellNeighbors.setData(std::move(neighbors), std::move(offsets));
+  cellNeighbors.setData(
+    std::move(neighbors), std::move(offsets), threadNumber_);
 
   printMsg("Built " + to_string(cellNumber) + " cell neighbors", 1,
            t.getElapsedTime(), 1);
@@ -165,7 +190,7 @@ int TwoSkeleton::buildCellNeighborsFromVertices(
   }
 
   // convert to a FlatJaggedArray
-  cellNeighbors.fillFrom(neighbors);
+  cellNeighbors.fillFrom(neighbors, threadNumber_);
 
   printMsg("Built " + to_string(cellNumber) + " cell neighbors", 1,
            t.getElapsedTime(), threadNumber_);
@@ -249,7 +274,8 @@ int TwoSkeleton::buildEdgeTriangles(
   }
 
   // fill FlatJaggedArray struct
-  edgeTriangleList.setData(std::move(edgeTriangles), std::move(offsets));
+  edgeTriangleList.setData(
+    std::move(edgeTriangles), std::move(offsets), threadNumber_);
 
   printMsg("Built " + to_string(edgeNumber) + " edge triangles", 1,
            t.getElapsedTime(), threadNumber_);
@@ -262,7 +288,8 @@ int TwoSkeleton::buildTriangleList(
   const CellArray &cellArray,
   vector<std::array<SimplexId, 3>> *triangleList,
   FlatJaggedArray *triangleStars,
-  vector<std::array<SimplexId, 4>> *cellTriangleList) const {
+  vector<std::array<SimplexId, 4>> *cellTriangleList,
+  const FlatJaggedArray *vertexStars) const {
 
   Timer t;
 
@@ -298,6 +325,31 @@ int TwoSkeleton::buildTriangleList(
     cellTriangleList->resize(cellNumber, {-1, -1, -1, -1});
   }
 
+  // Triangle identifiers follow the order of their first occurrence
+  // when scanning the cells (and their local faces) by increasing
+  // identifier. As in OneSkeleton::buildEdgeList, triangles are handled
+  // in parallel by their lower vertex, with a prefix sum over the cells
+  // to keep this deterministic numbering.
+
+  // sorted cell identifiers around each vertex (reuse the
+  // preconditioned ones when available)
+  FlatJaggedArray localVertexStars{};
+  if(vertexStars == nullptr
+     || vertexStars->subvectorsNumber() != (size_t)vertexNumber) {
+    ZeroSkeleton zeroSkeleton{};
+    zeroSkeleton.setDebugLevel(debugLevel_);
+    zeroSkeleton.setThreadNumber(threadNumber_);
+    zeroSkeleton.buildVertexStars(vertexNumber, cellArray, localVertexStars);
+    vertexStars = &localVertexStars;
+  }
+  const auto &stars = *vertexStars;
+
+  // per cell, bitmask of the faces that are the first occurrence of a
+  // triangle
+  std::vector<unsigned char> firstTriangles(cellNumber, 0);
+  // per cell, number of new triangles in the previous cells
+  std::vector<SimplexId> cellFirstTriangle(cellNumber + 1);
+
   struct TriangleData {
     // the two higher vertices id of the triangle
     std::array<SimplexId, 2> highVerts{};
@@ -308,73 +360,123 @@ int TwoSkeleton::buildTriangleList(
     }
   };
 
-  using boost::container::small_vector;
-  // for each vertex, a vector of TriangleData
-  std::vector<small_vector<TriangleData, 8>> triangleTable(vertexNumber);
-
-  SimplexId nTriangles{};
-
-  printMsg("Building triangles", 0.25, t.getElapsedTime(), 1,
-           debug::LineMode::REPLACE);
+  // visit every face of vertex v0 star whose lower vertex is v0 in
+  // increasing cell id order: the first pass flags the first occurrence
+  // of each triangle, the second one fills triangleList and
+  // cellTriangleList
+  const auto processVertexStar = [&](const SimplexId v0,
+                                     std::vector<TriangleData> &ttable,
+                                     const bool firstPass) {
+    ttable.clear();
+    for(SimplexId i = 0; i < stars.size(v0); ++i) {
+      const auto cid = stars.get(v0, i);
+      // a tetra cell has 4 faces
+      for(size_t j = 0; j < 4; j++) {
+        std::array<SimplexId, 3> triangle{};
+        for(size_t k = 0; k < 3; k++) {
+          // TODO: ASSUME Regular Mesh Here!
+          triangle[k] = cellArray.getCellVertex(cid, (j + k) % 4);
+        }
+        std::sort(triangle.begin(), triangle.end());
+        if(triangle[0] != v0) {
+          // triangles are handled by their lower vertex
+          continue;
+        }
 
-  for(SimplexId cid = 0; cid < cellNumber; cid++) {
-    // a tetra cell has 4 faces
-    for(size_t j = 0; j < 4; j++) {
-      std::array<SimplexId, 3> triangle{};
-      for(size_t k = 0; k < 3; k++) {
-        // TODO: ASSUME Regular Mesh Here!
-        triangle[k] = cellArray.getCellVertex(cid, (j + k) % 4);
-      }
-      std::sort(triangle.begin(), triangle.end());
-      auto &ttable = triangleTable[triangle[0]];
-
-      // check if current triangle already registered in triangleTable
-      // via another tetra in its star
-      bool found{false};
-      for(auto &d : ttable) {
-        if(d.highVerts[0] == triangle[1] && d.highVerts[1] == triangle[2]) {
-          found = true;
-          if(cellTriangleList != nullptr) {
-            (*cellTriangleList)[cid][j] = d.id;
+        // check if current triangle already registered in ttable
+        // via another tetra in its star
+        const auto pos = std::find_if(
+          ttable.begin(), ttable.end(), [&](const TriangleData &d) {
+            return d.highVerts[0] == triangle[1]
+                   && d.highVerts[1] == triangle[2];
+          });
+        if(firstPass) {
+          if(pos == ttable.end()) {
+            // new triangle
+            ttable.emplace_back(TriangleData{{triangle[1], triangle[2]}, -1});
+            // several vertices may set bits in the same cell
+            const auto bit = static_cast<unsigned char>(1 << j);
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp atomic update
+#endif // TTK_ENABLE_OPENMP
+            firstTriangles[cid] |= bit;
           }
-          break;
+          continue;
+        }
+        SimplexId id{};
+        if(pos == ttable.end()) {
+          // new triangle: its id is given by the number of new triangles
+          // in the previous cells and in the previous faces of this cell
+          id = cellFirstTriangle[cid]
+               + std::bitset<4>(firstTriangles[cid] & ((1 << j) - 1)).count();
+          ttable.emplace_back(TriangleData{{triangle[1], triangle[2]}, id});
+          if(triangleList != nullptr) {
+            (*triangleList)[id] = triangle;
+          }
+        } else {
+          id = pos->id;
         }
-      }
-      if(!found) {
-        // new triangle added
-        ttable.emplace_back(
-          TriangleData{{triangle[1], triangle[2]}, nTriangles});
         if(cellTriangleList != nullptr) {
-          (*cellTriangleList)[cid][j] = nTriangles;
+          (*cellTriangleList)[cid][j] = id;
         }
-        nTriangles++;
       }
     }
+  };
+
+  printMsg("Building triangles", 0.25, t.getElapsedTime(), threadNumber_,
+           debug::LineMode::REPLACE);
+
+  // 1. flag the first occurrence of each triangle
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel num_threads(threadNumber_)
+#endif // TTK_ENABLE_OPENMP
+  {
+    std::vector<TriangleData> ttable{};
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp for schedule(dynamic, 1024)
+#endif // TTK_ENABLE_OPENMP
+    for(SimplexId v0 = 0; v0 < vertexNumber; v0++) {
+      processVertexStar(v0, ttable, true);
+    }
   }
 
-  printMsg(
-    "Building triangles", 0.5, t.getElapsedTime(), 1, debug::LineMode::REPLACE);
+  // 2. prefix sum of the number of new triangles per cell
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif // TTK_ENABLE_OPENMP
+  for(SimplexId cid = 0; cid < cellNumber; cid++) {
+    cellFirstTriangle[cid + 1] = std::bitset<4>(firstTriangles[cid]).count();
+  }
+  for(SimplexId cid = 0; cid < cellNumber; cid++) {
+    cellFirstTriangle[cid + 1] += cellFirstTriangle[cid];
+  }
+  const SimplexId nTriangles = cellFirstTriangle[cellNumber];
+
+  printMsg("Building triangles", 0.5, t.getElapsedTime(), threadNumber_,
+           debug::LineMode::REPLACE);
 
   // resize vectors to the correct size
   if(triangleList) {
     triangleList->resize(nTriangles);
   }
 
-  // fill data buffers in parallel
-
+  // 3. fill data buffers in parallel
+  if(triangleList != nullptr || cellTriangleList != nullptr) {
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel num_threads(threadNumber_)
+#endif // TTK_ENABLE_OPENMP
+    {
+      std::vector<TriangleData> ttable{};
 #ifdef TTK_ENABLE_OPENMP
-#pragma omp parallel for num_threads(this->threadNumber_)
+#pragma omp for schedule(dynamic, 1024)
 #endif // TTK_ENABLE_OPENMP
-  for(SimplexId i = 0; i < vertexNumber; ++i) {
-    const auto &ttable = triangleTable[i];
-    for(const auto &data : ttable) {
-      if(triangleList != nullptr) {
-        (*triangleList)[data.id] = {i, data.highVerts[0], data.highVerts[1]};
+      for(SimplexId v0 = 0; v0 < vertexNumber; v0++) {
+        processVertexStar(v0, ttable, false);
       }
     }
   }
 
-  printMsg("Building triangles", 0.75, t.getElapsedTime(), 1,
+  printMsg("Building triangles", 0.75, t.getElapsedTime(), threadNumber_,
            debug::LineMode::REPLACE);
 
   if(cellTriangleList != nullptr && triangleStars != nullptr) {
@@ -383,11 +485,16 @@ int TwoSkeleton::buildTriangleList(
     std::vector<SimplexId> starIds(nTriangles);
 
     // store number of cells per triangle
-    for(const auto &c : *cellTriangleList) {
-      offsets[c[0] + 1]++;
-      offsets[c[1] + 1]++;
-      offsets[c[2] + 1]++;
-      offsets[c[3] + 1]++;
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif // TTK_ENABLE_OPENMP
+    for(SimplexId cid = 0; cid < cellNumber; cid++) {
+      for(const auto tid : (*cellTriangleList)[cid]) {
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp atomic update
+#endif // TTK_ENABLE_OPENMP
+        offsets[tid + 1]++;
+      }
     }
 
     // compute partial sum of number of cells per triangle
@@ -399,24 +506,38 @@ int TwoSkeleton::buildTriangleList(
     std::vector<SimplexId> triangleSt(offsets.back());
 
     // fill flat neighbors vector using offsets and neighbors count vectors
-    for(size_t i = 0; i < cellTriangleList->size(); ++i) {
-      const auto &ct{(*cellTriangleList)[i]};
-      triangleSt[offsets[ct[0]] + starIds[ct[0]]] = i;
-      starIds[ct[0]]++;
-      triangleSt[offsets[ct[1]] + starIds[ct[1]]] = i;
-      starIds[ct[1]]++;
-      triangleSt[offsets[ct[2]] + starIds[ct[2]]] = i;
-      starIds[ct[2]]++;
-      triangleSt[offsets[ct[3]] + starIds[ct[3]]] = i;
-      starIds[ct[3]]++;
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif // TTK_ENABLE_OPENMP
+    for(SimplexId cid = 0; cid < cellNumber; cid++) {
+      for(const auto tid : (*cellTriangleList)[cid]) {
+        SimplexId pos{};
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp atomic capture
+#endif // TTK_ENABLE_OPENMP
+        pos = starIds[tid]++;
+        triangleSt[offsets[tid] + pos] = cid;
+      }
     }
 
+#ifdef TTK_ENABLE_OPENMP
+    if(threadNumber_ > 1) {
+      // keep the sequential (ascending) order of cells in triangle stars
+#pragma omp parallel for num_threads(threadNumber_) schedule(dynamic, 1024)
+      for(SimplexId i = 0; i < nTriangles; ++i) {
+        std::sort(&triangleSt[offsets[i]], &triangleSt[offsets[i + 1]]);
+      }
+    }
+#endif // TTK_ENABLE_OPENMP
+
     // fill FlatJaggedArray struct
-    triangleStars->setData(std::move(triangleSt), std::move(offsets));
+    triangleStars->setData(
+      std::move(triangleSt), std::move(offsets), threadNumber_);
   }
 
-  printMsg(
-    "Built " + to_string(nTriangles) + " triangles", 1, t.getElapsedTime(), 1);
+  printMsg("Built " + to_string(nTriangles) + " triangles", 1,
+           t.getElapsedTime(), threadNumber_);
+  // [timings below predate the parallel triangle enumeration]
   // ethaneDiolMedium.vtu, 70Mtets, hal9000 (12coresHT)// 1 thread: 58.5631 s//
   // 24 threads: 87.5816 s (~) ethaneDiol.vtu, 8.7Mtets, vger (2coresHT) - no
   // tet adj// 1 thread: 5.7427 s// 4 threads: 9.14764 s (~)
@@ -497,16 +618,14 @@ int TwoSkeleton::buildTriangleEdgeList(
 #endif // TTK_ENABLE_OPENMP
   for(size_t i = 0; i < localTriangleList->size(); i++) {
     const auto &t = (*localTriangleList)[i];
-    const auto beg0 = localVertexEdgeList->get_ptr(t[0], 0);
-    const auto end0 = beg0 + localVertexEdgeList->size(t[0]);
-    const auto beg1 = localVertexEdgeList->get_ptr(t[1], 0);
-    const auto end1 = beg1 + localVertexEdgeList->size(t[1]);
-    const auto beg2 = localVertexEdgeList->get_ptr(t[2], 0);
-    const auto end2 = beg2 + localVertexEdgeList->size(t[2]);
-    std::set_intersection(beg0, end0, beg1, end1, &triangleEdgeList[i][0]);
-    std::set_intersection(beg0, end0, beg2, end2, &triangleEdgeList[i][1]);
-    std::set_intersection(beg1, end1, beg2, end2, &triangleEdgeList[i][2]);
-    std::sort(triangleEdgeList[i].begin(), triangleEdgeList[i].end());
+    if(localVertexEdgeList->hasShortIds()) {
+      intersectVertexEdges(*localVertexEdgeList, t,
+                           &FlatJaggedArray::get_short_ptr,
+                           triangleEdgeList[i]);
+    } else {
+      intersectVertexEdges(*localVertexEdgeList, t, &FlatJaggedArray::get_ptr,
+                           triangleEdgeList[i]);
+    }
   }
 
   SimplexId triangleNumber = localTriangleList->size();
@@ -572,7 +691,7 @@ int TwoSkeleton::buildTriangleLinks(
   // don't forget the last offset
   offsets[triangleNumber] = triangleStars.offset(triangleNumber);
 
-  triangleLinks.setData(std::move(links), std::move(offsets));
+  triangleLinks.setData(std::move(links), std::move(offsets), threadNumber_);
 
   printMsg("Built " + std::to_string(triangleNumber) + " triangle links", 1,
            tm.getElapsedTime(), threadNumber_);
@@ -620,7 +739,7 @@ int TwoSkeleton::buildVertexTriangles(
   }
 
   // fill FlatJaggedArray struct
-  vertexTriangles.setData(std::move(data), std::move(offsets));
+  vertexTriangles.setData(std::move(data), std::move(offsets), threadNumber_);
 
   printMsg("Built " + std::to_string(vertexNumber) + " vertex triangles", 1,
            tm.getElapsedTime(), 1);
@@ -120,13 +120,16 @@ namespace ttk {
     /// ordered std::vector of the vertex identifiers of the entry's triangle).
     /// \param triangleStars Optional output for triangle tet-adjacency (for
     /// each triangle, list of its adjacent tetrahedra).
+    /// \param vertexStars Optional input vertex stars (sorted cell
+    /// identifiers around each vertex), computed on the fly if not given
     /// \return Returns 0 upon success, negative values otherwise.
     int buildTriangleList(
       const SimplexId &vertexNumber,
       const CellArray &cellArray,
       std::vector<std::array<SimplexId, 3>> *triangleList = nullptr,
       FlatJaggedArray *triangleStars = nullptr,
-      std::vector<std::array<SimplexId, 4>> *cellTriangleList = nullptr) const;
+      std::vector<std::array<SimplexId, 4>> *cellTriangleList = nullptr,
+      const FlatJaggedArray *vertexStars = nullptr) const;
 
     /// Compute the list of edges connected to each triangle for 3D
     /// triangulations (unspecified behavior if the input mesh is not a
@@ -1,6 +1,8 @@
 #include <OneSkeleton.h>
 #include <ZeroSkeleton.h>
 
+#include <algorithm>
+
 using namespace std;
 using namespace ttk;
 
@@ -45,7 +47,7 @@ int ZeroSkeleton::buildVertexEdges(
   }
 
   // fill FlatJaggedArray struct
-  vertexEdges.setData(std::move(data), std::move(offsets));
+  vertexEdges.setData(std::move(data), std::move(offsets), threadNumber_);
 
   printMsg("Built " + std::to_string(vertexNumber) + " vertex edges", 1,
            t.getElapsedTime(), 1);
@@ -106,7 +108,7 @@ int ZeroSkeleton::buildVertexLinks(
   // don't forget the last offset
   offsets[vertexNumber] = vertexStars.offset(vertexNumber);
 
-  vertexLinks.setData(std::move(links), std::move(offsets));
+  vertexLinks.setData(std::move(links), std::move(offsets), threadNumber_);
 
   printMsg("Built " + std::to_string(vertexNumber) + " vertex links", 1,
            t.getElapsedTime(), threadNumber_);
@@ -164,7 +166,7 @@ int ZeroSkeleton::buildVertexLinks(
   // don't forget the last offset
   offsets[vertexNumber] = vertexStars.offset(vertexNumber);
 
-  vertexLinks.setData(std::move(links), std::move(offsets));
+  vertexLinks.setData(std::move(links), std::move(offsets), threadNumber_);
 
   printMsg("Built " + std::to_string(vertexNumber) + " vertex links", 1,
            tm.getElapsedTime(), threadNumber_);
@@ -222,7 +224,8 @@ int ZeroSkeleton::buildVertexNeighbors(
   }
 
   // fill FlatJaggedArray struct
-  vertexNeighbors.setData(std::move(neighbors), std::move(offsets));
+  vertexNeighbors.setData(
+    std::move(neighbors), std::move(offsets), threadNumber_);
 
   printMsg("Built " + std::to_string(vertexNumber) + " vertex neighbors", 1,
            t.getElapsedTime(), 1);
@@ -241,7 +244,8 @@ int ZeroSkeleton::buildVertexStars(const SimplexId &vertexNumber,
 
   Timer t;
 
-  printMsg("Building vertex stars", 0, 0, 1, ttk::debug::LineMode::REPLACE);
+  printMsg("Building vertex stars", 0, 0, threadNumber_,
+           ttk::debug::LineMode::REPLACE);
 
   std::vector<SimplexId> offsets(vertexNumber + 1);
   // number of cells processed per vertex
@@ -250,10 +254,17 @@ int ZeroSkeleton::buildVertexStars(const SimplexId &vertexNumber,
   const auto cellNumber = cellArray.getNbCells();
 
   // store number of stars per vertex
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif // TTK_ENABLE_OPENMP
   for(SimplexId i = 0; i < cellNumber; ++i) {
     const auto nbVertCell = cellArray.getCellVertexNumber(i);
     for(SimplexId j = 0; j < nbVertCell; ++j) {
-      offsets[cellArray.getCellVertex(i, j) + 1]++;
+      const auto v = cellArray.getCellVertex(i, j);
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp atomic update
+#endif // TTK_ENABLE_OPENMP
+      offsets[v + 1]++;
     }
   }
 
@@ -266,20 +277,38 @@ int ZeroSkeleton::buildVertexStars(const SimplexId &vertexNumber,
   std::vector<SimplexId> data(offsets.back());
 
   // fill flat data vector using offsets and edges count vectors
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif // TTK_ENABLE_OPENMP
   for(SimplexId i = 0; i < cellNumber; ++i) {
     const auto nbVertCell = cellArray.getCellVertexNumber(i);
     for(SimplexId j = 0; j < nbVertCell; ++j) {
       const auto v = cellArray.getCellVertex(i, j);
-      data[offsets[v] + cellIds[v]] = i;
-      cellIds[v]++;
+      SimplexId pos{};
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp atomic capture
+#endif // TTK_ENABLE_OPENMP
+      pos = cellIds[v]++;
+      data[offsets[v] + pos] = i;
+    }
+  }
+
+#ifdef TTK_ENABLE_OPENMP
+  if(threadNumber_ > 1) {
+    // concurrent insertions do not preserve the cell order: sort each
+    // star to get the same (ascending) output as the sequential version
+#pragma omp parallel for num_threads(threadNumber_) schedule(dynamic, 1024)
+    for(SimplexId i = 0; i < vertexNumber; ++i) {
+      std::sort(&data[offsets[i]], &data[offsets[i + 1]]);
     }
   }
+#endif // TTK_ENABLE_OPENMP
 
   // fill FlatJaggedArray struct
-  vertexStars.setData(std::move(data), std::move(offsets));
+  vertexStars.setData(std::move(data), std::move(offsets), threadNumber_);
 
   printMsg("Built " + std::to_string(vertexNumber) + " vertex stars", 1,
-           t.getElapsedTime(), 1);
+           t.getElapsedTime(), threadNumber_);
 
   if(debugLevel_ >= static_cast<int>(debug::Priority::VERBOSE)) {
     for(size_t i = 0; i < vertexStars.subvectorsNumber(); i++) {
@@ -12,7 +12,9 @@ Triangulation::Triangulation()
 
 Triangulation::Triangulation(const Triangulation &rhs)
   : AbstractTriangulation(rhs), abstractTriangulation_{nullptr},
+    useCompactTriangulation_{rhs.useCompactTriangulation_},
     explicitTriangulation_{rhs.explicitTriangulation_},
+    compactTriangulation_{rhs.compactTriangulation_},
     implicitTriangulation_{rhs.implicitTriangulation_},
     periodicImplicitTriangulation_{rhs.periodicImplicitTriangulation_} {
 
@@ -21,6 +23,8 @@ Triangulation::Triangulation(const Triangulation &rhs)
 
   if(rhs.abstractTriangulation_ == &rhs.explicitTriangulation_) {
     abstractTriangulation_ = &explicitTriangulation_;
+  } else if(rhs.abstractTriangulation_ == &rhs.compactTriangulation_) {
+    abstractTriangulation_ = &compactTriangulation_;
   } else if(rhs.abstractTriangulation_ == &rhs.implicitTriangulation_) {
     abstractTriangulation_ = &implicitTriangulation_;
   } else if(rhs.abstractTriangulation_ == &rhs.periodicImplicitTriangulation_) {
@@ -30,7 +34,9 @@ Triangulation::Triangulation(const Triangulation &rhs)
 
 Triangulation::Triangulation(Triangulation &&rhs) noexcept
   : AbstractTriangulation(std::move(rhs)), abstractTriangulation_{nullptr},
+    useCompactTriangulation_{rhs.useCompactTriangulation_},
     explicitTriangulation_{std::move(rhs.explicitTriangulation_)},
+    compactTriangulation_{std::move(rhs.compactTriangulation_)},
     implicitTriangulation_{std::move(rhs.implicitTriangulation_)},
     periodicImplicitTriangulation_{
       std::move(rhs.periodicImplicitTriangulation_)} {
@@ -40,6 +46,8 @@ Triangulation::Triangulation(Triangulation &&rhs) noexcept
 
   if(rhs.abstractTriangulation_ == &rhs.explicitTriangulation_) {
     abstractTriangulation_ = &explicitTriangulation_;
+  } else if(rhs.abstractTriangulation_ == &rhs.compactTriangulation_) {
+    abstractTriangulation_ = &compactTriangulation_;
   } else if(rhs.abstractTriangulation_ == &rhs.implicitTriangulation_) {
     abstractTriangulation_ = &implicitTriangulation_;
   } else if(rhs.abstractTriangulation_ == &rhs.periodicImplicitTriangulation_) {
@@ -52,13 +60,17 @@ Triangulation &Triangulation::operator=(const Triangulation &rhs) {
     AbstractTriangulation::operator=(rhs);
     gridDimensions_ = rhs.gridDimensions_;
     abstractTriangulation_ = nullptr;
+    useCompactTriangulation_ = rhs.useCompactTriangulation_;
     explicitTriangulation_ = rhs.explicitTriangulation_;
+    compactTriangulation_ = rhs.compactTriangulation_;
     implicitTriangulation_ = rhs.implicitTriangulation_;
     periodicImplicitTriangulation_ = rhs.periodicImplicitTriangulation_;
     hasPeriodicBoundaries_ = rhs.hasPeriodicBoundaries_;
 
     if(rhs.abstractTriangulation_ == &rhs.explicitTriangulation_) {
       abstractTriangulation_ = &explicitTriangulation_;
+    } else if(rhs.abstractTriangulation_ == &rhs.compactTriangulation_) {
+      abstractTriangulation_ = &compactTriangulation_;
     } else if(rhs.abstractTriangulation_ == &rhs.implicitTriangulation_) {
       abstractTriangulation_ = &implicitTriangulation_;
     } else if(rhs.abstractTriangulation_
@@ -74,7 +86,9 @@ Triangulation &Triangulation::operator=(Triangulation &&rhs) noexcept {
     AbstractTriangulation::operator=(std::move(rhs));
     gridDimensions_ = std::move(rhs.gridDimensions_);
     abstractTriangulation_ = nullptr;
+    useCompactTriangulation_ = rhs.useCompactTriangulation_;
     explicitTriangulation_ = std::move(rhs.explicitTriangulation_);
+    compactTriangulation_ = std::move(rhs.compactTriangulation_);
     implicitTriangulation_ = std::move(rhs.implicitTriangulation_);
     periodicImplicitTriangulation_
       = std::move(rhs.periodicImplicitTriangulation_);
@@ -82,6 +96,8 @@ Triangulation &Triangulation::operator=(Triangulation &&rhs) noexcept {
 
     if(rhs.abstractTriangulation_ == &rhs.explicitTriangulation_) {
       abstractTriangulation_ = &explicitTriangulation_;
+    } else if(rhs.abstractTriangulation_ == &rhs.compactTriangulation_) {
+      abstractTriangulation_ = &compactTriangulation_;
     } else if(rhs.abstractTriangulation_ == &rhs.implicitTriangulation_) {
       abstractTriangulation_ = &implicitTriangulation_;
     } else if(rhs.abstractTriangulation_
@@ -19,6 +19,10 @@
 ///   -# Explicit triangulations: Given a list of points and a list of cells,
 /// Triangulation provides time efficient accesses (requiring adequate
 /// pre-processing, see the documentation furtherdown).
+///   -# Compact triangulations: Same input as explicit triangulations, but
+/// the relations are computed on demand per cluster of vertices and kept in
+/// a cache of bounded size, for meshes whose relations do not fit in memory
+/// (see setCompactTriangulation()).
 ///   -# Implicit triangulations: Given a regular grid (origin, spacings and
 /// dimensions), Triangulation will perform an implicit triangulation of the
 /// grid, enabling both time and memory efficient traversals of triangulations
@@ -37,6 +41,7 @@
 
 // base code includes
 #include <AbstractTriangulation.h>
+#include <CompactTriangulation.h>
 #include <ExplicitTriangulation.h>
 #include <ImplicitTriangulation.h>
 #include <PeriodicImplicitTriangulation.h>
@@ -55,7 +60,7 @@ namespace ttk {
     Triangulation &operator=(Triangulation &&) noexcept;
     ~Triangulation();
 
-    enum class Type { EXPLICIT, IMPLICIT, PERIODIC };
+    enum class Type { EXPLICIT, IMPLICIT, PERIODIC, COMPACT };
 
     /// Reset the triangulation data-structures.
     /// \return Returns 0 upon success, negative values otherwise.
@@ -69,11 +74,49 @@ namespace ttk {
     }
 
     /// Computes and displays the memory footprint of the data-structure.
-    /// \return Returns 0 upon success, negative values otherwise.
-    inline size_t footprint() const {
+    /// \param quiet Only compute the footprint, without printing a report.
+    /// \return Returns the footprint in bytes.
+    inline size_t footprint(const bool quiet = false) const {
 
+      if(abstractTriangulation_ == &explicitTriangulation_) {
+        return explicitTriangulation_.footprint(0, quiet);
+      }
+      if(abstractTriangulation_ == &compactTriangulation_) {
+        return compactTriangulation_.footprint(0, quiet);
+      }
+      if(abstractTriangulation_ == &implicitTriangulation_) {
+        return implicitTriangulation_.footprint(0, quiet);
+      }
       if(abstractTriangulation_) {
-        return abstractTriangulation_->footprint();
+        return abstractTriangulation_->footprint(0, quiet);
+      }
+
+      return 0;
+    }
+
+    /// Get the memory footprint (in bytes) of a pre-conditioned relation.
+    /// \return Returns 0 if the triangulation is not explicit (the relations
+    /// of implicit and compact triangulations are computed on the fly).
+    /// \sa ExplicitTriangulation::getRelationFootprint()
+    inline size_t getRelationFootprint(
+      const ExplicitTriangulation::Relation &relation) const {
+
+      if(abstractTriangulation_ == &explicitTriangulation_) {
+        return explicitTriangulation_.getRelationFootprint(relation);
+      }
+
+      return 0;
+    }
+
+    /// Release the memory of a pre-conditioned relation.
+    /// \return Returns the number of released bytes (0 if the triangulation
+    /// is not explicit).
+    /// \sa ExplicitTriangulation::releaseRelation()
+    inline size_t
+      releaseRelation(const ExplicitTriangulation::Relation &relation) {
+
+      if(abstractTriangulation_ == &explicitTriangulation_) {
+        return explicitTriangulation_.releaseRelation(relation);
       }
 
       return 0;
@@ -874,6 +917,17 @@ namespace ttk {
       return abstractTriangulation_->getNumberOfVertices();
     }
 
+    /// Get the blocks of a cache-friendly traversal of the vertices of the
+    /// current representation.
+    /// \return Returns the blocks of vertices.
+    /// \sa AbstractTriangulation::getVertexBlocks()
+    inline VertexBlocks getVertexBlocks() const {
+      if(abstractTriangulation_ == &implicitTriangulation_) {
+        return implicitTriangulation_.getVertexBlocks();
+      }
+      return abstractTriangulation_->getVertexBlocks();
+    }
+
     /// Compute the barycenter of the points of the given tet identifier.
     /// \param tetId Input global tet identifier.
     /// \param incenter Output barycenter.
@@ -1217,7 +1271,7 @@ namespace ttk {
     }
 
     /// Get the type of internal representation for the triangulation
-    /// (explicit, implicit, periodic).
+    /// (explicit, implicit, periodic, compact).
     ///
     /// \return Returns the current type of the triangulation.
     /// \sa setPeriodicBoundaryConditions()
@@ -1226,6 +1280,8 @@ namespace ttk {
         return Triangulation::Type::EXPLICIT;
       else if(abstractTriangulation_ == &implicitTriangulation_)
         return Triangulation::Type::IMPLICIT;
+      else if(abstractTriangulation_ == &compactTriangulation_)
+        return Triangulation::Type::COMPACT;
       else
         return Triangulation::Type::PERIODIC;
     }
@@ -2274,6 +2330,7 @@ namespace ttk {
     /// Tune the debug level (default: 0)
     inline int setDebugLevel(const int &debugLevel) {
       explicitTriangulation_.setDebugLevel(debugLevel);
+      compactTriangulation_.setDebugLevel(debugLevel);
       implicitTriangulation_.setDebugLevel(debugLevel);
       periodicImplicitTriangulation_.setDebugLevel(debugLevel);
       debugLevel_ = debugLevel;
@@ -2303,8 +2360,14 @@ namespace ttk {
     inline int setInputCells(const SimplexId &cellNumber,
                              const LongSimplexId *connectivity,
                              const LongSimplexId *offset) {
-      abstractTriangulation_ = &explicitTriangulation_;
+      if(useCompactTriangulation_)
+        abstractTriangulation_ = &compactTriangulation_;
+      else
+        abstractTriangulation_ = &explicitTriangulation_;
       gridDimensions_[0] = gridDimensions_[1] = gridDimensions_[2] = -1;
+      if(useCompactTriangulation_)
+        return compactTriangulation_.setInputCells(
+          cellNumber, connectivity, offset);
       return explicitTriangulation_.setInputCells(
         cellNumber, connectivity, offset);
     }
@@ -2331,8 +2394,13 @@ namespace ttk {
     /// means that pre-processing functions should be called again).
     inline int setInputCells(const SimplexId &cellNumber,
                              const LongSimplexId *cellArray) {
-      abstractTriangulation_ = &explicitTriangulation_;
+      if(useCompactTriangulation_)
+        abstractTriangulation_ = &compactTriangulation_;
+      else
+        abstractTriangulation_ = &explicitTriangulation_;
       gridDimensions_[0] = gridDimensions_[1] = gridDimensions_[2] = -1;
+      if(useCompactTriangulation_)
+        return compactTriangulation_.setInputCells(cellNumber, cellArray);
       return explicitTriangulation_.setInputCells(cellNumber, cellArray);
     }
 #endif
@@ -2412,6 +2480,77 @@ namespace ttk {
       }
     }
 
+    /// Compute the position of the simplices of implicit triangulations on
+    /// the fly instead of storing them (constant memory footprint).
+    ///
+    /// \param positionFree If this set to true then the position tables of
+    /// the implicit triangulation will be released.
+    /// \return Returns 0 upon success, negative values otherwise.
+    /// \sa ImplicitTriangulation::setPositionFree()
+    inline int setPositionFree(const bool &positionFree) {
+      return implicitTriangulation_.setPositionFree(positionFree);
+    }
+
+    /// Set the edge length (in vertices) of the bricks of the vertex
+    /// traversal of 3D implicit triangulations.
+    /// \sa ImplicitTriangulation::setVertexBlockSize()
+    inline int setVertexBlockSize(const SimplexId &blockSize) {
+      return implicitTriangulation_.setVertexBlockSize(blockSize);
+    }
+
+    /// Use the compact representation for explicit meshes (points and
+    /// cells).
+    ///
+    /// The relations are then computed on demand, per cluster of about
+    /// \p clusterSize vertices, and cached up to \p memoryBudget bytes (see
+    /// CompactTriangulation).
+    ///
+    /// \param useCompactTriangulation If this set to true then a compact
+    /// triangulation will be used instead of an explicit one.
+    /// \param memoryBudget Maximum size in bytes of the relation cache.
+    /// \param clusterSize Targeted number of vertices per cluster.
+    /// \return Returns 0 upon success, negative values otherwise.
+    ///
+    /// \warning Only the selected representation receives the input points
+    /// and cells: switching representations requires to call this function
+    /// before setInputPoints() and setInputCells().
+    inline int setCompactTriangulation(const bool &useCompactTriangulation,
+                                       const size_t &memoryBudget
+                                       = size_t{1} << 30,
+                                       const SimplexId &clusterSize = 1024) {
+
+      compactTriangulation_.setMemoryBudget(memoryBudget);
+      compactTriangulation_.setClusterSize(clusterSize);
+
+      if(useCompactTriangulation == useCompactTriangulation_) {
+        return 0;
+      }
+
+      if(((abstractTriangulation_ == &explicitTriangulation_)
+          || (abstractTriangulation_ == &compactTriangulation_))
+         && !abstractTriangulation_->isEmpty()) {
+        printErr("Cannot switch the representation of an explicit mesh "
+                 "after its input has been set");
+        return -1;
+      }
+      useCompactTriangulation_ = useCompactTriangulation;
+
+      if((abstractTriangulation_ == &explicitTriangulation_)
+         || (abstractTriangulation_ == &compactTriangulation_)) {
+        if(useCompactTriangulation) {
+          abstractTriangulation_ = &compactTriangulation_;
+        } else {
+          abstractTriangulation_ = &explicitTriangulation_;
+        }
+      }
+      return 0;
+    }
+
+    /// Is the compact representation used for explicit meshes?
+    inline bool isCompactTriangulation() const {
+      return useCompactTriangulation_;
+    }
+
     /// Set the input 3D points of the triangulation.
     /// \param pointNumber Number of input vertices.
     /// \param pointSet Pointer to the 3D points. This pointer should point to
@@ -2432,8 +2571,14 @@ namespace ttk {
                               const void *pointSet,
                               const bool &doublePrecision = false) {
 
-      abstractTriangulation_ = &explicitTriangulation_;
+      if(useCompactTriangulation_)
+        abstractTriangulation_ = &compactTriangulation_;
+      else
+        abstractTriangulation_ = &explicitTriangulation_;
       gridDimensions_[0] = gridDimensions_[1] = gridDimensions_[2] = -1;
+      if(useCompactTriangulation_)
+        return compactTriangulation_.setInputPoints(
+          pointNumber, pointSet, doublePrecision);
       return explicitTriangulation_.setInputPoints(
         pointNumber, pointSet, doublePrecision);
     }
@@ -2441,6 +2586,7 @@ namespace ttk {
     /// Tune the number of active threads (default: number of logical cores)
     inline int setThreadNumber(const ThreadId threadNumber) {
       explicitTriangulation_.setThreadNumber(threadNumber);
+      compactTriangulation_.setThreadNumber(threadNumber);
       implicitTriangulation_.setThreadNumber(threadNumber);
       periodicImplicitTriangulation_.setThreadNumber(threadNumber);
       threadNumber_ = threadNumber;
@@ -2451,6 +2597,7 @@ namespace ttk {
     /// threads, etc.) to the implementing classes.
     inline int setWrapper(const Wrapper *wrapper) {
       explicitTriangulation_.setWrapper(wrapper);
+      compactTriangulation_.setWrapper(wrapper);
       implicitTriangulation_.setWrapper(wrapper);
       periodicImplicitTriangulation_.setWrapper(wrapper);
       return 0;
@@ -2466,7 +2613,9 @@ namespace ttk {
     }
 
     AbstractTriangulation *abstractTriangulation_;
+    bool useCompactTriangulation_{false};
     ExplicitTriangulation explicitTriangulation_;
+    CompactTriangulation compactTriangulation_;
     ImplicitTriangulation implicitTriangulation_;
     PeriodicImplicitTriangulation periodicImplicitTriangulation_;
   };
@@ -0,0 +1,203 @@
+/// \ingroup base
+/// \class ttk::AtomicUnionFind
+/// \date October 2026.
+///
+/// \brief Lock-free union-find for concurrent connectivity tracking.
+///
+/// %AtomicUnionFind is a CRTP base class: each node of type \p Derived
+/// holds a single atomic word storing either the parent of the node or, for
+/// the root of a set, the rank of this set. Finds compress the paths with
+/// path halving. Unions link the root of lower rank (of lower address on
+/// ties) below the other one with a compare-and-swap, which fails and is
+/// retried if the rank or the parent of this root changed concurrently: two
+/// concurrent unions can thus never link two roots below each other. Finds
+/// never wait and a union only retries when another union succeeded.
+///
+/// The data carried by the sets lives in \p Derived: a union calls
+/// Derived::mergeData() on the new root with the root linked below it,
+/// after the link and without any synchronization. Only the structure is
+/// lock-free: the unions involving sets that carry data must be serialized
+/// by the caller (the FTM engine only merges the sets of the propagations
+/// that all stopped on a saddle, from the task that reached it last).
+///
+/// Nodes allocated with new are aligned on cache lines and padded to a
+/// whole number of them, so that the updates of distinct nodes by distinct
+/// threads do not falsely share lines. Nodes stored in arrays are not
+/// padded (see standalone/UnionFindBenchmark).
+///
+/// \sa ttk::UnionFind for the sequential version
+/// \sa ttk::ftm::AtomicUF, ttk::ftr::AtomicUF, ttk::cf::ExtendedUnionFind
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace ttk {
+
+  template <class Derived>
+  class AtomicUnionFind {
+
+  public:
+    /// Alignment and padding of the nodes allocated with new
+    static constexpr std::size_t CACHE_LINE_SIZE = 64;
+
+    // 1) constructors, operators
+
+    inline AtomicUnionFind() : word_{rootWord(0)} {
+    }
+
+    // a copy is a new singleton
+    inline AtomicUnionFind(const AtomicUnionFind &) noexcept
+      : word_{rootWord(0)} {
+    }
+
+    // so is an assigned node (not thread-safe)
+    inline AtomicUnionFind &operator=(const AtomicUnionFind &) noexcept {
+      word_.store(rootWord(0), std::memory_order_relaxed);
+      return *this;
+    }
+
+    inline bool operator<(const AtomicUnionFind &other) const {
+      return getRank() < other.getRank();
+    }
+
+    inline bool operator>(const AtomicUnionFind &other) const {
+      return getRank() > other.getRank();
+    }
+
+    static inline void *operator new(const std::size_t size) {
+      const std::size_t padded
+        = (size + CACHE_LINE_SIZE - 1) / CACHE_LINE_SIZE * CACHE_LINE_SIZE;
+      void *const block
+        = ::operator new(padded + CACHE_LINE_SIZE - 1 + sizeof(void *));
+      const std::uintptr_t address
+        = (reinterpret_cast<std::uintptr_t>(block) + sizeof(void *)
+           + CACHE_LINE_SIZE - 1)
+          & ~static_cast<std::uintptr_t>(CACHE_LINE_SIZE - 1);
+      // the allocated block is stored just before the node
+      reinterpret_cast<void **>(address)[-1] = block;
+      return reinterpret_cast<void *>(address);
+    }
+
+    static inline void operator delete(void *const node) {
+      if(node != nullptr) {
+        ::operator delete(reinterpret_cast<void **>(node)[-1]);
+      }
+    }
+
+    // 2) functions
+
+    /// Root of the set of this node, halving the path on the way
+    inline Derived *find() {
+      AtomicUnionFind *node = this;
+      std::uintptr_t word = node->word_.load(std::memory_order_acquire);
+      while(!isRootWord(word)) {
+        AtomicUnionFind *const parent = toNode(word);
+        const std::uintptr_t parentWord
+          = parent->word_.load(std::memory_order_acquire);
+        if(isRootWord(parentWord)) {
+          return static_cast<Derived *>(parent);
+        }
+        // best effort: on failure, another thread already moved node up
+        node->word_.compare_exchange_weak(word, parentWord,
+                                          std::memory_order_release,
+                                          std::memory_order_relaxed);
+        node = toNode(parentWord);
+        word = node->word_.load(std::memory_order_acquire);
+      }
+      return static_cast<Derived *>(node);
+    }
+
+    /// Rank of the set, to be called on its root (0 otherwise)
+    inline int getRank() const {
+      const std::uintptr_t word = word_.load(std::memory_order_acquire);
+      return isRootWord(word) ? static_cast<int>(word >> 1) : 0;
+    }
+
+    /// Called on the new root of a union with the root linked below it,
+    /// to be redefined in \p Derived to merge the data of the sets
+    inline void mergeData(Derived &) {
+    }
+
+    /// Union of the sets of \p uf0 and \p uf1, returns the new root.
+    ///
+    /// The link is lock-free, but mergeData() runs after it without
+    /// synchronization: concurrent unions touching the same sets are only
+    /// safe if \p Derived carries no data.
+    static inline Derived *makeUnion(Derived *uf0, Derived *uf1) {
+      while(true) {
+        AtomicUnionFind *root0 = uf0->find();
+        AtomicUnionFind *root1 = uf1->find();
+        if(root0 == root1) {
+          return static_cast<Derived *>(root0);
+        }
+        std::uintptr_t word0 = root0->word_.load(std::memory_order_acquire);
+        std::uintptr_t word1 = root1->word_.load(std::memory_order_acquire);
+        if(!isRootWord(word0) || !isRootWord(word1)) {
+          // linked meanwhile
+          continue;
+        }
+
+        // root1 goes below root0
+        if(word0 < word1
+           || (word0 == word1
+               && std::less<AtomicUnionFind *>()(root0, root1))) {
+          std::swap(root0, root1);
+          std::swap(word0, word1);
+        }
+        if(root1->word_.compare_exchange_strong(
+             word1, reinterpret_cast<std::uintptr_t>(root0),
+             std::memory_order_acq_rel, std::memory_order_acquire)) {
+          if(word0 == word1) {
+            // best effort: fails only if root0 changed meanwhile
+            root0->word_.compare_exchange_strong(
+              word0, rootWord((word0 >> 1) + 1), std::memory_order_acq_rel,
+              std::memory_order_relaxed);
+          }
+          static_cast<Derived *>(root0)->mergeData(
+            *static_cast<Derived *>(root1));
+          return static_cast<Derived *>(root0);
+        }
+      }
+    }
+
+    static inline Derived *makeUnion(std::vector<Derived *> &sets) {
+      Derived *n = nullptr;
+
+      if(!sets.size())
+        return nullptr;
+
+      if(sets.size() == 1)
+        return sets[0];
+
+      for(int i = 0; i < (int)sets.size() - 1; i++)
+        n = makeUnion(sets[i], sets[i + 1]);
+
+      return n;
+    }
+
+  private:
+    // roots store their rank with the lowest bit set, other nodes their
+    // parent (at least 2-byte aligned, so with the lowest bit unset)
+    static inline std::uintptr_t rootWord(const std::uintptr_t rank) {
+      return (rank << 1) | 1;
+    }
+
+    static inline bool isRootWord(const std::uintptr_t word) {
+      return (word & 1) != 0;
+    }
+
+    static inline AtomicUnionFind *toNode(const std::uintptr_t word) {
+      return reinterpret_cast<AtomicUnionFind *>(word);
+    }
+
+    std::atomic<std::uintptr_t> word_;
+  };
+
+} // namespace ttk
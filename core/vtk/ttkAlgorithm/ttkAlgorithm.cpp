@@ -21,6 +21,8 @@
 
 #include <vtkCompositeDataPipeline.h>
 
+#include <algorithm>
+
 // Pass input type information key
 #include <vtkInformationKey.h>
 vtkInformationKeyMacro(ttkAlgorithm, SAME_DATA_TYPE_AS_INPUT_PORT, Integer);
@@ -38,8 +40,10 @@ ttk::Triangulation *ttkAlgorithm::GetTriangulation(vtkDataSet *dataSet) {
                    + std::string(dataSet->GetClassName()) + "'",
                  ttk::debug::Priority::DETAIL);
 
-  auto triangulation
-    = ttkTriangulationFactory::GetTriangulation(this->debugLevel_, dataSet);
+  auto triangulation = ttkTriangulationFactory::GetTriangulation(
+    this->debugLevel_, dataSet, this, this->CompactTriangulation,
+    static_cast<size_t>(std::max(this->CompactTriangulationCacheSize, 1))
+      << 20);
   if(triangulation)
     return triangulation;
 
@@ -429,7 +433,14 @@ int ttkAlgorithm::ProcessRequest(vtkInformation *request,
   if(request->Has(vtkCompositeDataPipeline::REQUEST_DATA())) {
     this->printMsg("Processing REQUEST_DATA", ttk::debug::Priority::VERBOSE);
     this->printMsg(ttk::debug::Separator::L0);
-    return this->RequestData(request, inputVector, outputVector);
+    const int status = this->RequestData(request, inputVector, outputVector);
+    if(this->TriangulationMemoryBudget > 0) {
+      ttkTriangulationFactory::SetMemoryBudget(
+        static_cast<size_t>(this->TriangulationMemoryBudget) << 20);
+    }
+    // the triangulations used by this filter can now be evicted
+    ttkTriangulationFactory::ReleaseTriangulations(this);
+    return status;
   }
 
   this->printErr("Unsupported pipeline pass:");
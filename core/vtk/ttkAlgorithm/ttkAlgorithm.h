@@ -32,6 +32,9 @@ class TTKALGORITHM_EXPORT ttkAlgorithm : public vtkAlgorithm,
 private:
   int ThreadNumber{1};
   bool UseAllCores{true};
+  bool CompactTriangulation{false};
+  int CompactTriangulationCacheSize{1024};
+  int TriangulationMemoryBudget{0};
 
 public:
   static ttkAlgorithm *New();
@@ -74,6 +77,38 @@ public:
     this->Modified();
   };
 
+  /**
+   * Controls if the triangulations of explicit meshes (vtkUnstructuredGrid,
+   * vtkPolyData) use the compact representation, which computes the
+   * relations on demand per cluster of vertices instead of storing them
+   * for the whole mesh (see ttk::CompactTriangulation).
+   */
+  void SetCompactTriangulation(bool compactTriangulation) {
+    this->CompactTriangulation = compactTriangulation;
+    this->Modified();
+  };
+
+  /**
+   * Controls the maximum size (in MiB) of the relation cache of compact
+   * triangulations.
+   */
+  void SetCompactTriangulationCacheSize(int cacheSize) {
+    this->CompactTriangulationCacheSize = cacheSize;
+    this->Modified();
+  };
+
+  /**
+   * Controls the maximum size (in MiB) of all the triangulations kept
+   * between executions (see ttkTriangulationFactory::SetMemoryBudget()).
+   * This budget is shared by all the filters: it is set after each
+   * execution of a filter with a positive value (0 keeps the current
+   * budget, unlimited by default).
+   */
+  void SetTriangulationMemoryBudget(int memoryBudget) {
+    this->TriangulationMemoryBudget = memoryBudget;
+    this->Modified();
+  };
+
   /// This method retrieves an optional array to process.
   /// The logic of this method is as follows:
   ///   - if \p enforceArrayIndex is set to true, this method will try to
@@ -148,6 +183,11 @@ public:
    *
    * To pass the triangulation along the pipeline, filters have to perform a
    * shallow or deep copy of an input that already has a triangulation.
+   *
+   * The returned triangulation is guaranteed to stay valid until the end of
+   * the current RequestData() call. After that, its pre-conditioned
+   * relations (or the triangulation itself) may be released if a memory
+   * budget is set (see SetTriangulationMemoryBudget()).
    */
   ttk::Triangulation *GetTriangulation(vtkDataSet *object);
 
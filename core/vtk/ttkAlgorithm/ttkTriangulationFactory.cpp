@@ -10,6 +10,8 @@
 #include <vtkCallbackCommand.h>
 #include <vtkCommand.h>
 
+#include <algorithm>
+
 vtkCellArray *GetCells(vtkDataSet *dataSet) {
   switch(dataSet->GetDataObjectType()) {
     case VTK_UNSTRUCTURED_GRID: {
@@ -184,11 +186,13 @@ RegistryTriangulation
   return triangulation;
 };
 
-RegistryTriangulation
-  ttkTriangulationFactory::CreateExplicitTriangulation(vtkPointSet *pointSet) {
+RegistryTriangulation ttkTriangulationFactory::CreateExplicitTriangulation(
+  vtkPointSet *pointSet, const bool compact, const size_t cacheSize) {
   ttk::Timer timer;
-  this->printMsg("Initializing Explicit Triangulation", 0, 0,
-                 ttk::debug::LineMode::REPLACE, ttk::debug::Priority::DETAIL);
+  const std::string msg = compact ? "Initializing Compact Triangulation"
+                                  : "Initializing Explicit Triangulation";
+  this->printMsg(
+    msg, 0, 0, ttk::debug::LineMode::REPLACE, ttk::debug::Priority::DETAIL);
 
   auto points = pointSet->GetPoints();
   if(!points) {
@@ -203,6 +207,8 @@ RegistryTriangulation
   }
 
   auto triangulation = RegistryTriangulation(new ttk::Triangulation());
+  // the representation has to be chosen before setting the input
+  triangulation->setCompactTriangulation(compact, cacheSize);
 
   // Points
   {
@@ -263,20 +269,21 @@ RegistryTriangulation
     }
   }
 
-  this->printMsg("Initializing Explicit Triangulation", 1,
-                 timer.getElapsedTime(), ttk::debug::LineMode::NEW,
+  this->printMsg(msg, 1, timer.getElapsedTime(), ttk::debug::LineMode::NEW,
                  ttk::debug::Priority::DETAIL);
 
   return triangulation;
 };
 
 RegistryTriangulation
-  ttkTriangulationFactory::CreateTriangulation(vtkDataSet *dataSet) {
+  ttkTriangulationFactory::CreateTriangulation(vtkDataSet *dataSet,
+                                               const bool compact,
+                                               const size_t cacheSize) {
   switch(dataSet->GetDataObjectType()) {
     case VTK_UNSTRUCTURED_GRID:
     case VTK_POLY_DATA: {
       return this->CreateExplicitTriangulation(
-        static_cast<vtkPointSet *>(dataSet));
+        static_cast<vtkPointSet *>(dataSet), compact, cacheSize);
     }
     case VTK_IMAGE_DATA: {
       return this->CreateImplicitTriangulation((vtkImageData *)dataSet);
@@ -292,7 +299,10 @@ RegistryTriangulation
 
 ttk::Triangulation *
   ttkTriangulationFactory::GetTriangulation(int debugLevel,
-                                            vtkDataSet *object) {
+                                            vtkDataSet *object,
+                                            const void *user,
+                                            const bool compact,
+                                            const size_t compactCacheSize) {
   auto instance = &ttkTriangulationFactory::Instance;
   instance->setDebugLevel(debugLevel);
 
@@ -303,9 +313,20 @@ ttk::Triangulation *
   if(it != instance->registry.end()) {
     // object is the owner of the explicit or implicit triangulation
     if(it->second.isValid(object)) {
-      instance->printMsg(
-        "Retrieving Existing Triangulation", ttk::debug::Priority::DETAIL);
-      triangulation = it->second.triangulation.get();
+      // (a triangulation in use by another filter is kept as is)
+      if(it->second.compact != compact && object->IsA("vtkPointSet")
+         && it->second.users.empty()) {
+        instance->printMsg("Existing Triangulation Has Another Representation",
+                           ttk::debug::Priority::DETAIL);
+        instance->registry.erase(key);
+      } else {
+        instance->printMsg(
+          "Retrieving Existing Triangulation", ttk::debug::Priority::DETAIL);
+        triangulation = it->second.triangulation.get();
+        if(it->second.compact) {
+          triangulation->setCompactTriangulation(true, compactCacheSize);
+        }
+      }
     } else {
       instance->printMsg(
         "Existing Triangulation No Longer Valid", ttk::debug::Priority::DETAIL);
@@ -322,11 +343,17 @@ ttk::Triangulation *
   }
 
   if(!triangulation) {
-    triangulation = instance->CreateTriangulation(object).release();
+    triangulation
+      = instance->CreateTriangulation(object, compact, compactCacheSize)
+          .release();
     if(triangulation) {
-      instance->registry.emplace(std::piecewise_construct,
-                                 std::forward_as_tuple(key),
-                                 std::forward_as_tuple(object, triangulation));
+      auto it = instance->registry
+                  .emplace(std::piecewise_construct,
+                           std::forward_as_tuple(key),
+                           std::forward_as_tuple(object, triangulation))
+                  .first;
+      it->second.compact = triangulation->isCompactTriangulation();
+      it->second.footprint = triangulation->footprint(true);
     }
   }
 
@@ -334,12 +361,136 @@ ttk::Triangulation *
     "# Registered Triangulations: " + std::to_string(instance->registry.size()),
     ttk::debug::Priority::VERBOSE);
 
-  if(triangulation)
+  if(triangulation) {
     triangulation->setDebugLevel(debugLevel);
 
+    // pin the triangulation (the equivalent implicit triangulation may be
+    // registered under another key)
+    for(auto &entry : instance->registry) {
+      auto &value = entry.second;
+      if(value.triangulation.get() == triangulation) {
+        value.lastUse = ++instance->clock;
+        if(user != nullptr
+           && std::find(value.users.begin(), value.users.end(), user)
+                == value.users.end()) {
+          value.users.emplace_back(user);
+        }
+        break;
+      }
+    }
+  }
+
   return triangulation;
 };
 
+void ttkTriangulationFactory::ReleaseTriangulations(const void *user) {
+  auto instance = &ttkTriangulationFactory::Instance;
+
+  for(auto &entry : instance->registry) {
+    auto &value = entry.second;
+    const auto it = std::find(value.users.begin(), value.users.end(), user);
+    if(it != value.users.end()) {
+      value.users.erase(it);
+      // the filter may have pre-conditioned new relations
+      value.footprint = value.triangulation->footprint(true);
+    }
+  }
+
+  instance->EnforceMemoryBudget();
+}
+
+void ttkTriangulationFactory::SetMemoryBudget(const size_t memoryBudget) {
+  auto instance = &ttkTriangulationFactory::Instance;
+  instance->memoryBudget = memoryBudget;
+  instance->EnforceMemoryBudget();
+}
+
+size_t ttkTriangulationFactory::GetMemoryBudget() {
+  return ttkTriangulationFactory::Instance.memoryBudget;
+}
+
+size_t ttkTriangulationFactory::GetFootprint() {
+  size_t footprint{};
+  for(const auto &entry : ttkTriangulationFactory::Instance.registry) {
+    footprint += entry.second.footprint;
+  }
+  return footprint;
+}
+
+int ttkTriangulationFactory::EnforceMemoryBudget() {
+
+  if(this->memoryBudget == 0) {
+    return 0;
+  }
+
+  size_t footprint = ttkTriangulationFactory::GetFootprint();
+  if(footprint <= this->memoryBudget) {
+    return 0;
+  }
+
+  ttk::Timer timer;
+
+  // triangulations not in use, least recently used first
+  std::vector<std::pair<size_t, RegistryKey>> candidates{};
+  for(const auto &entry : this->registry) {
+    if(entry.second.users.empty()) {
+      candidates.emplace_back(entry.second.lastUse, entry.first);
+    }
+  }
+  std::sort(candidates.begin(), candidates.end());
+
+  // 1. release the pre-conditioned relations, largest first
+  using Relation = ttk::ExplicitTriangulation::Relation;
+  for(const auto &candidate : candidates) {
+    auto &value = this->registry.at(candidate.second);
+    auto triangulation = value.triangulation.get();
+
+    std::vector<std::pair<size_t, int>> relations{};
+    for(int i = 0; i < ttk::ExplicitTriangulation::RELATION_NUMBER; ++i) {
+      const auto size = triangulation->getRelationFootprint((Relation)i);
+      if(size > 0) {
+        relations.emplace_back(size, i);
+      }
+    }
+    std::sort(relations.rbegin(), relations.rend());
+
+    for(const auto &relation : relations) {
+      const auto released
+        = triangulation->releaseRelation((Relation)relation.second);
+      value.footprint -= std::min(value.footprint, released);
+      footprint -= std::min(footprint, released);
+      if(footprint <= this->memoryBudget) {
+        break;
+      }
+    }
+    if(footprint <= this->memoryBudget) {
+      break;
+    }
+  }
+
+  // 2. evict whole triangulations
+  size_t nEvicted{};
+  for(const auto &candidate : candidates) {
+    if(footprint <= this->memoryBudget) {
+      break;
+    }
+    const auto it = this->registry.find(candidate.second);
+    footprint -= std::min(footprint, it->second.footprint);
+    this->registry.erase(it);
+    nEvicted++;
+  }
+
+  this->printMsg("Enforced memory budget (" + std::to_string(nEvicted)
+                   + " triangulation(s) evicted)",
+                 1, timer.getElapsedTime(), ttk::debug::LineMode::NEW,
+                 ttk::debug::Priority::DETAIL);
+  this->printMsg(
+    "# Registered Triangulations: " + std::to_string(this->registry.size()),
+    ttk::debug::Priority::VERBOSE);
+
+  return nEvicted;
+}
+
 int ttkTriangulationFactory::FindImplicitTriangulation(
   ttk::Triangulation *&triangulation, vtkImageData *image) {
 
@@ -4,6 +4,7 @@
 
 #include <Debug.h>
 #include <unordered_map>
+#include <vector>
 #include <vtkType.h>
 
 class vtkDataSet;
@@ -22,6 +23,15 @@ struct RegistryValue {
   vtkDataSet *owner;
 
   vtkMTimeType cellModTime{0};
+  // explicit mesh stored in a ttk::CompactTriangulation
+  bool compact{false};
+
+  // memory footprint (in bytes) measured at the last release
+  size_t footprint{0};
+  // logical time of the last request (for least-recently-used eviction)
+  size_t lastUse{0};
+  // filters currently using the triangulation (never evicted if not empty)
+  std::vector<const void *> users{};
 
   int extent[6];
   double origin[3];
@@ -37,8 +47,38 @@ using Registry = std::unordered_map<RegistryKey, RegistryValue>;
 
 class TTKALGORITHM_EXPORT ttkTriangulationFactory : public ttk::Debug {
 public:
-  static ttk::Triangulation *GetTriangulation(int debugLevel,
-                                              vtkDataSet *object);
+  /// Get the triangulation of \p object (created if needed).
+  ///
+  /// The triangulation is pinned until ReleaseTriangulations() is called
+  /// with the same \p user: it will not be evicted in the meantime.
+  ///
+  /// Explicit meshes use a ttk::CompactTriangulation if \p compact is
+  /// set, whose relation cache is bounded by \p compactCacheSize bytes. A
+  /// registered triangulation of the other representation is replaced.
+  static ttk::Triangulation *
+    GetTriangulation(int debugLevel,
+                     vtkDataSet *object,
+                     const void *user = nullptr,
+                     const bool compact = false,
+                     const size_t compactCacheSize = size_t{1} << 30);
+
+  /// Unpin every triangulation requested by \p user and enforce the
+  /// memory budget.
+  static void ReleaseTriangulations(const void *user);
+
+  /// Set the maximum number of bytes used by the registered
+  /// triangulations (0, the default, means unlimited).
+  ///
+  /// When this budget is exceeded, the pre-conditioned relations of the
+  /// least recently used triangulations are released first (largest
+  /// first), then whole triangulations are evicted. Triangulations in use
+  /// by a filter are never affected.
+  static void SetMemoryBudget(const size_t memoryBudget);
+  static size_t GetMemoryBudget();
+
+  /// Get the total footprint (in bytes) of the registered triangulations,
+  /// as measured at their last release.
+  static size_t GetFootprint();
 
   static ttkTriangulationFactory Instance;
   static RegistryKey GetKey(vtkDataSet *dataSet);
@@ -52,9 +92,17 @@ public:
   Registry registry;
 
 private:
+  size_t memoryBudget{0};
+  size_t clock{0};
+
+  int EnforceMemoryBudget();
   RegistryTriangulation CreateImplicitTriangulation(vtkImageData *image);
-  RegistryTriangulation CreateExplicitTriangulation(vtkPointSet *pointSet);
-  RegistryTriangulation CreateTriangulation(vtkDataSet *dataSet);
+  RegistryTriangulation CreateExplicitTriangulation(vtkPointSet *pointSet,
+                                                    const bool compact,
+                                                    const size_t cacheSize);
+  RegistryTriangulation CreateTriangulation(vtkDataSet *dataSet,
+                                            const bool compact,
+                                            const size_t cacheSize);
   int FindImplicitTriangulation(ttk::Triangulation *&triangulation,
                                 vtkImageData *image);
 
@@ -89,6 +89,8 @@ int ttkBarycentricSubdivision::InterpolateScalarFields(
         TYPE, ttk::Triangulation::Type::IMPLICIT, ttk::ImplicitTriangulation) \
       BARYSUBD_TRIANGL_CALLS(TYPE, ttk::Triangulation::Type::PERIODIC,        \
                              ttk::PeriodicImplicitTriangulation)              \
+      BARYSUBD_TRIANGL_CALLS(                                                 \
+        TYPE, ttk::Triangulation::Type::COMPACT, ttk::CompactTriangulation)   \
     }                                                                         \
     break;
 #define BARYSUBD_TRIANGL_CALLS(DATATYPE, TRIANGL_CASE, TRIANGL_TYPE)          \
@@ -174,7 +176,10 @@ int ttkBarycentricSubdivision::RequestData(vtkInformation *request,
   this->preconditionTriangulation(triangulation);
 
   // first iteration: generate the new triangulation
-  this->execute(*triangulation, triangulationSubdivision);
+  ttkTemplateMacro(
+    triangulation->getType(),
+    this->execute(*static_cast<TTK_TT *>(triangulation->getData()),
+                  triangulationSubdivision));
 
   // first iteration: interpolate input scalar fields
   int ret = InterpolateScalarFields(
@@ -211,7 +216,10 @@ int ttkBarycentricSubdivision::RequestData(vtkInformation *request,
     this->preconditionTriangulation(&tmpTr);
 
     // generate the new triangulation
-    this->execute(*triangulation, triangulationSubdivision);
+    ttkTemplateMacro(
+      triangulation->getType(),
+      this->execute(*static_cast<TTK_TT *>(triangulation->getData()),
+                    triangulationSubdivision));
 
     // interpolate output scalar fields
     InterpolateScalarFields(
@@ -94,18 +94,22 @@ int ttkEigenField::RequestData(vtkInformation *request,
 
   switch(OutputFieldType) {
     case FieldType::FLOAT:
-      res += this->execute<float>(
-        *triangulation,
-        static_cast<float *>(ttkUtils::GetVoidPointer(eigenFunctions)),
-        EigenNumber, ComputeStatistics,
-        static_cast<float *>(ttkUtils::GetVoidPointer(stats)));
+      ttkTemplateMacro(
+        triangulation->getType(),
+        res += this->execute<float>(
+          *static_cast<TTK_TT *>(triangulation->getData()),
+          static_cast<float *>(ttkUtils::GetVoidPointer(eigenFunctions)),
+          EigenNumber, ComputeStatistics,
+          static_cast<float *>(ttkUtils::GetVoidPointer(stats))));
       break;
     case FieldType::DOUBLE:
-      res += this->execute<double>(
-        *triangulation,
-        static_cast<double *>(ttkUtils::GetVoidPointer(eigenFunctions)),
-        EigenNumber, ComputeStatistics,
-        static_cast<double *>(ttkUtils::GetVoidPointer(stats)));
+      ttkTemplateMacro(
+        triangulation->getType(),
+        res += this->execute<double>(
+          *static_cast<TTK_TT *>(triangulation->getData()),
+          static_cast<double *>(ttkUtils::GetVoidPointer(eigenFunctions)),
+          EigenNumber, ComputeStatistics,
+          static_cast<double *>(ttkUtils::GetVoidPointer(stats))));
       break;
     default:
       break;
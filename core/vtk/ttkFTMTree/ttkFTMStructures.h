@@ -17,6 +17,7 @@
 #include <vtkIntArray.h>
 
 #include <ttkMacros.h>
+#include <ttkUtils.h>
 
 namespace ttk {
   namespace ftm {
@@ -230,6 +231,7 @@ namespace ttk {
       vtkSmartPointer<vtkFloatArray> scalars;
       vtkSmartPointer<vtkIntArray> type;
       int scalarType;
+      bool vertIdsCopied{false};
 
       inline int init(std::vector<LocalFTM> &ftmTree, Params params) {
         idNode numberOfNodes = 0;
@@ -259,6 +261,15 @@ namespace ttk {
         scalarType = s;
       }
 
+      // bulk copy of the vertex ids of the nodes, for a single connected
+      // component (local and global vertex ids match)
+      inline void copyVertexIds(const CompactTree &compact) {
+        const auto &vertices = compact.getNodeVertices();
+        std::copy(vertices.begin(), vertices.end(),
+                  static_cast<SimplexId *>(ttkUtils::GetVoidPointer(vertIds)));
+        vertIdsCopied = true;
+      }
+
       inline void fillArrayPoint(SimplexId arrIdx,
                                  const idNode nodeId,
                                  LocalFTM &ftmTree,
@@ -280,7 +291,9 @@ namespace ttk {
 
         ids->SetTuple1(arrIdx, idOffset + nodeId);
         scalars->SetTuple1(arrIdx, cellScalar);
-        vertIds->SetTuple1(arrIdx, g_vertexId);
+        if(!vertIdsCopied) {
+          vertIds->SetTuple1(arrIdx, g_vertexId);
+        }
         type->SetTuple1(
           arrIdx, static_cast<int>(getNodeType(*tree, nodeId, params)));
 
@@ -356,6 +369,7 @@ namespace ttk {
       vtkSmartPointer<ttkSimplexIdTypeArray> sizeRegion;
       vtkSmartPointer<vtkDoubleArray> spanRegion;
       vtkSmartPointer<vtkCharArray> typeRegion;
+      bool idsShared{false};
 
       inline int init(std::vector<LocalFTM> &ftmTrees, Params params) {
         if(!params.segm)
@@ -382,6 +396,20 @@ namespace ttk {
         return 0;
       }
 
+      // zero-copy export of the segmentation ids, for a single connected
+      // component (local and global vertex ids match): the array takes
+      // them over from the compact tree and deletes them
+      inline void shareIds(CompactTree &compact) {
+        SimplexId *const segmentation = compact.releaseVertexSegmentation();
+        if(segmentation == nullptr) {
+          return;
+        }
+        ids->SetArray(
+          segmentation, ids->GetNumberOfTuples(), 0,
+          ttkSimplexIdTypeArray::DeleteMethod::VTK_DATA_ARRAY_DELETE);
+        idsShared = true;
+      }
+
       void fillArrayPoint(const idSuperArc arcId,
                           LocalFTM &l_tree,
                           Triangulation *triangulation,
@@ -442,13 +470,13 @@ namespace ttk {
 
         // fill extrema and regular verts of this arc
 
+        // segmentation id (already set if shared by the compact tree)
+        const SimplexId segmId = idOffset + (params.normalize ? nid : arcId);
+
         // critical points
-        if(params.normalize) {
-          ids->SetTuple1(g_upVertexId, idOffset + nid);
-          ids->SetTuple1(g_downVertexId, idOffset + nid);
-        } else {
-          ids->SetTuple1(g_upVertexId, idOffset + arcId);
-          ids->SetTuple1(g_downVertexId, idOffset + arcId);
+        if(!idsShared) {
+          ids->SetTuple1(g_upVertexId, segmId);
+          ids->SetTuple1(g_downVertexId, segmId);
         }
 
         if(params.advStats) {
@@ -463,10 +491,8 @@ namespace ttk {
         // regular nodes
         for(const SimplexId l_vertexId : *arc) {
           const SimplexId g_vertexId = idMapper->GetTuple1(l_vertexId);
-          if(params.normalize) {
-            ids->SetTuple1(g_vertexId, idOffset + nid);
-          } else {
-            ids->SetTuple1(g_vertexId, idOffset + arcId);
+          if(!idsShared) {
+            ids->SetTuple1(g_vertexId, segmId);
           }
           if(params.advStats) {
             sizeRegion->SetTuple1(g_vertexId, regionSize);
@@ -156,6 +156,8 @@ int ttkFTMTree::RequestData(vtkInformation *request,
     ftmTree_[cc].tree.setTreeType(GetTreeType());
     ftmTree_[cc].tree.setSegmentation(GetWithSegmentation());
     ftmTree_[cc].tree.setNormalizeIds(GetWithNormalize());
+    ftmTree_[cc].tree.setTaskScheduler(GetTaskScheduler());
+    ftmTree_[cc].tree.setCompactStorage(GetCompactStorage());
 
     ttkVtkTemplateMacro(inputArray->GetDataType(),
                         triangulation_[cc]->getType(),
@@ -471,6 +473,10 @@ int ttkFTMTree::getScalars() {
 int ttkFTMTree::getSegmentation(vtkDataSet *outputSegmentation) {
   ttk::ftm::VertData vertData;
   vertData.init(ftmTree_, params_);
+  if(nbCC_ == 1 && GetCompactStorage()) {
+    vertData.shareIds(
+      ftmTree_[0].tree.getTree(GetTreeType())->getCompactTree());
+  }
 
   for(int cc = 0; cc < nbCC_; cc++) {
     auto tree = ftmTree_[cc].tree.getTree(GetTreeType());
@@ -549,6 +555,10 @@ int ttkFTMTree::getSkeletonNodes(vtkUnstructuredGrid *outputSkeletonNodes) {
   ttk::ftm::NodeData nodeData;
   nodeData.init(ftmTree_, params_);
   nodeData.setScalarType(inputScalars_[0]->GetDataType());
+  if(nbCC_ == 1 && GetCompactStorage()) {
+    nodeData.copyVertexIds(
+      ftmTree_[0].tree.getTree(GetTreeType())->getCompactTree());
+  }
 
   for(int cc = 0; cc < nbCC_; cc++) {
     auto tree = ftmTree_[cc].tree.getTree(GetTreeType());
@@ -71,6 +71,24 @@ public:
     return params_.samplingLvl;
   }
 
+  void SetTaskScheduler(const int scheduler) {
+    params_.scheduler = (ttk::ftm::TaskScheduler)scheduler;
+    Modified();
+  }
+
+  ttk::ftm::TaskScheduler GetTaskScheduler(void) const {
+    return params_.scheduler;
+  }
+
+  void SetCompactStorage(const bool compact) {
+    params_.compact = compact;
+    Modified();
+  }
+
+  bool GetCompactStorage(void) const {
+    return params_.compact;
+  }
+
   int preconditionTriangulation();
   int getScalars();
   int getOffsets();
@@ -1,5 +1,6 @@
 #include <ttkGeometrySmoother.h>
 
+#include <ttkMacros.h>
 #include <ttkUtils.h>
 #include <vtkInformation.h>
 
@@ -69,10 +70,10 @@ int ttkGeometrySmoother::RequestData(vtkInformation *request,
     this->setMaskDataPointer(ttkUtils::GetVoidPointer(inputMaskField));
   }
 
-  switch(outputPoints->GetDataType()) {
-    vtkTemplateMacro(
-      this->smooth<VTK_TT>(triangulation->getData(), this->NumberOfIterations));
-  }
+  ttkVtkTemplateMacro(
+    outputPoints->GetDataType(), triangulation->getType(),
+    (this->smooth<VTK_TT, TTK_TT>(
+      (TTK_TT *)triangulation->getData(), this->NumberOfIterations)));
 
   return 1;
 }
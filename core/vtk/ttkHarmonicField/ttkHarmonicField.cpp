@@ -105,18 +105,22 @@ int ttkHarmonicField::RequestData(vtkInformation *request,
 
   switch(OutputScalarFieldType) {
     case FieldType::FLOAT:
-      res = this->execute<float>(
-        *triangulation, nSources, vertsid,
-        static_cast<float *>(ttkUtils::GetVoidPointer(inputField)),
-        static_cast<float *>(ttkUtils::GetVoidPointer(outputField)),
-        UseCotanWeights, SolvingMethod, LogAlpha);
+      ttkTemplateMacro(
+        triangulation->getType(),
+        res = this->execute<float>(
+          *static_cast<TTK_TT *>(triangulation->getData()), nSources, vertsid,
+          static_cast<float *>(ttkUtils::GetVoidPointer(inputField)),
+          static_cast<float *>(ttkUtils::GetVoidPointer(outputField)),
+          UseCotanWeights, SolvingMethod, LogAlpha));
       break;
     case FieldType::DOUBLE:
-      res = this->execute<double>(
-        *triangulation, nSources, vertsid,
-        static_cast<double *>(ttkUtils::GetVoidPointer(inputField)),
-        static_cast<double *>(ttkUtils::GetVoidPointer(outputField)),
-        UseCotanWeights, SolvingMethod, LogAlpha);
+      ttkTemplateMacro(
+        triangulation->getType(),
+        res = this->execute<double>(
+          *static_cast<TTK_TT *>(triangulation->getData()), nSources, vertsid,
+          static_cast<double *>(ttkUtils::GetVoidPointer(inputField)),
+          static_cast<double *>(ttkUtils::GetVoidPointer(outputField)),
+          UseCotanWeights, SolvingMethod, LogAlpha));
       break;
     default:
       break;
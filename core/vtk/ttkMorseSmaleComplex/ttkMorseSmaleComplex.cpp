@@ -77,6 +77,7 @@ int ttkMorseSmaleComplex::dispatch(vtkDataArray *const inputScalars,
   separatrices1_points_smoothingMask.clear();
   separatrices1_points_cellDimensions.clear();
   separatrices1_points_cellIds.clear();
+  separatrices1_cells_offsets.clear();
   separatrices1_cells_connectivity.clear();
   separatrices1_cells_sourceIds.clear();
   separatrices1_cells_destinationIds.clear();
@@ -315,19 +316,21 @@ int ttkMorseSmaleComplex::dispatch(vtkDataArray *const inputScalars,
     isOnBoundary->SetName("NumberOfCriticalPointsOnBoundary");
     setArray(isOnBoundary, separatrices1_cells_isOnBoundary);
 
-    vtkNew<ttkSimplexIdTypeArray> offsets{}, connectivity{};
-    offsets->SetNumberOfComponents(1);
-    offsets->SetNumberOfTuples(s1_numberOfCells + 1);
-    connectivity->SetNumberOfComponents(1);
-    setArray(connectivity, separatrices1_cells_connectivity);
-
+    // lines of two points
+    separatrices1_cells_offsets.resize(s1_numberOfCells + 1);
 #ifdef TTK_ENABLE_OPENMP
 #pragma omp parallel for num_threads(this->threadNumber_)
 #endif // TTK_ENABLE_OPENMP
     for(SimplexId i = 0; i < s1_numberOfCells + 1; ++i) {
-      offsets->SetTuple1(i, 2 * i);
+      separatrices1_cells_offsets[i] = 2 * i;
     }
 
+    vtkNew<ttkSimplexIdTypeArray> offsets{}, connectivity{};
+    offsets->SetNumberOfComponents(1);
+    setArray(offsets, separatrices1_cells_offsets);
+    connectivity->SetNumberOfComponents(1);
+    setArray(connectivity, separatrices1_cells_connectivity);
+
     vtkNew<vtkPoints> points{};
     points->SetData(pointsCoords);
     outputSeparatrices1->SetPoints(points);
@@ -563,13 +566,18 @@ int ttkMorseSmaleComplex::RequestData(vtkInformation *request,
   this->setComputeAscendingSeparatrices2(ComputeAscendingSeparatrices2);
   this->setComputeDescendingSeparatrices2(ComputeDescendingSeparatrices2);
 
+  this->setPointerJumpingSegmentation(PointerJumpingSegmentation);
+
   this->setReturnSaddleConnectors(ReturnSaddleConnectors);
   this->setSaddleConnectorsPersistenceThreshold(
     SaddleConnectorsPersistenceThreshold);
+  this->setSaddleConnectorsHierarchy(SaddleConnectorsHierarchy);
 
   this->setInputScalarField(ttkUtils::GetVoidPointer(inputScalars));
   this->setInputOffsets(
     static_cast<SimplexId *>(ttkUtils::GetVoidPointer(inputOffsets)));
+  // reuse the discrete gradient while the input arrays are not modified
+  this->setInputTimeStamp(inputScalars->GetMTime(), inputOffsets->GetMTime());
 
   void *ascendingManifoldPtr = nullptr;
   void *descendingManifoldPtr = nullptr;
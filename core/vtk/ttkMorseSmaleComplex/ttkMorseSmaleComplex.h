@@ -104,12 +104,18 @@ public:
   vtkSetMacro(ComputeFinalSegmentation, bool);
   vtkGetMacro(ComputeFinalSegmentation, bool);
 
+  vtkSetMacro(PointerJumpingSegmentation, bool);
+  vtkGetMacro(PointerJumpingSegmentation, bool);
+
   vtkSetMacro(ReturnSaddleConnectors, int);
   vtkGetMacro(ReturnSaddleConnectors, int);
 
   vtkSetMacro(SaddleConnectorsPersistenceThreshold, double);
   vtkGetMacro(SaddleConnectorsPersistenceThreshold, double);
 
+  vtkSetMacro(SaddleConnectorsHierarchy, bool);
+  vtkGetMacro(SaddleConnectorsHierarchy, bool);
+
 protected:
   template <typename scalarType, typename triangulationType>
   int dispatch(vtkDataArray *const inputScalars,
@@ -139,8 +145,10 @@ private:
   bool ComputeAscendingSegmentation{true};
   bool ComputeDescendingSegmentation{true};
   bool ComputeFinalSegmentation{true};
+  bool PointerJumpingSegmentation{false};
   int ReturnSaddleConnectors{false};
   double SaddleConnectorsPersistenceThreshold{0.0};
+  bool SaddleConnectorsHierarchy{false};
 
   // critical points
   std::vector<std::array<float, 3>> criticalPoints_points{};
@@ -155,6 +163,7 @@ private:
   std::vector<char> separatrices1_points_smoothingMask{};
   std::vector<char> separatrices1_points_cellDimensions{};
   std::vector<ttk::SimplexId> separatrices1_points_cellIds{};
+  std::vector<ttk::SimplexId> separatrices1_cells_offsets{};
   std::vector<ttk::SimplexId> separatrices1_cells_connectivity{};
   std::vector<ttk::SimplexId> separatrices1_cells_sourceIds{};
   std::vector<ttk::SimplexId> separatrices1_cells_destinationIds{};
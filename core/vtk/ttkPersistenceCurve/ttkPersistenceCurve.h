@@ -67,6 +67,9 @@ public:
   vtkSetMacro(ComputeSaddleConnectors, bool);
   vtkGetMacro(ComputeSaddleConnectors, bool);
 
+  vtkSetMacro(MinimumPersistence, double);
+  vtkGetMacro(MinimumPersistence, double);
+
   vtkTable *GetOutput();
   vtkTable *GetOutput(int);
 
@@ -86,6 +86,9 @@ public:
   vtkSetMacro(ComputeSaddleConnectors, bool);
   vtkGetMacro(ComputeSaddleConnectors, bool);
 
+  vtkSetMacro(MinimumPersistence, double);
+  vtkGetMacro(MinimumPersistence, double);
+
   vtkSetMacro(ShowInsideDomain, bool);
   vtkGetMacro(ShowInsideDomain, bool);
 
@@ -16,6 +16,19 @@
 
 vtkStandardNewMacro(ttkPointMerger);
 
+namespace {
+  template <typename triangulationType>
+  void getBoundaryVertices(const triangulationType &triangulation,
+                           std::vector<ttk::SimplexId> &boundaryVertices) {
+    const ttk::SimplexId vertexNumber = triangulation.getNumberOfVertices();
+    for(ttk::SimplexId i = 0; i < vertexNumber; i++) {
+      if(triangulation.isVertexOnBoundary(i)) {
+        boundaryVertices.push_back(i);
+      }
+    }
+  }
+} // namespace
+
 ttkPointMerger::ttkPointMerger() {
   this->setDebugMsgPrefix("PointMerger");
   this->SetNumberOfInputPorts(1);
@@ -62,11 +75,10 @@ int ttkPointMerger::RequestData(vtkInformation *request,
   std::vector<SimplexId> candidateVertices;
 
   if(BoundaryOnly) {
-    for(SimplexId i = 0; i < vertexNumber; i++) {
-      if(triangulation->isVertexOnBoundary(i)) {
-        candidateVertices.push_back(i);
-      }
-    }
+    ttkTemplateMacro(
+      triangulation->getType(),
+      getBoundaryVertices(
+        *static_cast<TTK_TT *>(triangulation->getData()), candidateVertices));
   } else {
     candidateVertices.resize(vertexNumber);
     for(SimplexId i = 0; i < vertexNumber; i++)
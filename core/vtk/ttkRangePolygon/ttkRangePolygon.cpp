@@ -153,10 +153,10 @@ int ttkRangePolygon::processTriangles(vtkUnstructuredGrid *input,
     smoother.setOutputDataPointer(output->GetPoints()->GetVoidPointer(0));
     smoother.preconditionTriangulation(triangulation);
 
-    switch(output->GetPoints()->GetDataType()) {
-      vtkTemplateMacro(
-        smoother.smooth<VTK_TT>(triangulation, NumberOfIterations));
-    }
+    ttkVtkTemplateMacro(
+      output->GetPoints()->GetDataType(), triangulation->getType(),
+      (smoother.smooth<VTK_TT, TTK_TT>(
+        (TTK_TT *)triangulation->getData(), NumberOfIterations)));
 
     for(int i = 0; i < output->GetPointData()->GetNumberOfArrays(); i++) {
       vtkDataArray *field = output->GetPointData()->GetArray(i);
@@ -169,10 +169,10 @@ int ttkRangePolygon::processTriangles(vtkUnstructuredGrid *input,
       smoother.setOutputDataPointer(field->GetVoidPointer(0));
       smoother.preconditionTriangulation(triangulation);
 
-      switch(field->GetDataType()) {
-        vtkTemplateMacro(
-          smoother.smooth<VTK_TT>(triangulation, NumberOfIterations));
-      }
+      ttkVtkTemplateMacro(
+        field->GetDataType(), triangulation->getType(),
+        (smoother.smooth<VTK_TT, TTK_TT>(
+          (TTK_TT *)triangulation->getData(), NumberOfIterations)));
     }
   }
 
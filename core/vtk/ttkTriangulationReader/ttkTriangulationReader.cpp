@@ -76,8 +76,8 @@ int ttkTriangulationReader::RequestData(vtkInformation *request,
   if(!this->validateFilePath()) {
     return 0;
   }
-  std::ifstream in(this->TriangulationFilePath);
-  explTri->readFromFile(in);
+  // memory-mapped when possible
+  explTri->readFromFile(this->TriangulationFilePath);
 
   this->printMsg("Restored triangulation from " + this->TriangulationFilePath,
                  1.0, timer.getElapsedTime(), 1);
@@ -27,19 +27,6 @@ int ttkTriangulationWriter::FillInputPortInformation(int port,
   return 0;
 }
 
-int ttkTriangulationWriter::OpenFile() {
-
-  std::ofstream f(Filename, std::ios::out | std::ios::binary);
-
-  if(!f.fail()) {
-    Stream = std::move(f);
-  } else {
-    return -1;
-  }
-
-  return 0;
-}
-
 template <typename T>
 void writeBin(std::ofstream &stream, const T var) {
   stream.write(reinterpret_cast<const char *>(&var), sizeof(var));
@@ -68,14 +55,11 @@ int ttkTriangulationWriter::Write() {
   const auto explTri
     = static_cast<ttk::ExplicitTriangulation *>(triangulation->getData());
 
-  if(this->OpenFile() == -1) {
-    this->printErr("Could not open file `" + std::string{Filename} + "' :(");
+  if(explTri->writeToFile(std::string{Filename}) != 0) {
+    this->printErr("Could not write file `" + std::string{Filename} + "' :(");
     return 1;
   }
 
-  explTri->writeToFile(this->Stream);
-  this->Stream.flush();
-
   this->printMsg("Wrote triangulation to " + std::string{this->Filename}, 1.0,
                  tm.getElapsedTime(), 1);
 
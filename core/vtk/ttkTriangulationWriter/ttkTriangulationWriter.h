@@ -35,10 +35,7 @@ protected:
   ttkTriangulationWriter();
   int FillInputPortInformation(int port, vtkInformation *info) override;
 
-  int OpenFile();
-
   char *Filename{};
-  std::ofstream Stream{};
 
 private:
   ttkTriangulationWriter(const ttkTriangulationWriter &) = delete;
@@ -0,0 +1,403 @@
+/// \author agent <agent@local>.
+/// \date October 2026.
+///
+/// \brief Check and benchmark of the compact triangulation (see
+/// ttk::CompactTriangulation).
+///
+/// Tetrahedralizes a regular grid (6 tetrahedra per voxel, with optionally
+/// shuffled vertex identifiers), stores it both as an explicit and as a compact
+/// triangulation, and compares every relation of the two representations
+/// (the edge and triangle identifiers differ, they are matched through
+/// their vertices). The comparison runs in parallel with a small relation
+/// cache, to exercise the cluster evictions. The program then reports the
+/// pre-conditioning time, the memory footprint and the time of a full
+/// traversal of both representations. It returns a non-zero value if the
+/// relations differ.
+
+// TTK Includes
+#include <CommandLineParser.h>
+#include <Triangulation.h>
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+
+namespace {
+
+  using ttk::SimplexId;
+  using Getter = int (ttk::Triangulation::*)(const SimplexId &,
+                                             const int &,
+                                             SimplexId &) const;
+  using Counter = SimplexId (ttk::Triangulation::*)(const SimplexId &) const;
+  using Boundary = bool (ttk::Triangulation::*)(const SimplexId &) const;
+
+  struct Relation {
+    std::string name;
+    // dimensions of the source and target simplices
+    int source, target;
+    Counter count;
+    Getter get;
+  };
+
+  const std::vector<Relation> relations{
+    {"VertexNeighbors", 0, 0, &ttk::Triangulation::getVertexNeighborNumber,
+     &ttk::Triangulation::getVertexNeighbor},
+    {"VertexEdges", 0, 1, &ttk::Triangulation::getVertexEdgeNumber,
+     &ttk::Triangulation::getVertexEdge},
+    {"VertexTriangles", 0, 2, &ttk::Triangulation::getVertexTriangleNumber,
+     &ttk::Triangulation::getVertexTriangle},
+    {"VertexStars", 0, 3, &ttk::Triangulation::getVertexStarNumber,
+     &ttk::Triangulation::getVertexStar},
+    {"VertexLinks", 0, 2, &ttk::Triangulation::getVertexLinkNumber,
+     &ttk::Triangulation::getVertexLink},
+    {"EdgeTriangles", 1, 2, &ttk::Triangulation::getEdgeTriangleNumber,
+     &ttk::Triangulation::getEdgeTriangle},
+    {"EdgeStars", 1, 3, &ttk::Triangulation::getEdgeStarNumber,
+     &ttk::Triangulation::getEdgeStar},
+    {"EdgeLinks", 1, 1, &ttk::Triangulation::getEdgeLinkNumber,
+     &ttk::Triangulation::getEdgeLink},
+    {"TriangleEdges", 2, 1, &ttk::Triangulation::getTriangleEdgeNumber,
+     &ttk::Triangulation::getTriangleEdge},
+    {"TriangleStars", 2, 3, &ttk::Triangulation::getTriangleStarNumber,
+     &ttk::Triangulation::getTriangleStar},
+    {"TriangleLinks", 2, 0, &ttk::Triangulation::getTriangleLinkNumber,
+     &ttk::Triangulation::getTriangleLink},
+    {"CellNeighbors", 3, 3, &ttk::Triangulation::getCellNeighborNumber,
+     &ttk::Triangulation::getCellNeighbor},
+    {"CellEdges", 3, 1, &ttk::Triangulation::getCellEdgeNumber,
+     &ttk::Triangulation::getCellEdge},
+    {"CellTriangles", 3, 2, &ttk::Triangulation::getCellTriangleNumber,
+     &ttk::Triangulation::getCellTriangle},
+  };
+
+  const std::vector<Boundary> boundaries{
+    &ttk::Triangulation::isVertexOnBoundary,
+    &ttk::Triangulation::isEdgeOnBoundary,
+    &ttk::Triangulation::isTriangleOnBoundary,
+  };
+
+  void precondition(ttk::Triangulation &triangulation) {
+    triangulation.preconditionBoundaryVertices();
+    triangulation.preconditionBoundaryEdges();
+    triangulation.preconditionBoundaryTriangles();
+    triangulation.preconditionVertexNeighbors();
+    triangulation.preconditionVertexEdges();
+    triangulation.preconditionVertexTriangles();
+    triangulation.preconditionVertexStars();
+    triangulation.preconditionVertexLinks();
+    triangulation.preconditionEdges();
+    triangulation.preconditionEdgeTriangles();
+    triangulation.preconditionEdgeStars();
+    triangulation.preconditionEdgeLinks();
+    triangulation.preconditionTriangles();
+    triangulation.preconditionTriangleEdges();
+    triangulation.preconditionTriangleStars();
+    triangulation.preconditionTriangleLinks();
+    triangulation.preconditionCellNeighbors();
+    triangulation.preconditionCellEdges();
+    triangulation.preconditionCellTriangles();
+  }
+
+  SimplexId simplexNumber(const ttk::Triangulation &triangulation,
+                          const int dimension) {
+    switch(dimension) {
+      case 0:
+        return triangulation.getNumberOfVertices();
+      case 1:
+        return triangulation.getNumberOfEdges();
+      case 2:
+        return triangulation.getNumberOfTriangles();
+      default:
+        return triangulation.getNumberOfCells();
+    }
+  }
+
+  // sorted vertices of the edges or triangles
+  template <size_t n>
+  std::vector<std::array<SimplexId, n>>
+    simplexVertices(const ttk::Triangulation &triangulation) {
+    std::vector<std::array<SimplexId, n>> res(
+      simplexNumber(triangulation, n - 1));
+    for(size_t i = 0; i < res.size(); ++i) {
+      for(size_t j = 0; j < n; ++j) {
+        if(n == 2) {
+          triangulation.getEdgeVertex(i, j, res[i][j]);
+        } else {
+          triangulation.getTriangleVertex(i, j, res[i][j]);
+        }
+      }
+      std::sort(res[i].begin(), res[i].end());
+    }
+    return res;
+  }
+
+  // for each simplex of b, the identifier of the same simplex in a (-1 if
+  // not found)
+  template <size_t n>
+  std::vector<SimplexId>
+    matchSimplices(const std::vector<std::array<SimplexId, n>> &a,
+                   const std::vector<std::array<SimplexId, n>> &b) {
+    std::vector<std::pair<std::array<SimplexId, n>, SimplexId>> sorted(
+      a.size());
+    for(size_t i = 0; i < a.size(); ++i) {
+      sorted[i] = {a[i], i};
+    }
+    std::sort(sorted.begin(), sorted.end());
+    std::vector<SimplexId> res(b.size(), -1);
+    for(size_t i = 0; i < b.size(); ++i) {
+      const auto it = std::lower_bound(
+        sorted.begin(), sorted.end(), std::make_pair(b[i], SimplexId{-1}));
+      if(it != sorted.end() && it->first == b[i]) {
+        res[i] = it->second;
+      }
+    }
+    return res;
+  }
+
+  std::vector<SimplexId> listRelation(const ttk::Triangulation &triangulation,
+                                      const Relation &relation,
+                                      const SimplexId id) {
+    std::vector<SimplexId> res((triangulation.*relation.count)(id));
+    for(size_t i = 0; i < res.size(); ++i) {
+      (triangulation.*relation.get)(id, i, res[i]);
+    }
+    return res;
+  }
+
+  SimplexId traverse(const ttk::Triangulation &triangulation) {
+    SimplexId sum{};
+    for(const auto &relation : relations) {
+      const auto n = simplexNumber(triangulation, relation.source);
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(ttk::globalThreadNumber_) \
+  reduction(+ : sum)
+#endif // TTK_ENABLE_OPENMP
+      for(SimplexId i = 0; i < n; ++i) {
+        const auto list = listRelation(triangulation, relation, i);
+        sum += std::accumulate(list.begin(), list.end(), SimplexId{});
+      }
+    }
+    return sum;
+  }
+
+} // namespace
+
+int main(int argc, char **argv) {
+
+  std::vector<int> dimensions;
+  int seed{0};
+  int checkCacheSize{8};
+  int repetitions{3};
+
+  {
+    ttk::CommandLineParser parser;
+
+    parser.setArgument("g", &dimensions,
+                       "Grid dimensions (number of vertices, repeat the "
+                       "option for each axis, default: 24)",
+                       true);
+    parser.setArgument(
+      "s", &seed, "Seed of the vertex shuffle (default: 0, no shuffle)", true);
+    parser.setArgument("m", &checkCacheSize,
+                       "Cache size of the check (MiB, default: 8)", true);
+    parser.setArgument("r", &repetitions, "Number of repetitions", true);
+
+    parser.parse(argc, argv);
+  }
+
+  ttk::Debug msg;
+  msg.setDebugMsgPrefix("CompactTriangulationBenchmark");
+
+  if(dimensions.empty()) {
+    dimensions = {24};
+  }
+  dimensions.resize(3, dimensions.back());
+  const auto &nx = dimensions[0], &ny = dimensions[1], &nz = dimensions[2];
+  const SimplexId nVerts = nx * ny * nz;
+
+  // vertex identifiers (in the grid order, or shuffled)
+  std::vector<SimplexId> ids(nVerts);
+  std::iota(ids.begin(), ids.end(), 0);
+  if(seed != 0) {
+    std::mt19937 generator(seed);
+    std::shuffle(ids.begin(), ids.end(), generator);
+  }
+
+  std::vector<float> points(3 * nVerts);
+  for(int k = 0; k < nz; ++k) {
+    for(int j = 0; j < ny; ++j) {
+      for(int i = 0; i < nx; ++i) {
+        const auto v = ids[i + nx * (j + ny * k)];
+        points[3 * v] = i;
+        points[3 * v + 1] = j;
+        points[3 * v + 2] = k;
+      }
+    }
+  }
+
+  // 6 tetrahedra around the diagonal of each voxel
+  const int tets[6][4] = {{0, 1, 3, 7}, {0, 1, 5, 7}, {0, 2, 3, 7},
+                          {0, 2, 6, 7}, {0, 4, 5, 7}, {0, 4, 6, 7}};
+  std::vector<ttk::LongSimplexId> connectivity{}, offsets{0};
+  for(int k = 0; k < nz - 1; ++k) {
+    for(int j = 0; j < ny - 1; ++j) {
+      for(int i = 0; i < nx - 1; ++i) {
+        std::array<SimplexId, 8> corners{};
+        for(int c = 0; c < 8; ++c) {
+          corners[c] = ids[(i + (c & 1)) + nx * ((j + ((c >> 1) & 1))
+                                                 + ny * (k + ((c >> 2) & 1)))];
+        }
+        for(const auto &tet : tets) {
+          for(const auto c : tet) {
+            connectivity.emplace_back(corners[c]);
+          }
+          offsets.emplace_back(connectivity.size());
+        }
+      }
+    }
+  }
+  const SimplexId nCells = offsets.size() - 1;
+
+#ifndef TTK_CELL_ARRAY_NEW
+  // legacy layout: number of vertices followed by the vertex identifiers
+  std::vector<ttk::LongSimplexId> cellArray{};
+  for(SimplexId c = 0; c < nCells; ++c) {
+    cellArray.emplace_back(4);
+    cellArray.insert(cellArray.end(), connectivity.begin() + offsets[c],
+                     connectivity.begin() + offsets[c + 1]);
+  }
+#endif // TTK_CELL_ARRAY_NEW
+
+  msg.printMsg("Mesh: " + std::to_string(nVerts) + " vertices, "
+               + std::to_string(nCells) + " tetrahedra");
+
+  std::array<ttk::Triangulation, 2> triangulations{};
+  const std::array<std::string, 2> names{"explicit", "compact"};
+  for(size_t i = 0; i < triangulations.size(); ++i) {
+    auto &triangulation = triangulations[i];
+    triangulation.setDebugLevel(0);
+    triangulation.setThreadNumber(ttk::globalThreadNumber_);
+    triangulation.setCompactTriangulation(
+      i == 1, static_cast<size_t>(checkCacheSize) << 20);
+    triangulation.setInputPoints(nVerts, points.data());
+#ifdef TTK_CELL_ARRAY_NEW
+    triangulation.setInputCells(nCells, connectivity.data(), offsets.data());
+#else
+    triangulation.setInputCells(nCells, cellArray.data());
+#endif // TTK_CELL_ARRAY_NEW
+
+    ttk::Timer tm{};
+    precondition(triangulation);
+    msg.printMsg(
+      "[" + names[i] + "] Pre-conditioning", 1.0, tm.getElapsedTime());
+  }
+
+  const auto &ex = triangulations[0];
+  const auto &co = triangulations[1];
+
+  // 1. compare the relations
+  ttk::Timer tm{};
+  size_t nErrors{};
+  for(int i = 0; i < 4; ++i) {
+    if(simplexNumber(ex, i) != simplexNumber(co, i)) {
+      msg.printErr("Different number of " + std::to_string(i) + "-simplices");
+      return EXIT_FAILURE;
+    }
+  }
+
+  // compact identifier -> explicit identifier, per simplex dimension
+  std::array<std::vector<SimplexId>, 4> toExplicit{};
+  toExplicit[0].resize(nVerts);
+  std::iota(toExplicit[0].begin(), toExplicit[0].end(), 0);
+  toExplicit[1]
+    = matchSimplices(simplexVertices<2>(ex), simplexVertices<2>(co));
+  toExplicit[2]
+    = matchSimplices(simplexVertices<3>(ex), simplexVertices<3>(co));
+  toExplicit[3].resize(nCells);
+  std::iota(toExplicit[3].begin(), toExplicit[3].end(), 0);
+  for(int i = 1; i < 3; ++i) {
+    if(std::count(toExplicit[i].begin(), toExplicit[i].end(), -1) > 0) {
+      msg.printErr(std::to_string(i) + "-simplices do not match");
+      return EXIT_FAILURE;
+    }
+  }
+
+  for(const auto &relation : relations) {
+    size_t nRelationErrors{};
+    const auto &source = toExplicit[relation.source];
+    const auto &target = toExplicit[relation.target];
+    const auto n = simplexNumber(co, relation.source);
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(ttk::globalThreadNumber_) \
+  schedule(dynamic, 64) reduction(+ : nRelationErrors)
+#endif // TTK_ENABLE_OPENMP
+    for(SimplexId i = 0; i < n; ++i) {
+      auto expected = listRelation(ex, relation, source[i]);
+      auto found = listRelation(co, relation, i);
+      for(auto &id : found) {
+        id = target[id];
+      }
+      std::sort(expected.begin(), expected.end());
+      std::sort(found.begin(), found.end());
+      if(expected != found) {
+        nRelationErrors++;
+      }
+    }
+
+    if(nRelationErrors > 0) {
+      msg.printErr(relation.name + ": " + std::to_string(nRelationErrors)
+                   + " mismatch(es)");
+    }
+    nErrors += nRelationErrors;
+  }
+
+  for(int d = 0; d < 3; ++d) {
+    const auto &source = toExplicit[d];
+    const auto n = simplexNumber(co, d);
+    size_t nBoundaryErrors{};
+    for(SimplexId i = 0; i < n; ++i) {
+      if((ex.*boundaries[d])(source[i]) != (co.*boundaries[d])(i)) {
+        nBoundaryErrors++;
+      }
+    }
+    if(nBoundaryErrors > 0) {
+      msg.printErr("Boundary " + std::to_string(d) + "-simplices: "
+                   + std::to_string(nBoundaryErrors) + " mismatch(es)");
+    }
+    nErrors += nBoundaryErrors;
+  }
+
+  msg.printMsg("Compared the relations (" + std::to_string(nErrors)
+                 + " mismatch(es))",
+               1.0, tm.getElapsedTime());
+
+  msg.printMsg("[compact] Footprint with a " + std::to_string(checkCacheSize)
+               + " MiB cache: " + std::to_string(co.footprint(true))
+               + " bytes");
+
+  // 2. traversals with the default cache
+  triangulations[1].setCompactTriangulation(true);
+  for(size_t i = 0; i < triangulations.size(); ++i) {
+    double best{-1};
+    SimplexId sum{};
+    for(int j = 0; j < repetitions; ++j) {
+      tm.reStart();
+      sum += traverse(triangulations[i]);
+      const double elapsed = tm.getElapsedTime();
+      if(best < 0 || elapsed < best) {
+        best = elapsed;
+      }
+    }
+    msg.printMsg("[" + names[i] + "] Traversal", 1.0, best);
+    // (the sums differ: the edge and triangle identifiers are not the same)
+    msg.printMsg("[" + names[i] + "] Sum of the identifiers: "
+                   + std::to_string(sum),
+                 ttk::debug::Priority::DETAIL);
+    msg.printMsg("[" + names[i] + "] Footprint: "
+                 + std::to_string(triangulations[i].footprint(true))
+                 + " bytes");
+  }
+
+  return nErrors > 0 ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,221 @@
+/// \author agent <agent@local>.
+/// \date October 2026.
+///
+/// \brief Benchmark of the distributed contour tree (see
+/// ttk::DistributedContourTree).
+///
+/// Splits a regular grid into slabs of vertices (one per process, sharing
+/// their boundary layer and with optional ghost layers), computes the
+/// contour tree and the persistence diagram of a noisy synthetic scalar
+/// field over all the processes and reports the running time. The first
+/// process then checks both results against ttk::PersistenceDiagram (FTM
+/// backend) and ttk::ftm::FTMTree on the whole grid.
+///
+/// Run with mpirun -np N when TTK is built with TTK_ENABLE_MPI.
+
+// TTK Includes
+#include <CommandLineParser.h>
+#include <DistributedContourTree.h>
+#include <ImplicitTriangulation.h>
+#include <PersistenceDiagram.h>
+
+#include <cmath>
+#include <cstdint>
+#include <tuple>
+
+namespace {
+
+  // smooth field with random noise, defined on the whole grid so that each
+  // process computes its own piece
+  double field(const std::vector<int> &dimensions,
+               const ttk::SimplexId vertexId,
+               const double noise,
+               const int seed) {
+    const auto x = vertexId % dimensions[0];
+    const auto y = (vertexId / dimensions[0]) % dimensions[1];
+    const auto z = vertexId / (dimensions[0] * dimensions[1]);
+    // splitmix64 hash of the vertex identifier
+    std::uint64_t h = static_cast<std::uint64_t>(vertexId)
+                      + static_cast<std::uint64_t>(seed) * 0x9e3779b97f4a7c15;
+    h = (h ^ (h >> 30)) * 0xbf58476d1ce4e5b9;
+    h = (h ^ (h >> 27)) * 0x94d049bb133111eb;
+    h = h ^ (h >> 31);
+    return std::sin(0.2 * x) * std::cos(0.15 * y) * std::sin(0.1 * z + 0.2)
+           + noise * static_cast<double>(h >> 11) / (1ULL << 53);
+  }
+
+  // the global pair may be given by either tree
+  std::tuple<ttk::SimplexId, ttk::SimplexId, ttk::SimplexId, ttk::SimplexId,
+             double, ttk::SimplexId>
+    toTuple(const ttk::PersistencePair &p) {
+    const bool global = p.birthType == ttk::CriticalType::Local_minimum
+                        && p.deathType == ttk::CriticalType::Local_maximum;
+    return std::make_tuple(p.birth, static_cast<ttk::SimplexId>(p.birthType),
+                           p.death, static_cast<ttk::SimplexId>(p.deathType),
+                           p.persistence, global ? 0 : p.pairType);
+  }
+
+} // namespace
+
+int main(int argc, char **argv) {
+
+#ifdef TTK_ENABLE_MPI
+  MPI_Init(&argc, &argv);
+#endif // TTK_ENABLE_MPI
+
+  std::vector<int> dimensions;
+  int ghostLayers{0};
+  int seed{0};
+  double noise{0.5};
+
+  {
+    ttk::CommandLineParser parser;
+
+    parser.setArgument("g", &dimensions,
+                       "Grid dimensions (number of vertices, default: 65^3)",
+                       true);
+    parser.setArgument(
+      "l", &ghostLayers, "Number of ghost layers of the slabs", true);
+    parser.setArgument("n", &noise, "Amplitude of the random noise", true);
+    parser.setArgument("s", &seed, "Seed of the random noise", true);
+
+    parser.parse(argc, argv);
+  }
+
+  int rank{0}, nRanks{1};
+#ifdef TTK_ENABLE_MPI
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &nRanks);
+#endif // TTK_ENABLE_MPI
+
+  const int threadNumber = ttk::globalThreadNumber_;
+  ttk::Debug msg;
+  msg.setDebugMsgPrefix("DistributedContourTreeBenchmark");
+  if(rank != 0) {
+    msg.setDebugLevel(0);
+  }
+
+  if(dimensions.empty()) {
+    dimensions = {65, 65, 65};
+  }
+  dimensions.resize(3, 1);
+  msg.printMsg("Grid: " + std::to_string(dimensions[0]) + "x"
+               + std::to_string(dimensions[1]) + "x"
+               + std::to_string(dimensions[2]) + ", "
+               + std::to_string(nRanks) + " process(es)");
+
+  // slab of the process along the last dimension
+  const int d = dimensions[2] > 1 ? 2 : 1;
+  std::array<ttk::SimplexId, 6> extent{
+    0, dimensions[0] - 1, 0, dimensions[1] - 1, 0, dimensions[2] - 1};
+  const ttk::SimplexId nLayers = dimensions[d] - 1;
+  extent[2 * d] = std::max<ttk::SimplexId>(
+    0, rank * nLayers / nRanks - ghostLayers);
+  extent[2 * d + 1] = std::min<ttk::SimplexId>(
+    nLayers, (rank + 1) * nLayers / nRanks + ghostLayers);
+
+  std::vector<double> scalars{};
+  for(ttk::SimplexId z = extent[4]; z <= extent[5]; ++z) {
+    for(ttk::SimplexId y = extent[2]; y <= extent[3]; ++y) {
+      for(ttk::SimplexId x = extent[0]; x <= extent[1]; ++x) {
+        const ttk::SimplexId vertexId
+          = x + dimensions[0] * (y + dimensions[1] * z);
+        scalars.emplace_back(field(dimensions, vertexId, noise, seed));
+      }
+    }
+  }
+
+  ttk::DistributedContourTree distributedContourTree;
+  if(rank != 0) {
+    distributedContourTree.setDebugLevel(0);
+  }
+  distributedContourTree.setThreadNumber(threadNumber);
+  distributedContourTree.setGlobalDimensions(
+    {dimensions[0], dimensions[1], dimensions[2]});
+  distributedContourTree.setLocalExtent(extent);
+
+  std::vector<ttk::PersistencePair> diagram{};
+  std::vector<std::pair<ttk::SimplexId, ttk::SimplexId>> contourTree{};
+#ifdef TTK_ENABLE_MPI
+  MPI_Barrier(MPI_COMM_WORLD);
+#endif // TTK_ENABLE_MPI
+  ttk::Timer tm{};
+  distributedContourTree.execute(diagram, contourTree, scalars.data());
+  const double elapsed = tm.getElapsedTime();
+
+  if(rank == 0) {
+    msg.printMsg("Distributed: " + std::to_string(diagram.size()) + " pairs, "
+                   + std::to_string(contourTree.size()) + " arcs",
+                 1.0, elapsed, threadNumber);
+
+    // reference on the whole grid
+    ttk::ImplicitTriangulation triangulation;
+    triangulation.setInputGrid(
+      0, 0, 0, 1, 1, 1, dimensions[0], dimensions[1], dimensions[2]);
+    const ttk::SimplexId nVerts = triangulation.getNumberOfVertices();
+    std::vector<double> allScalars(nVerts);
+    std::vector<ttk::SimplexId> order(nVerts);
+    for(ttk::SimplexId i = 0; i < nVerts; ++i) {
+      allScalars[i] = field(dimensions, i, noise, seed);
+    }
+    ttk::preconditionOrderArray(
+      nVerts, allScalars.data(), order.data(), threadNumber);
+
+    ttk::PersistenceDiagram persistenceDiagram;
+    persistenceDiagram.setDebugLevel(0);
+    persistenceDiagram.setThreadNumber(threadNumber);
+    tm.reStart();
+    persistenceDiagram.preconditionTriangulation(&triangulation);
+    std::vector<ttk::PersistencePair> reference{};
+    persistenceDiagram.execute(
+      reference, allScalars.data(), order.data(), &triangulation);
+    msg.printMsg("Sequential persistence diagram", 1.0, tm.getElapsedTime(),
+                 threadNumber);
+
+    ttk::ftm::FTMTree ftmTree;
+    ftmTree.setDebugLevel(0);
+    ftmTree.setThreadNumber(threadNumber);
+    tm.reStart();
+    ftmTree.preconditionTriangulation(&triangulation);
+    ftmTree.setVertexScalars(allScalars.data());
+    ftmTree.setVertexSoSoffsets(order.data());
+    ftmTree.setTreeType(ttk::ftm::TreeType::Contour);
+    ftmTree.setSegmentation(false);
+    ftmTree.build<double>(&triangulation);
+    msg.printMsg(
+      "Sequential contour tree", 1.0, tm.getElapsedTime(), threadNumber);
+
+    const auto tree = ftmTree.getTree(ttk::ftm::TreeType::Contour);
+    std::vector<std::pair<ttk::SimplexId, ttk::SimplexId>> arcs{};
+    for(ttk::ftm::idSuperArc a = 0; a < tree->getNumberOfSuperArcs(); ++a) {
+      const auto arc = tree->getSuperArc(a);
+      if(arc->isVisible()) {
+        arcs.emplace_back(tree->getNode(arc->getDownNodeId())->getVertexId(),
+                          tree->getNode(arc->getUpNodeId())->getVertexId());
+      }
+    }
+
+    std::vector<decltype(toTuple(diagram[0]))> pairs[2];
+    for(const auto &p : diagram) {
+      pairs[0].emplace_back(toTuple(p));
+    }
+    for(const auto &p : reference) {
+      pairs[1].emplace_back(toTuple(p));
+    }
+    std::sort(arcs.begin(), arcs.end());
+    std::sort(contourTree.begin(), contourTree.end());
+    std::sort(pairs[0].begin(), pairs[0].end());
+    std::sort(pairs[1].begin(), pairs[1].end());
+
+    msg.printMsg(std::string{"Persistence diagram: "}
+                 + (pairs[0] == pairs[1] ? "identical" : "different"));
+    msg.printMsg(std::string{"Contour tree: "}
+                 + (arcs == contourTree ? "identical" : "different"));
+  }
+
+#ifdef TTK_ENABLE_MPI
+  MPI_Finalize();
+#endif // TTK_ENABLE_MPI
+
+  return 0;
+}
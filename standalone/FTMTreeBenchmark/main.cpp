@@ -0,0 +1,366 @@
+/// \author agent <agent@local>.
+/// \date October 2026.
+///
+/// \brief Check and benchmark of the incremental update of the FTM trees
+/// (see ttk::ftm::FTMTree::update()).
+///
+/// Builds the join, split or contour tree of a noisy synthetic scalar field
+/// on a regular grid, then perturbs the field several times, either on
+/// scattered vertices or on a block of vertices, and updates the tree after
+/// each perturbation. Each update is reported as repaired in place or
+/// rebuilt: most perturbations of the noisy default field create or move
+/// critical points and are rebuilt, fewer or smaller changes (-n, -p) are
+/// more often repaired. With the check option, the segmentation of each tree
+/// is validated (the regular vertices of an arc lie strictly between its
+/// nodes, in increasing order, and each vertex belongs to exactly one node
+/// or arc), each updated tree is compared with a tree built from scratch
+/// (nodes, arcs and segmentation, with normalized identifiers) and the
+/// program returns a non-zero value if a tree is invalid or if they differ.
+///
+/// The scheduler option selects the tasks of the leaf growth and of the
+/// trunk (see ttk::ftm::TaskScheduler, work stealing is experimental) and
+/// the skew option restricts the noise to the first eighth of the grid:
+/// most leaves are then grown there while the rest of the grid makes a few
+/// large arcs.
+
+// TTK Includes
+#include <CommandLineParser.h>
+#include <FTMTree.h>
+#include <ImplicitTriangulation.h>
+#include <OrderDisambiguation.h>
+
+#include <random>
+
+namespace {
+
+  void setupTree(ttk::ftm::FTMTree &tree,
+                 ttk::ImplicitTriangulation &triangulation,
+                 std::vector<double> &scalars,
+                 const std::vector<ttk::SimplexId> &offsets,
+                 const int treeType,
+                 const int scheduler) {
+    tree.setThreadNumber(ttk::globalThreadNumber_);
+    tree.setDebugLevel(ttk::globalDebugLevel_);
+    tree.preconditionTriangulation(&triangulation);
+    tree.setVertexScalars(scalars.data());
+    tree.setVertexSoSoffsets(offsets.data());
+    tree.setTreeType(treeType);
+    tree.setTaskScheduler(static_cast<ttk::ftm::TaskScheduler>(scheduler));
+    tree.setSegmentation(true);
+    tree.setNormalizeIds(true);
+  }
+
+  // first invalid arc or vertex of the segmentation of a tree (empty if
+  // none): the regular vertices of an arc lie strictly between its nodes,
+  // in increasing order, and each vertex is either a node or a regular
+  // vertex of exactly one arc
+  std::string checkSegmentation(ttk::ftm::FTMTree_MT *const tree,
+                                const std::vector<ttk::SimplexId> &offsets) {
+    std::vector<int> seen(offsets.size(), 0);
+    for(ttk::ftm::idNode i = 0; i < tree->getNumberOfNodes(); ++i) {
+      ++seen[tree->getNode(i)->getVertexId()];
+    }
+    for(ttk::ftm::idSuperArc i = 0; i < tree->getNumberOfSuperArcs(); ++i) {
+      const auto arc = tree->getSuperArc(i);
+      if(!arc->isVisible()) {
+        continue;
+      }
+      const auto down = tree->getNode(arc->getDownNodeId())->getVertexId();
+      const auto up = tree->getNode(arc->getUpNodeId())->getVertexId();
+      for(ttk::SimplexId j = 0; j < arc->getNumberOfRegularNodes(); ++j) {
+        const auto v = arc->getRegularNodeId(j);
+        ++seen[v];
+        if(!tree->compLower(down, v) || !tree->compLower(v, up)) {
+          return "vertex " + std::to_string(v) + " out of the range of arc "
+                 + std::to_string(i);
+        }
+        if(j > 0 && offsets[arc->getRegularNodeId(j - 1)] > offsets[v]) {
+          return "segmentation of arc " + std::to_string(i) + " not sorted";
+        }
+      }
+    }
+    for(size_t v = 0; v < seen.size(); ++v) {
+      if(seen[v] != 1) {
+        return "vertex " + std::to_string(v) + " in "
+               + std::to_string(seen[v]) + " nodes or arcs";
+      }
+    }
+    return {};
+  }
+
+  // arcs of a tree by normalized identifier: vertices of their down and up
+  // nodes, followed by their segmentation
+  std::vector<std::vector<ttk::SimplexId>>
+    getNormalizedArcs(ttk::ftm::FTMTree_MT *const tree) {
+    std::vector<std::vector<ttk::SimplexId>> arcs(
+      tree->getNumberOfSuperArcs());
+    for(ttk::ftm::idSuperArc i = 0; i < tree->getNumberOfSuperArcs(); ++i) {
+      const auto arc = tree->getSuperArc(i);
+      const auto id = arc->getNormalizedId();
+      if(id >= arcs.size()) {
+        return {};
+      }
+      arcs[id].emplace_back(
+        tree->getNode(arc->getDownNodeId())->getVertexId());
+      arcs[id].emplace_back(tree->getNode(arc->getUpNodeId())->getVertexId());
+      for(ttk::SimplexId j = 0; j < arc->getNumberOfRegularNodes(); ++j) {
+        arcs[id].emplace_back(arc->getRegularNodeId(j));
+      }
+    }
+    return arcs;
+  }
+
+  // first difference between two trees with normalized identifiers (empty
+  // if none)
+  //
+  // The storage order of the nodes and arcs depends on the construction
+  // (an update keeps the one of the previous build), hence the nodes are
+  // compared by vertex and the arcs by normalized identifier.
+  std::string compareTrees(ttk::ftm::FTMTree_MT *const tree,
+                           ttk::ftm::FTMTree_MT *const reference,
+                           const ttk::SimplexId nVerts) {
+
+    std::array<std::vector<ttk::SimplexId>, 2> nodes{};
+    std::array<ttk::ftm::FTMTree_MT *, 2> trees{tree, reference};
+    for(size_t t = 0; t < 2; ++t) {
+      for(ttk::ftm::idNode i = 0; i < trees[t]->getNumberOfNodes(); ++i) {
+        nodes[t].emplace_back(trees[t]->getNode(i)->getVertexId());
+      }
+      std::sort(nodes[t].begin(), nodes[t].end());
+    }
+    if(nodes[0] != nodes[1]) {
+      return "nodes";
+    }
+
+    const auto arcs = getNormalizedArcs(tree);
+    const auto referenceArcs = getNormalizedArcs(reference);
+    if(arcs.size() != tree->getNumberOfSuperArcs()
+       || referenceArcs.size() != reference->getNumberOfSuperArcs()) {
+      return "ids not normalized";
+    }
+    if(arcs.size() != referenceArcs.size()) {
+      return "number of arcs";
+    }
+    for(size_t i = 0; i < arcs.size(); ++i) {
+      if(arcs[i] != referenceArcs[i]) {
+        return "arc " + std::to_string(i) + " or its segmentation";
+      }
+    }
+
+    for(ttk::SimplexId v = 0; v < nVerts; ++v) {
+      if(tree->isCorrespondingArc(v) != reference->isCorrespondingArc(v)
+         || (tree->isCorrespondingArc(v)
+             && tree->vertex2SuperArc(v)->getNormalizedId()
+                  != reference->vertex2SuperArc(v)->getNormalizedId())) {
+        return "arc of vertex " + std::to_string(v);
+      }
+    }
+
+    return {};
+  }
+
+} // namespace
+
+int main(int argc, char **argv) {
+
+  std::vector<int> dimensions{};
+  int treeType{2};
+  int nUpdates{10};
+  int nChanges{64};
+  int blockSize{0};
+  double amplitude{0.05};
+  int seed{0};
+  int scheduler{0};
+  bool skewed{false};
+  bool check{false};
+
+  {
+    ttk::CommandLineParser parser;
+
+    parser.setArgument("g", &dimensions,
+                       "Grid dimensions (number of vertices, repeat the "
+                       "option for each axis, default: 40)",
+                       true);
+    parser.setArgument(
+      "T", &treeType, "Tree type {0: JT, 1: ST, 2: CT} (default: 2)", true);
+    parser.setArgument(
+      "u", &nUpdates, "Number of updates (default: 10)", true);
+    parser.setArgument("n", &nChanges,
+                       "Number of scattered changed vertices per update "
+                       "(default: 64)",
+                       true);
+    parser.setArgument("b", &blockSize,
+                       "Edge of a block of changed vertices per update, "
+                       "instead of scattered ones (default: 0)",
+                       true);
+    parser.setArgument("p", &amplitude,
+                       "Amplitude of the perturbations (default: 0.05)", true);
+    parser.setArgument("s", &seed, "Seed of the random field (default: 0)",
+                       true);
+    parser.setArgument("S", &scheduler,
+                       "Task scheduler {0: OpenMP, 1: work stealing "
+                       "(experimental)} (default: 0)",
+                       true);
+    parser.setOption("k", &skewed, "Noise in the first eighth of the grid");
+    parser.setOption("c", &check, "Compare with trees built from scratch");
+
+    parser.parse(argc, argv);
+  }
+
+  ttk::Debug msg;
+  msg.setDebugMsgPrefix("FTMTreeBenchmark");
+
+  if(dimensions.empty()) {
+    dimensions = {40};
+  }
+  dimensions.resize(3, dimensions.back());
+  if(treeType < 0 || treeType > 2) {
+    msg.printErr("Unsupported tree type " + std::to_string(treeType));
+    return EXIT_FAILURE;
+  }
+  if(scheduler < 0 || scheduler > 1) {
+    msg.printErr("Unsupported task scheduler " + std::to_string(scheduler));
+    return EXIT_FAILURE;
+  }
+
+  ttk::ImplicitTriangulation triangulation{};
+  triangulation.setInputGrid(
+    0, 0, 0, 1, 1, 1, dimensions[0], dimensions[1], dimensions[2]);
+  const ttk::SimplexId nVerts = triangulation.getNumberOfVertices();
+  msg.printMsg("Grid: " + std::to_string(dimensions[0]) + "x"
+               + std::to_string(dimensions[1]) + "x"
+               + std::to_string(dimensions[2]));
+
+  // smooth field with random noise
+  std::vector<double> scalars(nVerts);
+  std::vector<ttk::SimplexId> offsets(nVerts);
+  std::mt19937 generator(seed);
+  std::uniform_real_distribution<double> noise(0.0, 0.1);
+  for(ttk::SimplexId i = 0; i < nVerts; ++i) {
+    const auto x = i % dimensions[0];
+    const auto y = (i / dimensions[0]) % dimensions[1];
+    const auto z = i / (dimensions[0] * dimensions[1]);
+    const double n = noise(generator);
+    scalars[i] = std::sin(0.2 * x) * std::cos(0.15 * y)
+                   * std::sin(0.1 * z + 0.2)
+                 + (!skewed || 8 * x < dimensions[0] ? n : 0.0);
+  }
+  ttk::preconditionOrderArray(
+    nVerts, scalars.data(), offsets.data(), ttk::globalThreadNumber_);
+
+  ttk::ftm::FTMTree tree{};
+  setupTree(tree, triangulation, scalars, offsets, treeType, scheduler);
+  ttk::Timer tm{};
+  tree.build<double>(&triangulation);
+  msg.printMsg("Initial build", 1.0, tm.getElapsedTime(),
+               ttk::globalThreadNumber_);
+  if(check) {
+    const auto invalid = checkSegmentation(
+      tree.getTree(static_cast<ttk::ftm::TreeType>(treeType)), offsets);
+    if(!invalid.empty()) {
+      msg.printErr("Invalid initial build: " + invalid);
+      return EXIT_FAILURE;
+    }
+  }
+
+  std::uniform_real_distribution<double> perturbation(-amplitude, amplitude);
+  std::uniform_int_distribution<ttk::SimplexId> vertices(0, nVerts - 1);
+  double updateTime{}, buildTime{};
+  int nMismatches{}, nRepaired{};
+
+  for(int i = 0; i < nUpdates; ++i) {
+
+    std::vector<ttk::SimplexId> changed{};
+    if(blockSize > 0) {
+      std::array<int, 3> corner{};
+      for(int j = 0; j < 3; ++j) {
+        std::uniform_int_distribution<int> coordinates(
+          0, std::max(dimensions[j] - blockSize, 0));
+        corner[j] = coordinates(generator);
+      }
+      for(int z = corner[2]; z < std::min(corner[2] + blockSize, dimensions[2]);
+          ++z) {
+        for(int y = corner[1];
+            y < std::min(corner[1] + blockSize, dimensions[1]); ++y) {
+          for(int x = corner[0];
+              x < std::min(corner[0] + blockSize, dimensions[0]); ++x) {
+            changed.emplace_back(
+              (static_cast<ttk::SimplexId>(z) * dimensions[1] + y)
+                * dimensions[0]
+              + x);
+          }
+        }
+      }
+    } else {
+      for(int j = 0; j < nChanges; ++j) {
+        changed.emplace_back(vertices(generator));
+      }
+    }
+    for(const auto v : changed) {
+      scalars[v] += perturbation(generator);
+    }
+    ttk::preconditionOrderArray(
+      nVerts, scalars.data(), offsets.data(), ttk::globalThreadNumber_);
+
+    tm.reStart();
+    const bool repaired = tree.update<double>(&triangulation, changed);
+    const double elapsed = tm.getElapsedTime();
+    updateTime += elapsed;
+    nRepaired += repaired;
+
+    std::string difference{};
+    if(check) {
+      ttk::ftm::FTMTree reference{};
+      setupTree(
+        reference, triangulation, scalars, offsets, treeType, scheduler);
+      reference.setDebugLevel(0);
+      tm.reStart();
+      reference.build<double>(&triangulation);
+      buildTime += tm.getElapsedTime();
+
+      const auto tt = static_cast<ttk::ftm::TreeType>(treeType);
+      difference = checkSegmentation(reference.getTree(tt), offsets);
+      if(!difference.empty()) {
+        difference = "invalid build: " + difference;
+      } else {
+        difference = checkSegmentation(tree.getTree(tt), offsets);
+        if(!difference.empty()) {
+          difference = "invalid update: " + difference;
+        } else {
+          difference = compareTrees(
+            tree.getTree(tt), reference.getTree(tt), nVerts);
+          if(!difference.empty()) {
+            difference = "differs from a build: " + difference;
+          }
+        }
+      }
+    }
+
+    if(difference.empty()) {
+      msg.printMsg("Update " + std::to_string(i) + " ("
+                     + std::to_string(changed.size()) + " changed vertices, "
+                     + (repaired ? "repaired" : "rebuilt") + ")",
+                   1.0, elapsed, ttk::globalThreadNumber_);
+    } else {
+      msg.printErr("Update " + std::to_string(i) + ": " + difference);
+      ++nMismatches;
+    }
+  }
+
+  msg.printMsg(std::to_string(nRepaired) + "/" + std::to_string(nUpdates)
+               + " updates repaired in place");
+  msg.printMsg("Total update time", 1.0, updateTime, ttk::globalThreadNumber_);
+  if(check) {
+    msg.printMsg(
+      "Total build time", 1.0, buildTime, ttk::globalThreadNumber_);
+    if(nMismatches > 0) {
+      msg.printErr(std::to_string(nMismatches) + "/"
+                   + std::to_string(nUpdates)
+                   + " updates are invalid or differ from a build");
+      return EXIT_FAILURE;
+    }
+    msg.printMsg("Every update is valid and matches a build");
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,188 @@
+/// \author agent <agent@local>.
+/// \date October 2026.
+///
+/// \brief Benchmark of the implicit triangulation, with and without its
+/// position tables (see ImplicitTriangulation::setPositionFree()).
+///
+/// Times the vertex, edge, triangle and cell queries on a regular grid, in
+/// sequential and in random (shuffled) order, and reports the memory
+/// footprint of the data-structure in both modes.
+
+// TTK Includes
+#include <CommandLineParser.h>
+#include <Os.h>
+#include <Triangulation.h>
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+
+namespace {
+
+  // traverse the simplices in the given order and accumulate their
+  // relations (the sum prevents the compiler from skipping the queries)
+  ttk::SimplexId traverse(const ttk::Triangulation &triangulation,
+                          const std::vector<ttk::SimplexId> &vertices,
+                          const std::vector<ttk::SimplexId> &edges,
+                          const std::vector<ttk::SimplexId> &triangles,
+                          const std::vector<ttk::SimplexId> &cells) {
+
+    const int dimension = triangulation.getDimensionality();
+    ttk::SimplexId sum{}, id{};
+
+    for(const auto v : vertices) {
+      const auto nNeighbors = triangulation.getVertexNeighborNumber(v);
+      for(ttk::SimplexId i = 0; i < nNeighbors; ++i) {
+        triangulation.getVertexNeighbor(v, i, id);
+        sum += id;
+      }
+      const auto nEdges = triangulation.getVertexEdgeNumber(v);
+      for(ttk::SimplexId i = 0; i < nEdges; ++i) {
+        triangulation.getVertexEdge(v, i, id);
+        sum += id;
+      }
+      const auto nStars = triangulation.getVertexStarNumber(v);
+      for(ttk::SimplexId i = 0; i < nStars; ++i) {
+        triangulation.getVertexStar(v, i, id);
+        sum += id;
+      }
+    }
+
+    for(const auto e : edges) {
+      for(int i = 0; i < 2; ++i) {
+        triangulation.getEdgeVertex(e, i, id);
+        sum += id;
+      }
+      const auto nStars = triangulation.getEdgeStarNumber(e);
+      for(ttk::SimplexId i = 0; i < nStars; ++i) {
+        triangulation.getEdgeStar(e, i, id);
+        sum += id;
+      }
+    }
+
+    for(const auto t : triangles) {
+      for(int i = 0; i < 3; ++i) {
+        triangulation.getTriangleVertex(t, i, id);
+        sum += id;
+      }
+      const auto nEdges = triangulation.getTriangleEdgeNumber(t);
+      for(ttk::SimplexId i = 0; i < nEdges; ++i) {
+        triangulation.getTriangleEdge(t, i, id);
+        sum += id;
+      }
+    }
+
+    for(const auto c : cells) {
+      for(int i = 0; i <= dimension; ++i) {
+        triangulation.getCellVertex(c, i, id);
+        sum += id;
+      }
+      const auto nNeighbors = triangulation.getCellNeighborNumber(c);
+      for(ttk::SimplexId i = 0; i < nNeighbors; ++i) {
+        triangulation.getCellNeighbor(c, i, id);
+        sum += id;
+      }
+    }
+
+    return sum;
+  }
+
+  std::vector<ttk::SimplexId> identifiers(const ttk::SimplexId n,
+                                          const bool shuffle,
+                                          std::mt19937 &generator) {
+    std::vector<ttk::SimplexId> ids(n);
+    std::iota(ids.begin(), ids.end(), 0);
+    if(shuffle) {
+      std::shuffle(ids.begin(), ids.end(), generator);
+    }
+    return ids;
+  }
+
+} // namespace
+
+int main(int argc, char **argv) {
+
+  std::vector<int> dimensions;
+  int repetitions{3};
+
+  {
+    ttk::CommandLineParser parser;
+
+    parser.setArgument("g", &dimensions,
+                       "Grid dimensions (number of vertices, default: 128^3)",
+                       true);
+    parser.setArgument("r", &repetitions, "Number of repetitions", true);
+
+    parser.parse(argc, argv);
+  }
+
+  ttk::Debug msg;
+  msg.setDebugMsgPrefix("ImplicitTriangulationBenchmark");
+
+  if(dimensions.empty()) {
+    dimensions = {128, 128, 128};
+  }
+  dimensions.resize(3, 1);
+  msg.printMsg("Grid: " + std::to_string(dimensions[0]) + "x"
+               + std::to_string(dimensions[1]) + "x"
+               + std::to_string(dimensions[2]));
+
+  for(const bool positionFree : {false, true}) {
+
+    ttk::Triangulation triangulation;
+    triangulation.setDebugLevel(0);
+    triangulation.setPositionFree(positionFree);
+
+    ttk::Timer tm{};
+    triangulation.setInputGrid(0, 0, 0, 1, 1, 1, dimensions[0],
+                               dimensions[1], dimensions[2]);
+    triangulation.preconditionVertexNeighbors();
+    triangulation.preconditionVertexEdges();
+    triangulation.preconditionVertexStars();
+    triangulation.preconditionEdges();
+    triangulation.preconditionEdgeStars();
+    triangulation.preconditionCellNeighbors();
+    if(triangulation.getDimensionality() > 1) {
+      triangulation.preconditionTriangles();
+      triangulation.preconditionTriangleEdges();
+    }
+    const std::string mode{positionFree ? "position-free" : "tables"};
+    msg.printMsg("[" + mode + "] Pre-conditioning", 1.0,
+                 tm.getElapsedTime());
+    msg.printMsg("[" + mode + "] Footprint: "
+                 + std::to_string(triangulation.footprint(true)) + " bytes");
+
+    const ttk::SimplexId nTriangles
+      = triangulation.getDimensionality() > 1
+          ? triangulation.getNumberOfTriangles()
+          : 0;
+
+    for(const bool shuffle : {false, true}) {
+      std::mt19937 generator{0};
+      const auto vertices = identifiers(
+        triangulation.getNumberOfVertices(), shuffle, generator);
+      const auto edges
+        = identifiers(triangulation.getNumberOfEdges(), shuffle, generator);
+      const auto triangles = identifiers(nTriangles, shuffle, generator);
+      const auto cells
+        = identifiers(triangulation.getNumberOfCells(), shuffle, generator);
+
+      double best{-1};
+      ttk::SimplexId sum{};
+      for(int i = 0; i < repetitions; ++i) {
+        tm.reStart();
+        sum += traverse(triangulation, vertices, edges, triangles, cells);
+        const double elapsed = tm.getElapsedTime();
+        if(best < 0 || elapsed < best) {
+          best = elapsed;
+        }
+      }
+      msg.printMsg("[" + mode + "] "
+                     + (shuffle ? "Random" : "Sequential")
+                     + " traversal (checksum " + std::to_string(sum) + ")",
+                   1.0, best);
+    }
+  }
+
+  return 0;
+}
@@ -0,0 +1,225 @@
+/// \author agent <agent@local>.
+/// \date October 2026.
+///
+/// \brief Out-of-core critical point extraction on raw grids (see
+/// ttk::ScalarFieldCriticalPoints::executeOutOfCore()).
+///
+/// Reads a regular grid from a raw file slab by slab (see
+/// ttk::SlabStreamer), within a memory budget, and writes its critical
+/// points (global vertex identifier and critical type, one per line).
+///
+/// With the check option, or without input file (a noisy synthetic field
+/// with ties is then generated), the critical points are also computed
+/// in-core on the whole grid and the program returns a non-zero value if
+/// both results differ.
+
+// TTK Includes
+#include <CommandLineParser.h>
+#include <OrderDisambiguation.h>
+#include <Os.h>
+#include <ScalarFieldCriticalPoints.h>
+#include <SlabStreamer.h>
+
+#include <algorithm>
+#include <fstream>
+#include <random>
+
+namespace {
+
+  using CriticalPoints = std::vector<std::pair<ttk::SimplexId, char>>;
+
+  template <typename dataType>
+  int computeInCore(CriticalPoints &criticalPoints,
+                    const std::string &path,
+                    const std::array<ttk::SimplexId, 3> &dimensions,
+                    const size_t headerSize) {
+
+    const ttk::SimplexId nVerts = dimensions[0] * dimensions[1] * dimensions[2];
+    std::vector<dataType> data(nVerts);
+    std::ifstream file(path, std::ios::in | std::ios::binary);
+    file.seekg(headerSize);
+    file.read(reinterpret_cast<char *>(data.data()), nVerts * sizeof(dataType));
+    if(!file) {
+      return -1;
+    }
+
+    ttk::ImplicitTriangulation triangulation{};
+    triangulation.setDebugLevel(0);
+    triangulation.setInputGrid(0, 0, 0, 1, 1, 1, dimensions[0], dimensions[1],
+                               dimensions[2]);
+
+    std::vector<ttk::SimplexId> order(nVerts);
+    ttk::preconditionOrderArray(
+      nVerts, data.data(), order.data(), ttk::globalThreadNumber_);
+
+    ttk::ScalarFieldCriticalPoints criticalPointsComputer{};
+    criticalPointsComputer.setThreadNumber(ttk::globalThreadNumber_);
+    criticalPointsComputer.setDebugLevel(0);
+    criticalPointsComputer.preconditionTriangulation(&triangulation);
+    criticalPointsComputer.setOutput(&criticalPoints);
+    return criticalPointsComputer.execute(order.data(), &triangulation);
+  }
+
+  template <typename dataType>
+  int run(const std::string &path,
+          const std::array<ttk::SimplexId, 3> &dimensions,
+          const size_t headerSize,
+          const size_t memoryBudget,
+          const std::string &outputPath,
+          const bool check) {
+
+    ttk::Debug msg;
+    msg.setDebugMsgPrefix("OutOfCoreCriticalPoints");
+
+    ttk::SlabStreamer streamer{};
+    streamer.setThreadNumber(ttk::globalThreadNumber_);
+    if(streamer.setInputRawFile(path, dimensions, sizeof(dataType), headerSize)
+       != 0) {
+      return -1;
+    }
+    streamer.setMemoryBudget(memoryBudget);
+
+    CriticalPoints criticalPoints{};
+    ttk::ScalarFieldCriticalPoints criticalPointsComputer{};
+    criticalPointsComputer.setThreadNumber(ttk::globalThreadNumber_);
+    criticalPointsComputer.setOutput(&criticalPoints);
+    if(criticalPointsComputer.executeOutOfCore<dataType>(streamer) != 0) {
+      return -2;
+    }
+
+    if(!outputPath.empty()) {
+      std::ofstream output(outputPath);
+      for(const auto &cp : criticalPoints) {
+        output << cp.first << " " << static_cast<int>(cp.second) << "\n";
+      }
+      if(!output) {
+        msg.printErr("Could not write `" + outputPath + "'");
+        return -3;
+      }
+      msg.printMsg("Wrote " + std::to_string(criticalPoints.size())
+                   + " critical points to `" + outputPath + "'");
+    }
+
+    if(!check) {
+      return 0;
+    }
+
+    ttk::Timer tm{};
+    CriticalPoints reference{};
+    if(computeInCore<dataType>(reference, path, dimensions, headerSize) != 0) {
+      msg.printErr("In-core computation failed");
+      return -4;
+    }
+    msg.printMsg("In-core computation", 1.0, tm.getElapsedTime());
+
+    std::sort(criticalPoints.begin(), criticalPoints.end());
+    std::sort(reference.begin(), reference.end());
+    if(criticalPoints != reference) {
+      msg.printErr("Out-of-core and in-core critical points differ ("
+                   + std::to_string(criticalPoints.size()) + " vs "
+                   + std::to_string(reference.size()) + ")");
+      return -5;
+    }
+    msg.printMsg("Out-of-core and in-core critical points match ("
+                 + std::to_string(reference.size()) + ")");
+
+    return 0;
+  }
+
+} // namespace
+
+int main(int argc, char **argv) {
+
+  std::string inputPath{}, outputPath{}, type{"float"};
+  std::vector<int> dimensions{};
+  int headerSize{0};
+  double memoryBudget{1024};
+  int seed{0};
+  bool check{false};
+
+  {
+    ttk::CommandLineParser parser;
+
+    parser.setArgument("i", &inputPath,
+                       "Input raw file (x-fastest, default: synthetic field)",
+                       true);
+    parser.setArgument("g", &dimensions,
+                       "Grid dimensions (number of vertices, repeat the "
+                       "option for each axis, default: 64)",
+                       true);
+    parser.setArgument(
+      "T", &type, "Scalar type (float or double, default: float)", true);
+    parser.setArgument(
+      "H", &headerSize, "Header size of the raw file (bytes)", true);
+    parser.setArgument(
+      "m", &memoryBudget, "Memory budget per slab (MiB, default: 1024)", true);
+    parser.setArgument("o", &outputPath, "Output critical points", true);
+    parser.setArgument(
+      "s", &seed, "Seed of the synthetic field (default: 0)", true);
+    parser.setOption("c", &check, "Compare with the in-core computation");
+
+    parser.parse(argc, argv);
+  }
+
+  ttk::Debug msg;
+  msg.setDebugMsgPrefix("OutOfCoreCriticalPoints");
+
+  if(dimensions.empty()) {
+    dimensions = {64};
+  }
+  dimensions.resize(3, dimensions.back());
+  const std::array<ttk::SimplexId, 3> dims{
+    dimensions[0], dimensions[1], dimensions[2]};
+
+  if(type != "float" && type != "double") {
+    msg.printErr("Unsupported scalar type `" + type + "'");
+    return EXIT_FAILURE;
+  }
+
+  const bool synthetic = inputPath.empty();
+  if(synthetic) {
+    // noise quantized on a few levels, to exercise the tie-breaking across
+    // slab boundaries
+    std::string directory{};
+    ttk::OsCall::getCurrentDirectory(directory);
+    if(directory.empty() || directory.back() != '/') {
+      directory += '/';
+    }
+    inputPath = directory + "OutOfCoreCriticalPoints.raw";
+    headerSize = 0;
+    check = true;
+
+    std::mt19937 generator(seed);
+    std::uniform_int_distribution<int> levels(0, 15);
+    const size_t nVerts = dims[0] * dims[1] * dims[2];
+    std::ofstream file(inputPath, std::ios::out | std::ios::binary);
+    for(size_t i = 0; i < nVerts; ++i) {
+      if(type == "float") {
+        const float value = levels(generator);
+        file.write(reinterpret_cast<const char *>(&value), sizeof(value));
+      } else {
+        const double value = levels(generator);
+        file.write(reinterpret_cast<const char *>(&value), sizeof(value));
+      }
+    }
+    if(!file) {
+      msg.printErr("Could not write `" + inputPath + "'");
+      return EXIT_FAILURE;
+    }
+    msg.printMsg("Generated a " + std::to_string(dims[0]) + "x"
+                 + std::to_string(dims[1]) + "x" + std::to_string(dims[2])
+                 + " synthetic field in `" + inputPath + "'");
+  }
+
+  const size_t budget = std::max(memoryBudget, 0.0) * (1 << 20);
+  const int status
+    = type == "float"
+        ? run<float>(inputPath, dims, headerSize, budget, outputPath, check)
+        : run<double>(inputPath, dims, headerSize, budget, outputPath, check);
+
+  if(synthetic) {
+    ttk::OsCall::rmFile(inputPath);
+  }
+
+  return status == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
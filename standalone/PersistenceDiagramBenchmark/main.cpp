@@ -0,0 +1,117 @@
+/// \author agent <agent@local>.
+/// \date October 2026.
+///
+/// \brief Benchmark of the persistence diagram backends.
+///
+/// Computes the persistence diagram of a noisy synthetic scalar field on a
+/// regular grid with the FTM, progressive and Discrete Morse Sandwich
+/// backends (see ttk::PersistenceDiagram::BACKEND) and reports their
+/// running times along with the number of pairs of each type.
+
+// TTK Includes
+#include <CommandLineParser.h>
+#include <ImplicitTriangulation.h>
+#include <PersistenceDiagram.h>
+
+#include <array>
+#include <cmath>
+#include <random>
+
+int main(int argc, char **argv) {
+
+  std::vector<int> dimensions;
+  int seed{0};
+  double noise{0.5};
+  double minimumPersistence{0.0};
+  bool saddleConnectors{false};
+
+  {
+    ttk::CommandLineParser parser;
+
+    parser.setArgument("g", &dimensions,
+                       "Grid dimensions (number of vertices, default: 65^3)",
+                       true);
+    parser.setArgument("n", &noise, "Amplitude of the random noise", true);
+    parser.setArgument("s", &seed, "Seed of the random noise", true);
+    parser.setArgument(
+      "p", &minimumPersistence, "Minimum persistence of the pairs", true);
+    parser.setOption(
+      "c", &saddleConnectors, "Saddle-saddle pairs with the FTM backend");
+
+    parser.parse(argc, argv);
+  }
+
+  const int threadNumber = ttk::globalThreadNumber_;
+  ttk::Debug msg;
+  msg.setDebugMsgPrefix("PersistenceDiagramBenchmark");
+
+  if(dimensions.empty()) {
+    dimensions = {65, 65, 65};
+  }
+  dimensions.resize(3, 1);
+  msg.printMsg("Grid: " + std::to_string(dimensions[0]) + "x"
+               + std::to_string(dimensions[1]) + "x"
+               + std::to_string(dimensions[2]));
+
+  ttk::ImplicitTriangulation triangulation;
+  triangulation.setInputGrid(
+    0, 0, 0, 1, 1, 1, dimensions[0], dimensions[1], dimensions[2]);
+
+  // smooth field with random noise
+  const ttk::SimplexId nVerts = triangulation.getNumberOfVertices();
+  std::vector<double> scalars(nVerts);
+  std::vector<ttk::SimplexId> order(nVerts);
+  std::mt19937 generator(seed);
+  std::uniform_real_distribution<double> distribution(0.0, noise);
+  for(ttk::SimplexId i = 0; i < nVerts; ++i) {
+    const auto x = i % dimensions[0];
+    const auto y = (i / dimensions[0]) % dimensions[1];
+    const auto z = i / (dimensions[0] * dimensions[1]);
+    scalars[i] = std::sin(0.2 * x) * std::cos(0.15 * y)
+                   * std::sin(0.1 * z + 0.2)
+                 + distribution(generator);
+  }
+  ttk::preconditionOrderArray(
+    nVerts, scalars.data(), order.data(), threadNumber);
+
+  const std::array<std::string, 3> names{
+    "FTM", "Progressive", "Discrete Morse Sandwich"};
+
+  for(int backEnd = 0; backEnd < 3; ++backEnd) {
+
+    ttk::PersistenceDiagram persistenceDiagram;
+    persistenceDiagram.setDebugLevel(0);
+    persistenceDiagram.setThreadNumber(threadNumber);
+    persistenceDiagram.setBackEnd(
+      static_cast<ttk::PersistenceDiagram::BACKEND>(backEnd));
+    persistenceDiagram.setComputeSaddleConnectors(saddleConnectors);
+    persistenceDiagram.setMinimumPersistence(minimumPersistence);
+
+    ttk::Timer tm{};
+    persistenceDiagram.preconditionTriangulation(&triangulation);
+    const double preconditioning = tm.getElapsedTime();
+
+    tm.reStart();
+    std::vector<ttk::PersistencePair> diagram{};
+    persistenceDiagram.execute(
+      diagram, scalars.data(), order.data(), &triangulation);
+    const double elapsed = tm.getElapsedTime();
+
+    std::array<size_t, 3> nPairs{};
+    for(const auto &pair : diagram) {
+      if(pair.pairType >= 0 && pair.pairType < 3) {
+        nPairs[pair.pairType]++;
+      }
+    }
+
+    msg.printMsg("[" + names[backEnd] + "] Pre-conditioning", 1.0,
+                 preconditioning, threadNumber);
+    msg.printMsg("[" + names[backEnd] + "] " + std::to_string(nPairs[0])
+                   + " min-saddle, " + std::to_string(nPairs[1])
+                   + " saddle-saddle, " + std::to_string(nPairs[2])
+                   + " saddle-max pairs",
+                 1.0, elapsed, threadNumber);
+  }
+
+  return 0;
+}
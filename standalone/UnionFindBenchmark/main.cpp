@@ -0,0 +1,170 @@
+/// \author agent <agent@local>.
+/// \date October 2026.
+///
+/// \brief Benchmark of the lock-free union-find (see ttk::AtomicUnionFind).
+///
+/// Merges random pairs of elements with the sequential ttk::UnionFind, with
+/// the same union-find behind a lock shared by all threads, and with
+/// ttk::AtomicUnionFind, and reports their running times along with the
+/// number of resulting sets. Drawing the pairs from a small range of "hot"
+/// elements makes the threads contend on the same few sets: the lock-free
+/// union-find is then also run with these hot elements padded to cache
+/// lines, to measure the cost of false sharing.
+
+// TTK Includes
+#include <AtomicUnionFind.h>
+#include <CommandLineParser.h>
+#include <OpenMPLock.h>
+#include <Os.h>
+#include <UnionFind.h>
+
+#include <functional>
+#include <random>
+
+namespace {
+
+  // union-find node without data
+  class Node : public ttk::AtomicUnionFind<Node> {};
+
+  // node alone on its cache line when stored in an array
+  constexpr size_t CACHE_LINE_SIZE = 64;
+  struct PaddedNode {
+    Node node{};
+    char padding[CACHE_LINE_SIZE - sizeof(Node)];
+  };
+
+  template <typename unionFindType>
+  size_t countSets(const std::vector<unionFindType *> &elements) {
+    size_t nSets{};
+    for(const auto e : elements) {
+      if(e->find() == e) {
+        ++nSets;
+      }
+    }
+    return nSets;
+  }
+
+} // namespace
+
+int main(int argc, char **argv) {
+
+  int nElements{1 << 20};
+  int nUnions{-1};
+  int hot{0};
+  int repetitions{3};
+
+  {
+    ttk::CommandLineParser parser;
+
+    parser.setArgument(
+      "n", &nElements, "Number of elements (default: 2^20)", true);
+    parser.setArgument(
+      "u", &nUnions, "Number of unions (default: number of elements)", true);
+    parser.setArgument(
+      "c", &hot, "Range of the merged elements (default: all)", true);
+    parser.setArgument("r", &repetitions, "Number of repetitions", true);
+
+    parser.parse(argc, argv);
+  }
+
+  ttk::Debug msg;
+  msg.setDebugMsgPrefix("UnionFindBenchmark");
+
+  if(nUnions < 0) {
+    nUnions = nElements;
+  }
+  if(hot <= 0 || hot > nElements) {
+    hot = nElements;
+  }
+  const int nThreads = ttk::globalThreadNumber_;
+  msg.printMsg(std::to_string(nUnions) + " unions of " + std::to_string(hot)
+               + " among " + std::to_string(nElements) + " elements");
+
+  std::vector<std::pair<int, int>> pairs(nUnions);
+  std::mt19937 generator{0};
+  std::uniform_int_distribution<int> distribution{0, hot - 1};
+  for(auto &p : pairs) {
+    p.first = distribution(generator);
+    p.second = distribution(generator);
+  }
+
+  // best time over the repetitions, with the number of resulting sets
+  auto run = [&](const std::string &name, const int threads,
+                 const std::function<size_t(ttk::Timer &, double &)> &merge) {
+    double best{-1};
+    size_t nSets{};
+    for(int i = 0; i < repetitions; ++i) {
+      ttk::Timer tm{};
+      double elapsed{};
+      nSets = merge(tm, elapsed);
+      if(best < 0 || elapsed < best) {
+        best = elapsed;
+      }
+    }
+    msg.printMsg(name + " (" + std::to_string(nSets) + " sets)", 1.0, best,
+                 threads);
+  };
+
+  run("Sequential", 1, [&](ttk::Timer &tm, double &elapsed) {
+    std::vector<ttk::UnionFind> seeds(nElements);
+    std::vector<ttk::UnionFind *> elements(nElements);
+    for(int i = 0; i < nElements; ++i) {
+      elements[i] = &seeds[i];
+    }
+    tm.reStart();
+    for(const auto &p : pairs) {
+      ttk::UnionFind::makeUnion(elements[p.first], elements[p.second]);
+    }
+    elapsed = tm.getElapsedTime();
+    return countSets(elements);
+  });
+
+  run("Locked", nThreads, [&](ttk::Timer &tm, double &elapsed) {
+    std::vector<ttk::UnionFind> seeds(nElements);
+    std::vector<ttk::UnionFind *> elements(nElements);
+    for(int i = 0; i < nElements; ++i) {
+      elements[i] = &seeds[i];
+    }
+    ttk::Lock lock{};
+    tm.reStart();
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(nThreads)
+#endif // TTK_ENABLE_OPENMP
+    for(int i = 0; i < nUnions; ++i) {
+      lock.lock();
+      ttk::UnionFind::makeUnion(
+        elements[pairs[i].first], elements[pairs[i].second]);
+      lock.unlock();
+    }
+    elapsed = tm.getElapsedTime();
+    return countSets(elements);
+  });
+
+  // the nHot first elements are padded to cache lines
+  auto lockFree = [&](const int nHot) {
+    return [&, nHot](ttk::Timer &tm, double &elapsed) {
+      std::vector<PaddedNode> hotNodes(nHot);
+      std::vector<Node> nodes(nElements - nHot);
+      std::vector<Node *> elements(nElements);
+      for(int i = 0; i < nElements; ++i) {
+        elements[i] = i < nHot ? &hotNodes[i].node : &nodes[i - nHot];
+      }
+      tm.reStart();
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(nThreads)
+#endif // TTK_ENABLE_OPENMP
+      for(int i = 0; i < nUnions; ++i) {
+        Node::makeUnion(elements[pairs[i].first], elements[pairs[i].second]);
+      }
+      elapsed = tm.getElapsedTime();
+      return countSets(elements);
+    };
+  };
+
+  run("Lock-free", nThreads, lockFree(0));
+  if(hot < nElements) {
+    run("Lock-free, padded hot elements", nThreads, lockFree(hot));
+  }
+
+  return 0;
+}